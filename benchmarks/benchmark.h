@@ -0,0 +1,111 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <godot_cpp/godot.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Written by benchmarks so the compiler can't drop the work they measure.
+inline volatile double benchmark_sink = 0;
+
+struct BenchmarkResult {
+	std::string name;
+	int64_t elements = 0;
+	int iterations = 0;
+	double min_ns = 0;
+	double median_ns = 0;
+};
+
+// Every benchmark_run() of the program, in order, for benchmark_save_json().
+inline std::vector<BenchmarkResult> benchmark_results;
+
+// Runs p_func once to warm up, then p_iterations times, and prints the fastest
+// and the median run in nanoseconds per element.
+template <typename F>
+void benchmark_run(const char *p_name, int64_t p_elements, const F &p_func, int p_iterations = 20) {
+	p_func();
+
+	std::vector<double> elapsed(p_iterations);
+	for (int i = 0; i < p_iterations; i++) {
+		const auto begin = std::chrono::steady_clock::now();
+		p_func();
+		elapsed[i] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+	}
+	std::sort(elapsed.begin(), elapsed.end());
+
+	BenchmarkResult result;
+	result.name = p_name;
+	result.elements = p_elements;
+	result.iterations = p_iterations;
+	result.min_ns = elapsed[0] / p_elements;
+	result.median_ns = elapsed[p_iterations / 2] / p_elements;
+	benchmark_results.push_back(result);
+
+	printf("%-40s %10.3f ns/element (median %.3f)\n", p_name, result.min_ns, result.median_ns);
+}
+
+// Writes the results as JSON, with one entry per benchmark in the order they
+// ran, so two runs can be compared with compare.py.
+inline bool benchmark_save_json(const char *p_suite, const char *p_path) {
+	FILE *file = fopen(p_path, "w");
+	if (file == nullptr) {
+		fprintf(stderr, "Can't open \"%s\" for writing.\n", p_path);
+		return false;
+	}
+
+	const auto write_string = [file](const std::string &p_string) {
+		fputc('"', file);
+		for (char c : p_string) {
+			if (c == '"' || c == '\\') {
+				fputc('\\', file);
+			}
+			fputc(c, file);
+		}
+		fputc('"', file);
+	};
+
+	fprintf(file, "{\n\t\"suite\": ");
+	write_string(p_suite);
+	fprintf(file, ",\n\t\"results\": [");
+	for (size_t i = 0; i < benchmark_results.size(); i++) {
+		const BenchmarkResult &result = benchmark_results[i];
+		fprintf(file, "%s\n\t\t{ \"name\": ", i == 0 ? "" : ",");
+		write_string(result.name);
+		fprintf(file, ", \"elements\": %lld, \"iterations\": %d, \"min_ns\": %.3f, \"median_ns\": %.3f }",
+				(long long)result.elements, result.iterations, result.min_ns, result.median_ns);
+	}
+	fprintf(file, "\n\t]\n}\n");
+
+	return fclose(file) == 0;
+}
+
+// Called at the end of main(). Saves the results to the path in the
+// GODOT_CPP_BENCHMARK_JSON environment variable, if it's set.
+inline int benchmark_finish(const char *p_suite) {
+	const char *path = getenv("GODOT_CPP_BENCHMARK_JSON");
+	if (path == nullptr || path[0] == '\0') {
+		return 0;
+	}
+	return benchmark_save_json(p_suite, path) ? 0 : 1;
+}
+
+// Lets containers allocate memory without the engine, which normally provides
+// the allocator.
+inline void benchmark_use_malloc() {
+	godot::internal::gdextension_interface_mem_alloc = [](size_t p_bytes) -> void * { return malloc(p_bytes); };
+	godot::internal::gdextension_interface_mem_realloc = [](void *p_ptr, size_t p_bytes) -> void * { return realloc(p_ptr, p_bytes); };
+	godot::internal::gdextension_interface_mem_free = [](void *p_ptr) { free(p_ptr); };
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,301 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Measures the parts of the binding layer that need the engine: Variant
+// construction and conversion per type, MethodBind call() vs ptrcall() with
+// 0 to 8 arguments, calls from the engine into bound methods, ptrcalls into
+// engine classes, StringName creation and ThreadWorkPool dispatch latency.
+//
+// This is a GDExtension library rather than a program. run.sh loads it in a
+// headless Godot, where run.gd calls BindingBenchmarks.run().
+
+#include "../benchmark.h"
+
+#include <gdextension_interface.h>
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/templates/thread_work_pool.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <utility>
+
+using namespace godot;
+
+static constexpr int ELEMENT_COUNT = 1 << 14;
+static constexpr int CALL_COUNT = 1 << 12;
+static constexpr int DISPATCH_COUNT = 256;
+
+// Bound methods that only add up their arguments, so the benchmarks measure
+// the cost of calling them.
+class BindingBenchmarkTarget : public Object {
+	GDCLASS(BindingBenchmarkTarget, Object);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("args0"), &BindingBenchmarkTarget::args0);
+		ClassDB::bind_method(D_METHOD("args1", "a"), &BindingBenchmarkTarget::args1);
+		ClassDB::bind_method(D_METHOD("args2", "a", "b"), &BindingBenchmarkTarget::args2);
+		ClassDB::bind_method(D_METHOD("args3", "a", "b", "c"), &BindingBenchmarkTarget::args3);
+		ClassDB::bind_method(D_METHOD("args4", "a", "b", "c", "d"), &BindingBenchmarkTarget::args4);
+		ClassDB::bind_method(D_METHOD("args5", "a", "b", "c", "d", "e"), &BindingBenchmarkTarget::args5);
+		ClassDB::bind_method(D_METHOD("args6", "a", "b", "c", "d", "e", "f"), &BindingBenchmarkTarget::args6);
+		ClassDB::bind_method(D_METHOD("args7", "a", "b", "c", "d", "e", "f", "g"), &BindingBenchmarkTarget::args7);
+		ClassDB::bind_method(D_METHOD("args8", "a", "b", "c", "d", "e", "f", "g", "h"), &BindingBenchmarkTarget::args8);
+	}
+
+public:
+	int64_t args0() { return 0; }
+	int64_t args1(int64_t a) { return a; }
+	int64_t args2(int64_t a, int64_t b) { return a + b; }
+	int64_t args3(int64_t a, int64_t b, int64_t c) { return a + b + c; }
+	int64_t args4(int64_t a, int64_t b, int64_t c, int64_t d) { return a + b + c + d; }
+	int64_t args5(int64_t a, int64_t b, int64_t c, int64_t d, int64_t e) { return a + b + c + d + e; }
+	int64_t args6(int64_t a, int64_t b, int64_t c, int64_t d, int64_t e, int64_t f) { return a + b + c + d + e + f; }
+	int64_t args7(int64_t a, int64_t b, int64_t c, int64_t d, int64_t e, int64_t f, int64_t g) { return a + b + c + d + e + f + g; }
+	int64_t args8(int64_t a, int64_t b, int64_t c, int64_t d, int64_t e, int64_t f, int64_t g, int64_t h) { return a + b + c + d + e + f + g + h; }
+};
+
+class BindingBenchmarks : public Object {
+	GDCLASS(BindingBenchmarks, Object);
+
+	struct Dispatch {
+		void work(uint32_t p_index, int64_t *p_sum) {
+			benchmark_sink = benchmark_sink + p_index + *p_sum;
+		}
+	};
+
+	template <typename T>
+	static void _bench_variant(const char *p_name, const T &p_value) {
+		benchmark_run(p_name, ELEMENT_COUNT, [&]() {
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				const Variant variant = p_value;
+				const T value = variant;
+				benchmark_sink = benchmark_sink + (variant.get_type() == Variant::NIL ? 0 : 1);
+				(void)value;
+			}
+		});
+	}
+
+	static void _bench_variants() {
+		Array array;
+		array.push_back(1);
+		Dictionary dictionary;
+		dictionary[1] = 2;
+		PackedByteArray bytes;
+		bytes.resize(64);
+		Object *object = memnew(Object);
+
+		_bench_variant("Variant: bool", true);
+		_bench_variant("Variant: int", int64_t(42));
+		_bench_variant("Variant: float", 4.2);
+		_bench_variant("Variant: String", String("godot-cpp benchmark"));
+		_bench_variant("Variant: StringName", StringName("godot-cpp benchmark"));
+		_bench_variant("Variant: Vector2", Vector2(1, 2));
+		_bench_variant("Variant: Vector3", Vector3(1, 2, 3));
+		_bench_variant("Variant: Transform3D", Transform3D(Basis(), Vector3(1, 2, 3)));
+		_bench_variant("Variant: Color", Color(1, 0.5, 0.25));
+		_bench_variant("Variant: Array", array);
+		_bench_variant("Variant: Dictionary", dictionary);
+		_bench_variant("Variant: PackedByteArray", bytes);
+		_bench_variant("Variant: Object", object);
+
+		memdelete(object);
+	}
+
+	// Calls the MethodBind directly, the way the engine calls into the
+	// extension, without the engine's own overhead.
+	template <size_t... I>
+	static void _bench_method_bind(BindingBenchmarkTarget *p_target, std::index_sequence<I...>) {
+		static constexpr size_t ARGUMENT_COUNT = sizeof...(I);
+		const std::string name = std::to_string(ARGUMENT_COUNT) + " arguments";
+		const StringName method = ("args" + std::to_string(ARGUMENT_COUNT)).c_str();
+		const MethodBind *method_bind = ClassDB::get_method(BindingBenchmarkTarget::get_class_static(), method);
+		ERR_FAIL_NULL(method_bind);
+
+		const Variant arguments[ARGUMENT_COUNT + 1] = { Variant(int64_t(I))... };
+		const GDExtensionConstVariantPtr variant_pointers[ARGUMENT_COUNT + 1] = { &arguments[I]... };
+		const int64_t values[ARGUMENT_COUNT + 1] = { int64_t(I)... };
+		const GDExtensionConstTypePtr value_pointers[ARGUMENT_COUNT + 1] = { &values[I]... };
+
+		benchmark_run(("MethodBind call: " + name).c_str(), CALL_COUNT, [&]() {
+			GDExtensionCallError error;
+			int64_t sum = 0;
+			for (int i = 0; i < CALL_COUNT; i++) {
+				sum += int64_t(method_bind->call(p_target, variant_pointers, ARGUMENT_COUNT, error));
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		benchmark_run(("MethodBind ptrcall: " + name).c_str(), CALL_COUNT, [&]() {
+			int64_t sum = 0;
+			for (int i = 0; i < CALL_COUNT; i++) {
+				int64_t ret = 0;
+				method_bind->ptrcall(p_target, value_pointers, &ret);
+				sum += ret;
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		// The whole round trip: into the engine with Object::call(), and
+		// back into the extension through the registered method.
+		benchmark_run(("Object::call: " + name).c_str(), CALL_COUNT, [&]() {
+			int64_t sum = 0;
+			for (int i = 0; i < CALL_COUNT; i++) {
+				sum += int64_t(p_target->call(method, arguments[I]...));
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+	}
+
+	template <size_t... N>
+	static void _bench_method_binds(std::index_sequence<N...>) {
+		BindingBenchmarkTarget *target = memnew(BindingBenchmarkTarget);
+		(_bench_method_bind(target, std::make_index_sequence<N>()), ...);
+		memdelete(target);
+	}
+
+	static void _bench_engine_calls() {
+		Node *node = memnew(Node);
+		node->set_name("BenchmarkNode");
+		OS *os = OS::get_singleton();
+		Engine *engine = Engine::get_singleton();
+
+		benchmark_run("engine ptrcall: Node::get_name", CALL_COUNT, [&]() {
+			int64_t sum = 0;
+			for (int i = 0; i < CALL_COUNT; i++) {
+				sum += node->get_name() == StringName() ? 0 : 1;
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		benchmark_run("engine ptrcall: Node::set_process", CALL_COUNT, [&]() {
+			for (int i = 0; i < CALL_COUNT; i++) {
+				node->set_process(i & 1);
+			}
+		});
+
+		benchmark_run("engine ptrcall: OS::get_ticks_usec", CALL_COUNT, [&]() {
+			int64_t sum = 0;
+			for (int i = 0; i < CALL_COUNT; i++) {
+				sum += os->get_ticks_usec();
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		benchmark_run("engine ptrcall: Engine::is_editor_hint", CALL_COUNT, [&]() {
+			int64_t sum = 0;
+			for (int i = 0; i < CALL_COUNT; i++) {
+				sum += engine->is_editor_hint();
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		benchmark_run("engine: memnew and memdelete Node", CALL_COUNT, [&]() {
+			for (int i = 0; i < CALL_COUNT; i++) {
+				memdelete(memnew(Node));
+			}
+		});
+
+		memdelete(node);
+	}
+
+	static void _bench_string_names() {
+		const String string = "godot-cpp benchmark";
+		const StringName string_name = string;
+
+		benchmark_run("StringName: from literal", ELEMENT_COUNT, [&]() {
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				const StringName name("godot-cpp benchmark");
+				benchmark_sink = benchmark_sink + (name == string_name);
+			}
+		});
+
+		benchmark_run("StringName: from String", ELEMENT_COUNT, [&]() {
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				const StringName name(string);
+				benchmark_sink = benchmark_sink + (name == string_name);
+			}
+		});
+
+		benchmark_run("StringName: copy", ELEMENT_COUNT, [&]() {
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				const StringName name(string_name);
+				benchmark_sink = benchmark_sink + (name == string_name);
+			}
+		});
+
+		benchmark_run("StringName: to String", ELEMENT_COUNT, [&]() {
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				const String name = string_name;
+				benchmark_sink = benchmark_sink + name.length();
+			}
+		});
+	}
+
+	// Time from do_work() to the last thread finishing, with one element per
+	// thread so the work itself is negligible.
+	static void _bench_thread_work_pool() {
+		ThreadWorkPool pool;
+		pool.init();
+		Dispatch dispatch;
+		int64_t sum = 0;
+
+		const std::string name = "ThreadWorkPool: dispatch, " + std::to_string(pool.get_thread_count()) + " threads";
+		benchmark_run(name.c_str(), DISPATCH_COUNT, [&]() {
+			for (int i = 0; i < DISPATCH_COUNT; i++) {
+				pool.do_work(pool.get_thread_count(), &dispatch, &Dispatch::work, &sum);
+			}
+		});
+
+		pool.finish();
+	}
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_static_method("BindingBenchmarks", D_METHOD("run", "json_path"), &BindingBenchmarks::run);
+	}
+
+public:
+	// Runs every benchmark and saves the results to p_json_path, which must
+	// be an absolute path. Returns false if the results couldn't be saved.
+	static bool run(const String &p_json_path) {
+		benchmark_results.clear();
+
+		_bench_variants();
+		_bench_method_binds(std::index_sequence<0, 1, 2, 3, 4, 5, 6, 7, 8>());
+		_bench_engine_calls();
+		_bench_string_names();
+		_bench_thread_work_pool();
+
+		return benchmark_save_json("binding", p_json_path.utf8().get_data());
+	}
+};
+
+static void initialize_binding_benchmarks(ModuleInitializationLevel p_level) {
+	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
+		return;
+	}
+
+	ClassDB::register_class<BindingBenchmarkTarget>();
+	ClassDB::register_abstract_class<BindingBenchmarks>();
+}
+
+static void uninitialize_binding_benchmarks(ModuleInitializationLevel p_level) {
+}
+
+extern "C" {
+GDExtensionBool GDE_EXPORT binding_benchmarks_init(GDExtensionInterfaceGetProcAddress p_get_proc_address, GDExtensionClassLibraryPtr p_library, GDExtensionInitialization *r_initialization) {
+	GDExtensionBinding::InitObject init_obj(p_get_proc_address, p_library, r_initialization);
+
+	init_obj.register_initializer(initialize_binding_benchmarks);
+	init_obj.register_terminator(uninitialize_binding_benchmarks);
+	init_obj.set_minimum_library_initialization_level(MODULE_INITIALIZATION_LEVEL_SCENE);
+
+	return init_obj.init();
+}
+}
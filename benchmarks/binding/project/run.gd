@@ -0,0 +1,13 @@
+extends SceneTree
+
+# Runs the binding benchmarks and quits. The results are saved to the path
+# given with --json=<path> after "--" on the command line.
+
+func _initialize():
+	var path := "user://binding.json"
+	for arg in OS.get_cmdline_user_args():
+		if arg.begins_with("--json="):
+			path = arg.trim_prefix("--json=")
+
+	var saved: bool = BindingBenchmarks.run(ProjectSettings.globalize_path(path))
+	quit(0 if saved else 1)
@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# Runs the binding benchmarks in a headless Godot. Build the benchmark_binding
+# target first. The results are saved as JSON to the path given as the first
+# argument (binding.json by default).
+
+GODOT=${GODOT:-godot}
+JSON=$(realpath "${1:-binding.json}")
+
+cd "$(dirname "$0")/project" || exit 1
+
+# Registers the extension with the project, which only happens on import.
+$GODOT --headless --import >/dev/null 2>&1
+
+$GODOT --headless --script run.gd -- --json="$JSON"
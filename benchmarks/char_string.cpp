@@ -0,0 +1,84 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Compares, searches and case folding on 8 and 32-bit CharStrings of a
+// token-like and a line-like length, at each SIMD level.
+
+#include "benchmark.h"
+
+#include <godot_cpp/core/cpu_features.hpp>
+#include <godot_cpp/variant/char_string.hpp>
+
+using namespace godot;
+
+static constexpr int OPERATIONS = 1 << 16;
+
+template <class T>
+static CharStringT<T> _make(int p_length, T p_last) {
+	CharStringT<T> str;
+	str.resize(p_length + 1);
+	T *ptr = str.ptrw();
+	for (int i = 0; i < p_length; i++) {
+		ptr[i] = T('a' + i % 26);
+	}
+	ptr[p_length - 1] = p_last;
+	ptr[p_length] = 0;
+	return str;
+}
+
+template <class T>
+static void _bench(const char *p_type, int p_length) {
+	// Equal up to the last character.
+	const CharStringT<T> a = _make<T>(p_length, T('x'));
+	const CharStringT<T> b = _make<T>(p_length, T('y'));
+	const CharStringT<T> needle = _make<T>(4, T('y'));
+	char name[64];
+
+	const CPUFeatures::SIMDLevel supported = CPUFeatures::get_simd_level();
+	for (int level = 0; level <= supported; level++) {
+		CPUFeatures::set_max_simd_level(CPUFeatures::SIMDLevel(level));
+		const char *level_name = CPUFeatures::get_simd_level_name(CPUFeatures::SIMDLevel(level));
+
+		snprintf(name, sizeof(name), "compare %s (%s): %d", p_type, level_name, p_length);
+		benchmark_run(name, OPERATIONS, [&]() {
+			int sum = 0;
+			for (int i = 0; i < OPERATIONS; i++) {
+				sum += a.compare(b);
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		snprintf(name, sizeof(name), "find %s (%s): %d", p_type, level_name, p_length);
+		benchmark_run(name, OPERATIONS, [&]() {
+			int sum = 0;
+			for (int i = 0; i < OPERATIONS; i++) {
+				sum += a.find(needle);
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+
+		snprintf(name, sizeof(name), "to_upper %s (%s): %d", p_type, level_name, p_length);
+		benchmark_run(name, OPERATIONS, [&]() {
+			int sum = 0;
+			for (int i = 0; i < OPERATIONS; i++) {
+				sum += a.to_upper().length();
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+	}
+	CPUFeatures::set_max_simd_level(supported);
+}
+
+int main() {
+	benchmark_use_malloc();
+	CPUFeatures::initialize();
+
+	_bench<char>("char", 16);
+	_bench<char>("char", 1024);
+	_bench<char32_t>("char32_t", 16);
+	_bench<char32_t>("char32_t", 1024);
+
+	return benchmark_finish("char_string");
+}
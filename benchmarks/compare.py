@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+
+# Compares two sets of benchmark results saved as JSON, either two files or
+# two folders of files with the same names, and prints the change of the
+# median time of every benchmark. Exits with 1 if any benchmark got slower by
+# more than the threshold.
+#
+# Usage: compare.py <baseline> <current> [threshold percent, 5 by default]
+
+import json
+import os
+import sys
+
+
+def load(path):
+    paths = [path]
+    if os.path.isdir(path):
+        paths = sorted(os.path.join(path, name) for name in os.listdir(path) if name.endswith(".json"))
+
+    results = {}
+    for file_path in paths:
+        with open(file_path, "r") as file:
+            data = json.load(file)
+        for result in data["results"]:
+            results[data["suite"] + ": " + result["name"]] = result["median_ns"]
+    return results
+
+
+if len(sys.argv) < 3:
+    print("Usage: compare.py <baseline> <current> [threshold percent]")
+    sys.exit(2)
+
+baseline = load(sys.argv[1])
+current = load(sys.argv[2])
+threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 5.0
+
+regressions = 0
+for name, median in current.items():
+    if name not in baseline:
+        print("%-60s %10.3f ns (new)" % (name, median))
+        continue
+
+    change = (median / baseline[name] - 1.0) * 100.0 if baseline[name] > 0 else 0.0
+    marker = ""
+    if change > threshold:
+        marker = " REGRESSION"
+        regressions += 1
+    print("%-60s %10.3f ns %+7.1f%%%s" % (name, median, change, marker))
+
+for name in baseline:
+    if name not in current:
+        print("%-60s (removed)" % name)
+
+if regressions:
+    print("%d benchmark(s) got slower by more than %g%%." % (regressions, threshold))
+    sys.exit(1)
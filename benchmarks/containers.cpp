@@ -0,0 +1,204 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Measures the common operations of HashMap, RBMap, List and LocalVector:
+// inserting, looking up (half of the lookups miss), iterating and erasing.
+
+#include "benchmark.h"
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/list.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/rb_map.hpp>
+
+#include <vector>
+
+using namespace godot;
+
+static constexpr int ELEMENT_COUNT = 1 << 14;
+
+// Even keys in random order, so odd lookups miss.
+static std::vector<int64_t> _make_keys() {
+	std::vector<int64_t> keys(ELEMENT_COUNT);
+	uint32_t state = 42;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		keys[i] = int64_t(i) * 2;
+	}
+	for (int i = ELEMENT_COUNT - 1; i > 0; i--) {
+		state = state * 1664525u + 1013904223u;
+		std::swap(keys[i], keys[(state >> 8) % (i + 1)]);
+	}
+	return keys;
+}
+
+static void _bench_hash_map(const std::vector<int64_t> &p_keys) {
+	benchmark_run("HashMap: insert", ELEMENT_COUNT, [&]() {
+		HashMap<int64_t, int64_t> map;
+		for (int64_t key : p_keys) {
+			map.insert(key, key);
+		}
+		benchmark_sink = benchmark_sink + map.size();
+	});
+
+	HashMap<int64_t, int64_t> map;
+	for (int64_t key : p_keys) {
+		map.insert(key, key);
+	}
+
+	benchmark_run("HashMap: lookup", ELEMENT_COUNT, [&]() {
+		int64_t sum = 0;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			const int64_t *value = map.getptr(p_keys[i] + (i & 1));
+			sum += value ? *value : 0;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("HashMap: iterate", ELEMENT_COUNT, [&]() {
+		int64_t sum = 0;
+		for (const KeyValue<int64_t, int64_t> &E : map) {
+			sum += E.value;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("HashMap: copy and erase", ELEMENT_COUNT, [&]() {
+		HashMap<int64_t, int64_t> copy = map;
+		for (int64_t key : p_keys) {
+			copy.erase(key);
+		}
+		benchmark_sink = benchmark_sink + copy.size();
+	});
+}
+
+static void _bench_rb_map(const std::vector<int64_t> &p_keys) {
+	benchmark_run("RBMap: insert", ELEMENT_COUNT, [&]() {
+		RBMap<int64_t, int64_t> map;
+		for (int64_t key : p_keys) {
+			map.insert(key, key);
+		}
+		benchmark_sink = benchmark_sink + map.size();
+	});
+
+	RBMap<int64_t, int64_t> map;
+	for (int64_t key : p_keys) {
+		map.insert(key, key);
+	}
+
+	benchmark_run("RBMap: lookup", ELEMENT_COUNT, [&]() {
+		int64_t sum = 0;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			const RBMap<int64_t, int64_t>::Element *E = map.find(p_keys[i] + (i & 1));
+			sum += E ? E->value() : 0;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("RBMap: iterate", ELEMENT_COUNT, [&]() {
+		int64_t sum = 0;
+		for (const KeyValue<int64_t, int64_t> &E : map) {
+			sum += E.value;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("RBMap: copy and erase", ELEMENT_COUNT, [&]() {
+		RBMap<int64_t, int64_t> copy = map;
+		for (int64_t key : p_keys) {
+			copy.erase(key);
+		}
+		benchmark_sink = benchmark_sink + copy.size();
+	});
+}
+
+static void _bench_list(const std::vector<int64_t> &p_keys) {
+	benchmark_run("List: push_back", ELEMENT_COUNT, [&]() {
+		List<int64_t> list;
+		for (int64_t key : p_keys) {
+			list.push_back(key);
+		}
+		benchmark_sink = benchmark_sink + list.size();
+	});
+
+	List<int64_t> list;
+	for (int64_t key : p_keys) {
+		list.push_back(key);
+	}
+
+	benchmark_run("List: iterate", ELEMENT_COUNT, [&]() {
+		int64_t sum = 0;
+		for (const int64_t &value : list) {
+			sum += value;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("List: push_back and erase every other", ELEMENT_COUNT, [&]() {
+		List<int64_t> copy;
+		for (int64_t key : p_keys) {
+			copy.push_back(key);
+		}
+		for (List<int64_t>::Element *E = copy.front(); E;) {
+			List<int64_t>::Element *next = E->next();
+			if (E->get() & 2) {
+				copy.erase(E);
+			}
+			E = next;
+		}
+		benchmark_sink = benchmark_sink + copy.size();
+	});
+}
+
+static void _bench_local_vector(const std::vector<int64_t> &p_keys) {
+	benchmark_run("LocalVector: push_back", ELEMENT_COUNT, [&]() {
+		LocalVector<int64_t> vector;
+		for (int64_t key : p_keys) {
+			vector.push_back(key);
+		}
+		benchmark_sink = benchmark_sink + vector.size();
+	});
+
+	benchmark_run("LocalVector: push_back, reserved", ELEMENT_COUNT, [&]() {
+		LocalVector<int64_t> vector;
+		vector.reserve(ELEMENT_COUNT);
+		for (int64_t key : p_keys) {
+			vector.push_back(key);
+		}
+		benchmark_sink = benchmark_sink + vector.size();
+	});
+
+	LocalVector<int64_t> vector;
+	for (int64_t key : p_keys) {
+		vector.push_back(key);
+	}
+
+	benchmark_run("LocalVector: iterate", ELEMENT_COUNT, [&]() {
+		int64_t sum = 0;
+		for (int64_t value : vector) {
+			sum += value;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("LocalVector: remove_at_unordered", ELEMENT_COUNT, [&]() {
+		LocalVector<int64_t> copy = vector;
+		while (copy.size()) {
+			copy.remove_at_unordered(copy.size() / 2);
+		}
+		benchmark_sink = benchmark_sink + copy.size();
+	});
+}
+
+int main() {
+	benchmark_use_malloc();
+
+	const std::vector<int64_t> keys = _make_keys();
+	_bench_hash_map(keys);
+	_bench_rb_map(keys);
+	_bench_list(keys);
+	_bench_local_vector(keys);
+
+	return benchmark_finish("containers");
+}
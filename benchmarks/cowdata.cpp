@@ -0,0 +1,82 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Measures Vector growth patterns (push_back, push_back after reserve(),
+// append_array, copy-on-write of a shared vector) with POD and string payloads.
+
+#include "benchmark.h"
+
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/char_string.hpp>
+
+using namespace godot;
+
+static constexpr int ELEMENT_COUNT = 1 << 16;
+
+template <typename T, typename F>
+static void _bench_push_back(const char *p_name, const F &p_make, bool p_reserve) {
+	benchmark_run(p_name, ELEMENT_COUNT, [&]() {
+		Vector<T> vector;
+		if (p_reserve) {
+			vector.reserve(ELEMENT_COUNT);
+		}
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			vector.push_back(p_make(i));
+		}
+		benchmark_sink = benchmark_sink + vector.size();
+	});
+}
+
+template <typename T, typename F>
+static void _bench_append_array(const char *p_name, const F &p_make) {
+	static constexpr int CHUNK_SIZE = 64;
+
+	Vector<T> chunk;
+	for (int i = 0; i < CHUNK_SIZE; i++) {
+		chunk.push_back(p_make(i));
+	}
+
+	benchmark_run(p_name, ELEMENT_COUNT, [&]() {
+		Vector<T> vector;
+		for (int i = 0; i < ELEMENT_COUNT / CHUNK_SIZE; i++) {
+			vector.append_array(chunk);
+		}
+		benchmark_sink = benchmark_sink + vector.size();
+	});
+}
+
+// Appends to a copy of a shared vector, which unshares it once.
+template <typename T, typename F>
+static void _bench_copy_on_write(const char *p_name, const F &p_make) {
+	Vector<T> shared;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		shared.push_back(p_make(i));
+	}
+
+	benchmark_run(p_name, ELEMENT_COUNT, [&]() {
+		Vector<T> vector = shared;
+		vector.push_back(p_make(0));
+		benchmark_sink = benchmark_sink + vector.size();
+	});
+}
+
+int main() {
+	benchmark_use_malloc();
+
+	const auto make_int = [](int i) { return int64_t(i); };
+	_bench_push_back<int64_t>("push_back: int64", make_int, false);
+	_bench_push_back<int64_t>("push_back: int64, reserved", make_int, true);
+	_bench_append_array<int64_t>("append_array: int64", make_int);
+	_bench_copy_on_write<int64_t>("copy on write: int64", make_int);
+
+	const CharString text("godot-cpp benchmark payload");
+	const auto make_string = [&](int) { return text; };
+	_bench_push_back<CharString>("push_back: string", make_string, false);
+	_bench_push_back<CharString>("push_back: string, reserved", make_string, true);
+	_bench_append_array<CharString>("append_array: string", make_string);
+	_bench_copy_on_write<CharString>("copy on write: string", make_string);
+
+	return benchmark_finish("cowdata");
+}
@@ -0,0 +1,81 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Compares random lookups in VMap (binary search) and FrozenMap (Eytzinger
+// layout) for lookup tables of different sizes, half of them misses.
+
+#include "benchmark.h"
+
+#include <godot_cpp/templates/frozen_map.hpp>
+#include <godot_cpp/templates/vmap.hpp>
+
+#include <vector>
+
+using namespace godot;
+
+static constexpr int QUERY_COUNT = 1 << 20;
+
+static uint32_t _random(uint32_t &r_state) {
+	r_state = r_state * 1664525u + 1013904223u;
+	return r_state >> 8;
+}
+
+static void _bench_lookups(int p_entries) {
+	uint32_t state = 42;
+
+	// Even keys, so odd queries miss.
+	std::vector<int64_t> keys(p_entries);
+	std::vector<int64_t> values(p_entries);
+	for (int i = 0; i < p_entries; i++) {
+		keys[i] = int64_t(i) * 2;
+		values[i] = i;
+	}
+
+	VMap<int64_t, int64_t> vmap;
+	for (int i = 0; i < p_entries; i++) {
+		vmap.insert(keys[i], values[i]); // Appends, keys are sorted.
+	}
+	FrozenMap<int64_t, int64_t> frozen(vmap);
+
+	std::vector<int64_t> queries(QUERY_COUNT);
+	for (int64_t &query : queries) {
+		query = _random(state) % (int64_t(p_entries) * 2);
+	}
+
+	char name[64];
+	snprintf(name, sizeof(name), "VMap: %d entries", p_entries);
+	benchmark_run(name, QUERY_COUNT, [&]() {
+		int64_t sum = 0;
+		for (const int64_t query : queries) {
+			const int index = vmap.find(query);
+			if (index >= 0) {
+				sum += vmap.getv(index);
+			}
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	snprintf(name, sizeof(name), "FrozenMap: %d entries", p_entries);
+	benchmark_run(name, QUERY_COUNT, [&]() {
+		int64_t sum = 0;
+		for (const int64_t query : queries) {
+			const int64_t *value = frozen.getptr(query);
+			if (value) {
+				sum += *value;
+			}
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+}
+
+int main() {
+	benchmark_use_malloc();
+
+	_bench_lookups(1000);
+	_bench_lookups(100000);
+	_bench_lookups(1000000);
+
+	return benchmark_finish("frozen_map");
+}
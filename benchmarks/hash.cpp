@@ -0,0 +1,103 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Compares buffer hashing throughput of djb2, murmur3 and hash64_buffer() at
+// each SIMD level, and HashMap lookups with the default and fast hashers.
+
+#include "benchmark.h"
+
+#include <godot_cpp/core/cpu_features.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+#include <vector>
+
+using namespace godot;
+
+static constexpr int64_t BYTES_PER_RUN = 1 << 24;
+static constexpr int GRID_SIZE = 64;
+
+static void _bench_buffers(int64_t p_length, const std::vector<uint8_t> &p_data) {
+	const int64_t count = BYTES_PER_RUN / p_length;
+	char name[64];
+
+	snprintf(name, sizeof(name), "djb2: %lld bytes", (long long)p_length);
+	benchmark_run(name, BYTES_PER_RUN, [&]() {
+		uint32_t sum = 0;
+		for (int64_t i = 0; i < count; i++) {
+			sum += hash_djb2_buffer(p_data.data(), p_length, i);
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	snprintf(name, sizeof(name), "murmur3: %lld bytes", (long long)p_length);
+	benchmark_run(name, BYTES_PER_RUN, [&]() {
+		uint32_t sum = 0;
+		for (int64_t i = 0; i < count; i++) {
+			sum += hash_murmur3_buffer(p_data.data(), p_length, i);
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	const CPUFeatures::SIMDLevel supported = CPUFeatures::get_simd_level();
+	for (int level = 0; level <= supported; level++) {
+		CPUFeatures::set_max_simd_level(CPUFeatures::SIMDLevel(level));
+		snprintf(name, sizeof(name), "hash64 (%s): %lld bytes", CPUFeatures::get_simd_level_name(CPUFeatures::SIMDLevel(level)), (long long)p_length);
+		benchmark_run(name, BYTES_PER_RUN, [&]() {
+			uint64_t sum = 0;
+			for (int64_t i = 0; i < count; i++) {
+				sum += hash64_buffer(p_data.data(), p_length, i);
+			}
+			benchmark_sink = benchmark_sink + sum;
+		});
+	}
+	CPUFeatures::set_max_simd_level(supported);
+}
+
+template <class Hasher>
+static void _bench_grid(const char *p_name) {
+	HashMap<Vector3i, int, Hasher> map;
+	for (int x = 0; x < GRID_SIZE; x++) {
+		for (int y = 0; y < GRID_SIZE; y++) {
+			for (int z = 0; z < GRID_SIZE; z++) {
+				map.insert(Vector3i(x, y, z), x + y + z);
+			}
+		}
+	}
+
+	benchmark_run(p_name, GRID_SIZE * GRID_SIZE * GRID_SIZE, [&]() {
+		int64_t sum = 0;
+		for (int x = 0; x < GRID_SIZE; x++) {
+			for (int y = 0; y < GRID_SIZE; y++) {
+				for (int z = 0; z < GRID_SIZE; z++) {
+					sum += map[Vector3i(z, y, x)];
+				}
+			}
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+}
+
+int main() {
+	benchmark_use_malloc();
+	CPUFeatures::initialize();
+
+	std::vector<uint8_t> data(1 << 20);
+	uint32_t state = 42;
+	for (uint8_t &byte : data) {
+		state = state * 1664525u + 1013904223u;
+		byte = state >> 24;
+	}
+
+	_bench_buffers(16, data);
+	_bench_buffers(256, data);
+	_bench_buffers(4096, data);
+	_bench_buffers(1 << 20, data);
+
+	_bench_grid<HashMapHasherDefault>("HashMap<Vector3i>: default hasher");
+	_bench_grid<HashMapHasherFast>("HashMap<Vector3i>: fast hasher");
+
+	return benchmark_finish("hash");
+}
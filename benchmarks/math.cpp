@@ -0,0 +1,119 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Measures the math kernels of the built-in real_t types that extensions call
+// in tight loops: vector normalization, basis products and orthonormalization,
+// quaternion slerp, transform inversion and the Math:: scalar functions.
+
+#include "benchmark.h"
+
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/variant/basis.hpp>
+#include <godot_cpp/variant/quaternion.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+
+#include <vector>
+
+using namespace godot;
+
+static constexpr int ELEMENT_COUNT = 1 << 14;
+
+// Deterministic values in [-1, 1].
+static real_t _random(uint32_t &r_state) {
+	r_state = r_state * 1664525u + 1013904223u;
+	return real_t((r_state >> 8) / double(1 << 24) * 2.0 - 1.0);
+}
+
+static Vector3 _random_vector(uint32_t &r_state) {
+	const real_t x = _random(r_state);
+	const real_t y = _random(r_state);
+	const real_t z = _random(r_state);
+	return Vector3(x, y, z);
+}
+
+static Quaternion _random_rotation(uint32_t &r_state) {
+	const Vector3 axis = (_random_vector(r_state) + Vector3(0, 0, 2)).normalized();
+	return Quaternion(axis, _random(r_state) * real_t(Math_PI));
+}
+
+int main() {
+	uint32_t state = 42;
+
+	std::vector<Vector3> vectors;
+	std::vector<Quaternion> rotations;
+	std::vector<Transform3D> transforms;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		vectors.push_back(_random_vector(state));
+		rotations.push_back(_random_rotation(state));
+		transforms.push_back(Transform3D(Basis(rotations.back()).scaled(Vector3(2, 2, 2)), _random_vector(state)));
+	}
+
+	benchmark_run("Vector3: normalized", ELEMENT_COUNT, [&]() {
+		Vector3 sum;
+		for (const Vector3 &vector : vectors) {
+			sum += vector.normalized();
+		}
+		benchmark_sink = benchmark_sink + sum.x;
+	});
+
+	benchmark_run("Vector3: cross and dot", ELEMENT_COUNT, [&]() {
+		real_t sum = 0;
+		for (int i = 1; i < ELEMENT_COUNT; i++) {
+			sum += vectors[i].cross(vectors[i - 1]).dot(vectors[i]);
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("Basis: multiply", ELEMENT_COUNT, [&]() {
+		Basis product;
+		for (const Transform3D &transform : transforms) {
+			product = (product * transform.basis).scaled(Vector3(0.5, 0.5, 0.5));
+		}
+		benchmark_sink = benchmark_sink + product.rows[0].x;
+	});
+
+	benchmark_run("Basis: orthonormalized", ELEMENT_COUNT, [&]() {
+		real_t sum = 0;
+		for (const Transform3D &transform : transforms) {
+			sum += transform.basis.orthonormalized().rows[0].x;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("Quaternion: slerp", ELEMENT_COUNT, [&]() {
+		real_t sum = 0;
+		for (int i = 1; i < ELEMENT_COUNT; i++) {
+			sum += rotations[i - 1].slerp(rotations[i], 0.25).w;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("Transform3D: affine_inverse", ELEMENT_COUNT, [&]() {
+		real_t sum = 0;
+		for (const Transform3D &transform : transforms) {
+			sum += transform.affine_inverse().origin.x;
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	benchmark_run("Transform3D: xform", ELEMENT_COUNT, [&]() {
+		Vector3 sum;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			sum += transforms[i].xform(vectors[i]);
+		}
+		benchmark_sink = benchmark_sink + sum.x;
+	});
+
+	benchmark_run("Math: sin, cos and atan2", ELEMENT_COUNT, [&]() {
+		real_t sum = 0;
+		for (const Vector3 &vector : vectors) {
+			sum += Math::atan2(Math::sin(vector.x), Math::cos(vector.y));
+		}
+		benchmark_sink = benchmark_sink + sum;
+	});
+
+	return benchmark_finish("math");
+}
@@ -0,0 +1,169 @@
+/* godot-cpp benchmarks.
+ *
+ * This is free and unencumbered software released into the public domain.
+ */
+
+// Compares float, double and mixed precision (double world positions, float
+// everything relative to a camera) on transform, culling and physics-like kernels.
+
+#include "benchmark.h"
+
+#include <godot_cpp/variant/mixed_precision.hpp>
+
+#include <vector>
+
+using namespace godot;
+
+static constexpr int OBJECT_COUNT = 4096;
+static constexpr int VERTEX_COUNT = 64;
+static constexpr int BOX_COUNT = 1 << 16;
+static constexpr int PARTICLE_COUNT = 1 << 16;
+static constexpr int PARTICLE_STEPS = 8;
+
+// Deterministic values in [-p_range, p_range].
+static double _random(uint32_t &r_state, double p_range) {
+	r_state = r_state * 1664525u + 1013904223u;
+	return ((r_state >> 8) / double(1 << 24) * 2.0 - 1.0) * p_range;
+}
+
+static Vector3d _random_vector(uint32_t &r_state, double p_range) {
+	const double x = _random(r_state, p_range);
+	const double y = _random(r_state, p_range);
+	const double z = _random(r_state, p_range);
+	return Vector3d(x, y, z);
+}
+
+static Basisd _random_basis(uint32_t &r_state) {
+	return Basisd(_random_vector(r_state, 1.0), _random_vector(r_state, 1.0), _random_vector(r_state, 1.0));
+}
+
+// Six planes around the camera, facing outwards, like a box-shaped frustum.
+template <typename T>
+static void _make_planes(PlaneT<T> *r_planes, const Vector3T<T> &p_center, T p_extent) {
+	for (int i = 0; i < 3; i++) {
+		Vector3T<T> normal;
+		normal[i] = 1;
+		r_planes[i * 2] = PlaneT<T>(normal, p_center[i] + p_extent);
+		r_planes[i * 2 + 1] = PlaneT<T>(-normal, -(p_center[i] - p_extent));
+	}
+}
+
+template <typename T>
+static void _bench_transform(const char *p_name, const std::vector<Transform3Dd> &p_objects, const std::vector<Vector3d> &p_vertices) {
+	std::vector<Transform3DT<T>> objects(p_objects.begin(), p_objects.end());
+	std::vector<Vector3T<T>> vertices(p_vertices.begin(), p_vertices.end());
+	std::vector<Vector3T<T>> out(vertices.size());
+
+	benchmark_run(p_name, OBJECT_COUNT * VERTEX_COUNT, [&]() {
+		for (int i = 0; i < OBJECT_COUNT; i++) {
+			const Transform3DT<T> &xform = objects[i];
+			for (int j = 0; j < VERTEX_COUNT; j++) {
+				out[j] = xform.xform(vertices[j]);
+			}
+			benchmark_sink = benchmark_sink + out[VERTEX_COUNT - 1].x;
+		}
+	});
+}
+
+static void _bench_transform_mixed(const std::vector<Transform3Dd> &p_objects, const std::vector<Vector3d> &p_vertices, const Vector3d &p_camera) {
+	std::vector<Vector3f> vertices(p_vertices.begin(), p_vertices.end());
+	std::vector<Vector3f> out(vertices.size());
+
+	benchmark_run("transform: mixed", OBJECT_COUNT * VERTEX_COUNT, [&]() {
+		for (int i = 0; i < OBJECT_COUNT; i++) {
+			const Transform3Df xform = p_objects[i].relative_to<float>(p_camera);
+			for (int j = 0; j < VERTEX_COUNT; j++) {
+				out[j] = xform.xform(vertices[j]);
+			}
+			benchmark_sink = benchmark_sink + out[VERTEX_COUNT - 1].x;
+		}
+	});
+}
+
+template <typename T>
+static void _bench_culling(const char *p_name, const std::vector<AABBd> &p_boxes, const Vector3d &p_camera) {
+	std::vector<AABBT<T>> boxes(p_boxes.begin(), p_boxes.end());
+	PlaneT<T> planes[6];
+	_make_planes(planes, Vector3T<T>(p_camera), (T)5000);
+
+	benchmark_run(p_name, BOX_COUNT, [&]() {
+		int visible = 0;
+		for (const AABBT<T> &box : boxes) {
+			visible += box.inside_convex_shape(planes, 6);
+		}
+		benchmark_sink = benchmark_sink + visible;
+	});
+}
+
+static void _bench_culling_mixed(const std::vector<AABBd> &p_boxes, const Vector3d &p_camera) {
+	Planef planes[6];
+	_make_planes(planes, Vector3f(), 5000.0f);
+
+	benchmark_run("culling: mixed", BOX_COUNT, [&]() {
+		int visible = 0;
+		for (const AABBd &box : p_boxes) {
+			visible += AABBf(Vector3f(box.position - p_camera), Vector3f(box.size)).inside_convex_shape(planes, 6);
+		}
+		benchmark_sink = benchmark_sink + visible;
+	});
+}
+
+template <typename P, typename V>
+static void _bench_particles(const char *p_name, const std::vector<Vector3d> &p_positions, const std::vector<Vector3d> &p_velocities) {
+	typedef decltype(V().x) VT;
+	std::vector<P> positions(p_positions.begin(), p_positions.end());
+	std::vector<V> velocities(p_velocities.begin(), p_velocities.end());
+	const V gravity(0, -9.8, 0);
+	const VT delta = 1.0 / 60.0;
+	const VT damping = 0.999;
+
+	benchmark_run(p_name, PARTICLE_COUNT * PARTICLE_STEPS, [&]() {
+		for (int step = 0; step < PARTICLE_STEPS; step++) {
+			for (int i = 0; i < PARTICLE_COUNT; i++) {
+				velocities[i] = (velocities[i] + gravity * delta) * damping;
+				positions[i] += P(velocities[i] * delta);
+			}
+		}
+		benchmark_sink = benchmark_sink + positions[0].y;
+	});
+}
+
+int main() {
+	uint32_t state = 42;
+	const Vector3d camera(1e6, 200.0, -3e6);
+
+	std::vector<Transform3Dd> objects;
+	for (int i = 0; i < OBJECT_COUNT; i++) {
+		objects.push_back(Transform3Dd(_random_basis(state), camera + _random_vector(state, 1e4)));
+	}
+	std::vector<Vector3d> vertices;
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		vertices.push_back(_random_vector(state, 10.0));
+	}
+
+	_bench_transform<float>("transform: float", objects, vertices);
+	_bench_transform<double>("transform: double", objects, vertices);
+	_bench_transform_mixed(objects, vertices, camera);
+
+	std::vector<AABBd> boxes;
+	for (int i = 0; i < BOX_COUNT; i++) {
+		boxes.push_back(AABBd(camera + _random_vector(state, 1e4), _random_vector(state, 50.0).abs()));
+	}
+
+	_bench_culling<float>("culling: float", boxes, camera);
+	_bench_culling<double>("culling: double", boxes, camera);
+	_bench_culling_mixed(boxes, camera);
+
+	std::vector<Vector3d> positions;
+	std::vector<Vector3d> velocities;
+	for (int i = 0; i < PARTICLE_COUNT; i++) {
+		positions.push_back(camera + _random_vector(state, 1e4));
+		velocities.push_back(_random_vector(state, 20.0));
+	}
+
+	_bench_particles<Vector3f, Vector3f>("particles: float", positions, velocities);
+	_bench_particles<Vector3d, Vector3d>("particles: double", positions, velocities);
+	_bench_particles<Vector3d, Vector3f>("particles: mixed", positions, velocities);
+
+	return benchmark_finish("mixed_precision");
+}
@@ -1,8 +1,10 @@
 #!/usr/bin/env python
 
 import json
+import os
 import re
-import shutil
+from concurrent.futures import ProcessPoolExecutor
+from concurrent.futures.process import BrokenProcessPool
 from pathlib import Path
 
 
@@ -66,20 +68,161 @@ def generate_wrappers(target):
 
     txt += "\n#endif\n"
 
-    with open(target, "w", encoding="utf-8") as f:
-        f.write(txt)
+    write_file_if_changed(target, txt)
 
 
-def get_file_list(api_filepath, output_dir, headers=False, sources=False):
-    api = {}
-    files = []
+# Engine classes used by godot-cpp itself, kept by every build profile.
+build_profile_required_classes = [
+    "Object",
+    "RefCounted",
+    "ClassDB",
+    "FileAccess",
+    "Mutex",
+    "OS",
+    "Semaphore",
+    "WorkerThreadPool",
+    "XMLParser",
+]
+
+
+def _get_referenced_classes(type_name, classes, struct_classes):
+    if type_name.startswith("const "):
+        type_name = type_name[6:]
+    while type_name.endswith("*"):
+        type_name = type_name[:-1]
+    if type_name.startswith("typedarray::"):
+        type_name = type_name.replace("typedarray::", "")
+    if is_enum(type_name):
+        type_name = get_enum_class(type_name)
+    if type_name in struct_classes:
+        return struct_classes[type_name]
+    return {type_name} if type_name in classes else set()
+
+
+def _get_native_struct_classes(native_struct, classes):
+    used = set()
+    expanded_format = native_struct["format"].replace("(", " ").replace(")", ";").replace(",", ";")
+    for field in expanded_format.split(";"):
+        field_type = field.strip().split(" ")[0].split("::")[0]
+        if field_type in classes:
+            used.add(field_type)
+    return used
+
+
+# A build profile is a JSON file with either an "enabled_classes" or a "disabled_classes" array.
+# Enabled classes pull in their parents and every class used in their method signatures, disabled
+# classes take down their children and every class whose methods use them.
+# Returns the set of engine classes to generate, or None to generate them all.
+def parse_build_profile(profile_filepath, api):
+    if not profile_filepath:
+        return None
+
+    with open(profile_filepath, encoding="utf-8") as profile_file:
+        profile = json.load(profile_file)
+
+    classes = {}
+    children = {}
+    for class_api in api["classes"]:
+        classes[class_api["name"]] = class_api
+        if "inherits" in class_api:
+            children.setdefault(class_api["inherits"], []).append(class_api["name"])
+
+    # Native structures aren't filtered, a class using one depends on the classes in its fields.
+    struct_classes = {}
+    for native_struct in api["native_structures"]:
+        struct_classes[native_struct["name"]] = _get_native_struct_classes(native_struct, classes)
+
+    dependencies = {}
+    reverse_dependencies = {}
+    for class_name, class_api in classes.items():
+        used = set()
+        if "inherits" in class_api:
+            used.add(class_api["inherits"])
+        for method in class_api.get("methods", []):
+            types = [argument["type"] for argument in method.get("arguments", [])]
+            if "return_value" in method:
+                types.append(method["return_value"]["type"])
+            for type_name in types:
+                used |= _get_referenced_classes(type_name, classes, struct_classes)
+        used.discard(class_name)
+        dependencies[class_name] = used
+        for used_class in used:
+            reverse_dependencies.setdefault(used_class, set()).add(class_name)
+
+    def closure(roots, edges):
+        found = set()
+        pending = [name for name in roots if name in classes]
+        while pending:
+            name = pending.pop()
+            if name in found:
+                continue
+            found.add(name)
+            pending.extend(edges.get(name, ()))
+        return found
+
+    # ClassDB is generated as ClassDBSingleton, accept both names.
+    def normalize(names):
+        return ["ClassDB" if name == "ClassDBSingleton" else name for name in names]
+
+    for name in normalize(profile.get("enabled_classes", []) + profile.get("disabled_classes", [])):
+        if name not in classes:
+            print("WARNING: Build profile refers to unknown class '" + name + "', ignoring it.")
+
+    required = closure(build_profile_required_classes, dependencies)
+
+    enabled = normalize(profile.get("enabled_classes", []))
+    if enabled:
+        if profile.get("disabled_classes"):
+            print("WARNING: Build profile has both 'enabled_classes' and 'disabled_classes', ignoring the latter.")
+        return required | closure(enabled, dependencies)
+
+    disabled = []
+    for name in normalize(profile.get("disabled_classes", [])):
+        if name in required:
+            print("WARNING: Build profile can't disable '" + name + "', godot-cpp depends on it.")
+        else:
+            disabled.append(name)
+
+    excluded = set()
+    pending = [name for name in disabled if name in classes]
+    while pending:
+        name = pending.pop()
+        if name in excluded:
+            continue
+        excluded.add(name)
+        pending.extend(children.get(name, ()))
+        pending.extend(reverse_dependencies.get(name, ()))
+
+    return set(classes.keys()) - excluded
+
+
+def load_api(api_filepath, profile_filepath=""):
     with open(api_filepath, encoding="utf-8") as api_file:
         api = json.load(api_file)
 
+    included_classes = parse_build_profile(profile_filepath, api)
+    if included_classes is not None:
+        all_classes = {class_api["name"] for class_api in api["classes"]}
+        api["classes"] = [class_api for class_api in api["classes"] if class_api["name"] in included_classes]
+        api["singletons"] = [singleton for singleton in api["singletons"] if singleton["type"] in included_classes]
+        api["native_structures"] = [
+            native_struct
+            for native_struct in api["native_structures"]
+            if _get_native_struct_classes(native_struct, all_classes) <= included_classes
+        ]
+
+    return api
+
+
+def get_file_list(api_filepath, output_dir, headers=False, sources=False, profile_filepath=""):
+    files = []
+    api = load_api(api_filepath, profile_filepath)
+
     core_gen_folder = Path(output_dir) / "gen" / "include" / "godot_cpp" / "core"
     include_gen_folder = Path(output_dir) / "gen" / "include" / "godot_cpp"
     source_gen_folder = Path(output_dir) / "gen" / "src"
 
+    files.append(str((Path(output_dir) / "gen" / "bindings_manifest.json").as_posix()))
     files.append(str((core_gen_folder / "ext_wrappers.gen.inc").as_posix()))
 
     for builtin_class in api["builtin_classes"]:
@@ -90,9 +233,13 @@ def get_file_list(api_filepath, output_dir, headers=False, sources=False):
             continue
 
         header_filename = include_gen_folder / "variant" / (camel_to_snake(builtin_class["name"]) + ".hpp")
+        property_header_filename = (
+            include_gen_folder / "variant" / "properties" / (camel_to_snake(builtin_class["name"]) + ".hpp")
+        )
         source_filename = source_gen_folder / "variant" / (camel_to_snake(builtin_class["name"]) + ".cpp")
         if headers:
             files.append(str(header_filename.as_posix()))
+            files.append(str(property_header_filename.as_posix()))
         if sources:
             files.append(str(source_filename.as_posix()))
 
@@ -102,9 +249,13 @@ def get_file_list(api_filepath, output_dir, headers=False, sources=False):
             engine_class["name"] = "ClassDBSingleton"
             engine_class["alias_for"] = "ClassDB"
         header_filename = include_gen_folder / "classes" / (camel_to_snake(engine_class["name"]) + ".hpp")
+        property_header_filename = (
+            include_gen_folder / "classes" / "properties" / (camel_to_snake(engine_class["name"]) + ".hpp")
+        )
         source_filename = source_gen_folder / "classes" / (camel_to_snake(engine_class["name"]) + ".cpp")
         if headers:
             files.append(str(header_filename.as_posix()))
+            files.append(str(property_header_filename.as_posix()))
         if sources:
             files.append(str(source_filename.as_posix()))
 
@@ -121,6 +272,7 @@ def get_file_list(api_filepath, output_dir, headers=False, sources=False):
     if headers:
         for path in [
             include_gen_folder / "variant" / "builtin_types.hpp",
+            include_gen_folder / "variant" / "builtin_properties.hpp",
             include_gen_folder / "variant" / "builtin_binds.hpp",
             include_gen_folder / "variant" / "utility_functions.hpp",
             include_gen_folder / "variant" / "variant_size.hpp",
@@ -137,13 +289,16 @@ def get_file_list(api_filepath, output_dir, headers=False, sources=False):
     return files
 
 
-def print_file_list(api_filepath, output_dir, headers=False, sources=False):
-    print(*get_file_list(api_filepath, output_dir, headers, sources), sep=";", end=None)
+def print_file_list(api_filepath, output_dir, headers=False, sources=False, profile_filepath=""):
+    print(*get_file_list(api_filepath, output_dir, headers, sources, profile_filepath), sep=";", end=None)
 
 
 def scons_emit_files(target, source, env):
-    files = [env.File(f) for f in get_file_list(str(source[0]), target[0].abspath, True, True)]
+    profile_filepath = env.get("build_profile", "")
+    files = [env.File(f) for f in get_file_list(str(source[0]), target[0].abspath, True, True, profile_filepath)]
     env.Clean(target, files)
+    # Generation only rewrites the files whose content changed, don't let SCons delete them beforehand.
+    env.Precious(files)
     env["godot_cpp_gen_dir"] = target[0].abspath
     return files, source
 
@@ -155,20 +310,79 @@ def scons_generate_bindings(target, source, env):
         "32" if "32" in env["arch"] else "64",
         env["precision"],
         env["godot_cpp_gen_dir"],
+        env.get("build_profile", ""),
     )
     return None
 
 
-def generate_bindings(api_filepath, use_template_get_node, bits="64", precision="single", output_dir="."):
-    api = None
+# Key is the path of a file written by the current generation, value is True if its content changed.
+generated_files = {}
+
+# Number of processes used to generate engine classes, 0 uses all CPUs.
+generator_jobs = 0
+
+
+# Generated files are only rewritten when their content changes, so timestamps and content
+# signatures of the others are preserved and build systems only recompile what changed.
+def write_file_if_changed(path, content):
+    path = Path(path)
+    try:
+        with path.open("r", encoding="utf-8") as existing_file:
+            changed = existing_file.read() != content
+    except (OSError, UnicodeDecodeError):
+        changed = True
+
+    if changed:
+        with path.open("w+", encoding="utf-8") as new_file:
+            new_file.write(content)
+
+    generated_files[str(path.as_posix())] = changed
+
+
+def _run_pool_task(function_and_args):
+    generated_files.clear()
+    function, args = function_and_args
+    function(*args)
+    return dict(generated_files)
+
+
+# Calls `function(*task)` for every task, in worker processes set up by `initializer(*initargs)`.
+# Falls back to the current process when processes can't be spawned.
+def run_in_process_pool(function, tasks, initializer, initargs):
+    jobs = min(generator_jobs or os.cpu_count() or 1, len(tasks))
+    if jobs > 1:
+        try:
+            with ProcessPoolExecutor(jobs, initializer=initializer, initargs=initargs) as executor:
+                chunk_size = max(1, len(tasks) // (jobs * 4))
+                tasks_with_function = [(function, task) for task in tasks]
+                for files in executor.map(_run_pool_task, tasks_with_function, chunksize=chunk_size):
+                    generated_files.update(files)
+            return
+        except (OSError, BrokenProcessPool) as e:
+            print("WARNING: Can't generate bindings in parallel (" + str(e) + "), using a single process.")
+
+    for task in tasks:
+        function(*task)
+
+
+def generate_bindings(
+    api_filepath,
+    use_template_get_node,
+    bits="64",
+    precision="single",
+    output_dir=".",
+    profile_filepath="",
+    jobs=0,
+):
+    global generator_jobs
 
     target_dir = Path(output_dir) / "gen"
 
-    with open(api_filepath, encoding="utf-8") as api_file:
-        api = json.load(api_file)
+    api = load_api(api_filepath, profile_filepath)
 
-    shutil.rmtree(target_dir, ignore_errors=True)
-    target_dir.mkdir(parents=True)
+    target_dir.mkdir(parents=True, exist_ok=True)
+    generated_files.clear()
+    generator_jobs = jobs
 
     real_t = "double" if precision == "double" else "float"
     print("Built-in type config: " + real_t + "_" + bits)
@@ -180,6 +394,27 @@ def generate_bindings(api_filepath, use_template_get_node, bits="64", precision=
     generate_engine_classes_bindings(api, target_dir, use_template_get_node)
     generate_utility_functions(api, target_dir)
 
+    # Remove what previous generations left behind, e.g. classes dropped from the API or the build profile.
+    # Only in the folders the generator owns, the build tools may keep their own outputs next to them.
+    manifest_filename = target_dir / "bindings_manifest.json"
+    for folder in ["include", "src"]:
+        for path in (target_dir / folder).glob("**/*"):
+            if path.is_file() and str(path.as_posix()) not in generated_files:
+                path.unlink()
+
+    # Always rewritten, so it doubles as the stamp of the last generation.
+    # Paths are relative to the manifest.
+    files = {Path(path).relative_to(target_dir).as_posix(): changed for path, changed in generated_files.items()}
+    changed_files = [path for path, changed in files.items() if changed]
+    manifest = {
+        "files": sorted(files.keys()),
+        "changed": sorted(changed_files),
+    }
+    with manifest_filename.open("w+", encoding="utf-8") as manifest_file:
+        json.dump(manifest, manifest_file, indent="\t")
+
+    print(f"Generated {len(generated_files)} files, {len(changed_files)} changed.")
+
 
 builtin_classes = []
 
@@ -201,6 +436,7 @@ def generate_builtin_bindings(api, output_dir, build_config):
 
     core_gen_folder.mkdir(parents=True, exist_ok=True)
     include_gen_folder.mkdir(parents=True, exist_ok=True)
+    (include_gen_folder / "properties").mkdir(parents=True, exist_ok=True)
     source_gen_folder.mkdir(parents=True, exist_ok=True)
 
     generate_wrappers(core_gen_folder / "ext_wrappers.gen.inc")
@@ -221,17 +457,16 @@ def generate_builtin_bindings(api, output_dir, build_config):
 
     # Create a file for Variant size, since that class isn't generated.
     variant_size_filename = include_gen_folder / "variant_size.hpp"
-    with variant_size_filename.open("+w", encoding="utf-8") as variant_size_file:
-        variant_size_source = []
-        add_header("variant_size.hpp", variant_size_source)
+    variant_size_source = []
+    add_header("variant_size.hpp", variant_size_source)
 
-        header_guard = "GODOT_CPP_VARIANT_SIZE_HPP"
-        variant_size_source.append(f"#ifndef {header_guard}")
-        variant_size_source.append(f"#define {header_guard}")
-        variant_size_source.append(f'#define GODOT_CPP_VARIANT_SIZE {builtin_sizes["Variant"]}')
-        variant_size_source.append(f"#endif // ! {header_guard}")
+    header_guard = "GODOT_CPP_VARIANT_SIZE_HPP"
+    variant_size_source.append(f"#ifndef {header_guard}")
+    variant_size_source.append(f"#define {header_guard}")
+    variant_size_source.append(f'#define GODOT_CPP_VARIANT_SIZE {builtin_sizes["Variant"]}')
+    variant_size_source.append(f"#endif // ! {header_guard}")
 
-        variant_size_file.write("\n".join(variant_size_source))
+    write_file_if_changed(variant_size_filename, "\n".join(variant_size_source))
 
     for builtin_api in api["builtin_classes"]:
         if is_pod_type(builtin_api["name"]):
@@ -242,6 +477,7 @@ def generate_builtin_bindings(api, output_dir, build_config):
         size = builtin_sizes[builtin_api["name"]]
 
         header_filename = include_gen_folder / (camel_to_snake(builtin_api["name"]) + ".hpp")
+        property_header_filename = include_gen_folder / "properties" / (camel_to_snake(builtin_api["name"]) + ".hpp")
         source_filename = source_gen_folder / (camel_to_snake(builtin_api["name"]) + ".cpp")
 
         # Check used classes for header include
@@ -297,59 +533,86 @@ def generate_builtin_bindings(api, output_dir, build_config):
         fully_used_classes = list(fully_used_classes)
         fully_used_classes.sort()
 
-        with header_filename.open("w+", encoding="utf-8") as header_file:
-            header_file.write(generate_builtin_class_header(builtin_api, size, used_classes, fully_used_classes))
+        write_file_if_changed(
+            header_filename, generate_builtin_class_header(builtin_api, size, used_classes, fully_used_classes)
+        )
+
+        write_file_if_changed(property_header_filename, generate_builtin_class_property_header(builtin_api))
 
-        with source_filename.open("w+", encoding="utf-8") as source_file:
-            source_file.write(generate_builtin_class_source(builtin_api, size, used_classes, fully_used_classes))
+        write_file_if_changed(
+            source_filename, generate_builtin_class_source(builtin_api, size, used_classes, fully_used_classes)
+        )
 
     # Create a header with all builtin types for convenience.
     builtin_header_filename = include_gen_folder / "builtin_types.hpp"
-    with builtin_header_filename.open("w+", encoding="utf-8") as builtin_header_file:
-        builtin_header = []
-        add_header("builtin_types.hpp", builtin_header)
+    builtin_header = []
+    add_header("builtin_types.hpp", builtin_header)
+
+    builtin_header.append("#ifndef GODOT_CPP_BUILTIN_TYPES_HPP")
+    builtin_header.append("#define GODOT_CPP_BUILTIN_TYPES_HPP")
+
+    builtin_header.append("")
+
+    for builtin in builtin_classes:
+        builtin_header.append(f"#include <godot_cpp/variant/{camel_to_snake(builtin)}.hpp>")
 
-        builtin_header.append("#ifndef GODOT_CPP_BUILTIN_TYPES_HPP")
-        builtin_header.append("#define GODOT_CPP_BUILTIN_TYPES_HPP")
+    builtin_header.append("")
 
-        builtin_header.append("")
+    builtin_header.append("#endif // ! GODOT_CPP_BUILTIN_TYPES_HPP")
 
-        for builtin in builtin_classes:
-            builtin_header.append(f"#include <godot_cpp/variant/{camel_to_snake(builtin)}.hpp>")
+    write_file_if_changed(builtin_header_filename, "\n".join(builtin_header))
+
+    # Create a header with the property wrappers of all builtin types, the ones we implement included.
+    builtin_properties_filename = include_gen_folder / "builtin_properties.hpp"
+    builtin_properties = []
+    add_header("builtin_properties.hpp", builtin_properties)
+
+    builtin_properties.append("#ifndef GODOT_CPP_BUILTIN_PROPERTIES_HPP")
+    builtin_properties.append("#define GODOT_CPP_BUILTIN_PROPERTIES_HPP")
+
+    builtin_properties.append("")
+
+    for builtin_api in api["builtin_classes"]:
+        if is_pod_type(builtin_api["name"]):
+            continue
+        builtin_properties.append(f"#include <godot_cpp/variant/properties/{camel_to_snake(builtin_api['name'])}.hpp>")
+    builtin_properties.append("#include <godot_cpp/variant/properties/typed_array.hpp>")
+    builtin_properties.append("#include <godot_cpp/variant/properties/variant.hpp>")
+    builtin_properties.append("#include <godot_cpp/classes/properties/ref.hpp>")
 
-        builtin_header.append("")
+    builtin_properties.append("")
 
-        builtin_header.append("#endif // ! GODOT_CPP_BUILTIN_TYPES_HPP")
+    builtin_properties.append("#endif // ! GODOT_CPP_BUILTIN_PROPERTIES_HPP")
 
-        builtin_header_file.write("\n".join(builtin_header))
+    write_file_if_changed(builtin_properties_filename, "\n".join(builtin_properties))
 
     # Create a header with bindings for builtin types.
     builtin_binds_filename = include_gen_folder / "builtin_binds.hpp"
-    with builtin_binds_filename.open("w+", encoding="utf-8") as builtin_binds_file:
-        builtin_binds = []
-        add_header("builtin_binds.hpp", builtin_binds)
+    builtin_binds = []
+    add_header("builtin_binds.hpp", builtin_binds)
 
-        builtin_binds.append("#ifndef GODOT_CPP_BUILTIN_BINDS_HPP")
-        builtin_binds.append("#define GODOT_CPP_BUILTIN_BINDS_HPP")
-        builtin_binds.append("")
-        builtin_binds.append("#include <godot_cpp/variant/builtin_types.hpp>")
-        builtin_binds.append("")
+    builtin_binds.append("#ifndef GODOT_CPP_BUILTIN_BINDS_HPP")
+    builtin_binds.append("#define GODOT_CPP_BUILTIN_BINDS_HPP")
+    builtin_binds.append("")
+    builtin_binds.append("#include <godot_cpp/variant/builtin_types.hpp>")
+    builtin_binds.append("")
 
-        for builtin_api in api["builtin_classes"]:
-            if is_included_type(builtin_api["name"]):
-                if "enums" in builtin_api:
-                    for enum_api in builtin_api["enums"]:
-                        builtin_binds.append(f"VARIANT_ENUM_CAST({builtin_api['name']}::{enum_api['name']});")
+    for builtin_api in api["builtin_classes"]:
+        if is_included_type(builtin_api["name"]):
+            if "enums" in builtin_api:
+                for enum_api in builtin_api["enums"]:
+                    builtin_binds.append(f"VARIANT_ENUM_CAST({builtin_api['name']}::{enum_api['name']});")
 
-        builtin_binds.append("")
-        builtin_binds.append("#endif // ! GODOT_CPP_BUILTIN_BINDS_HPP")
+    builtin_binds.append("")
+    builtin_binds.append("#endif // ! GODOT_CPP_BUILTIN_BINDS_HPP")
 
-        builtin_binds_file.write("\n".join(builtin_binds))
+    write_file_if_changed(builtin_binds_filename, "\n".join(builtin_binds))
 
     # Create a header to implement all builtin class vararg methods and be included in "variant.hpp".
     builtin_vararg_methods_header = include_gen_folder / "builtin_vararg_methods.hpp"
-    builtin_vararg_methods_header.open("w+").write(
-        generate_builtin_class_vararg_method_implements_header(api["builtin_classes"])
+    write_file_if_changed(
+        builtin_vararg_methods_header,
+        generate_builtin_class_vararg_method_implements_header(api["builtin_classes"]),
     )
 
 
@@ -396,7 +659,7 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
 
     result.append("")
     result.append("#include <godot_cpp/core/defs.hpp>")
-    result.append("#include <godot_cpp/classes/property_wrappers.hpp>")
+    result.append("#include <godot_cpp/classes/properties_fwd.hpp>")
     result.append("")
 
     # Special cases.
@@ -594,6 +857,8 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
         result.append("\tstatic String utf16(const char16_t *from, int len = -1);")
         result.append("\tvoid parse_utf16(const char16_t *from, int len = -1);")
         result.append("\tCharString utf8() const;")
+        result.append("\tvoid utf8_into(CharString &r_reuse) const;")
+        result.append("\tint to_utf8(char *r_buffer, int p_capacity) const;")
         result.append("\tCharString ascii() const;")
         result.append("\tChar16String utf16() const;")
         result.append("\tChar32String utf32() const;")
@@ -775,10 +1040,43 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
         result.append("String rtos(double p_val);")
         result.append("String rtoss(double p_val);")
 
+    result.extend(
+        generate_property_declaration(class_name, f"godot_cpp/variant/properties/{snake_class_name.lower()}.hpp")
+    )
+
+    result.append("")
+    result.append("} // namespace godot")
+
+    result.append(f"#endif // ! {header_guard}")
+
+    return "\n".join(result)
+
+
+def generate_builtin_class_property_header(builtin_api):
+    result = []
+
+    class_name = builtin_api["name"]
+    snake_class_name = camel_to_snake(class_name).upper()
+
+    header_guard = f"GODOT_CPP_PROPERTIES_{snake_class_name}_HPP"
+
+    add_header(f"{snake_class_name.lower()}.hpp", result)
+
+    result.append(f"#ifndef {header_guard}")
+    result.append(f"#define {header_guard}")
+
+    result.append("")
+    result.append("#include <godot_cpp/classes/property_wrappers.hpp>")
+    result.append(f"#include <godot_cpp/variant/{snake_class_name.lower()}.hpp>")
+    result.append("")
+
+    result.append("namespace godot {")
+
     result.extend(generate_property_version(builtin_api))
 
     result.append("")
     result.append("} // namespace godot")
+    result.append("")
 
     result.append(f"#endif // ! {header_guard}")
 
@@ -1082,6 +1380,7 @@ def generate_engine_classes_bindings(api, output_dir, use_template_get_node):
     source_gen_folder = Path(output_dir) / "src" / "classes"
 
     include_gen_folder.mkdir(parents=True, exist_ok=True)
+    (include_gen_folder / "properties").mkdir(parents=True, exist_ok=True)
     source_gen_folder.mkdir(parents=True, exist_ok=True)
 
     # First create map of classes and singletons.
@@ -1104,120 +1403,13 @@ def generate_engine_classes_bindings(api, output_dir, use_template_get_node):
             singleton["alias_for"] = "ClassDB"
         singletons.append(singleton["name"])
 
-    for class_api in api["classes"]:
-        # Check used classes for header include.
-        used_classes = set()
-        fully_used_classes = set()
-
-        class_name = class_api["name"]
-
-        header_filename = include_gen_folder / (camel_to_snake(class_api["name"]) + ".hpp")
-        source_filename = source_gen_folder / (camel_to_snake(class_api["name"]) + ".cpp")
-
-        if "methods" in class_api:
-            for method in class_api["methods"]:
-                if "arguments" in method:
-                    for argument in method["arguments"]:
-                        type_name = argument["type"]
-                        if type_name.startswith("const "):
-                            type_name = type_name[6:]
-                        if type_name.endswith("*"):
-                            type_name = type_name[:-1]
-                        if is_included(type_name, class_name):
-                            if type_name.startswith("typedarray::"):
-                                fully_used_classes.add("TypedArray")
-                                array_type_name = type_name.replace("typedarray::", "")
-                                if array_type_name.startswith("const "):
-                                    array_type_name = array_type_name[6:]
-                                if array_type_name.endswith("*"):
-                                    array_type_name = array_type_name[:-1]
-                                if is_included(array_type_name, class_name):
-                                    if is_enum(array_type_name):
-                                        fully_used_classes.add(get_enum_class(array_type_name))
-                                    elif "default_value" in argument:
-                                        fully_used_classes.add(array_type_name)
-                                    else:
-                                        used_classes.add(array_type_name)
-                            elif is_enum(type_name):
-                                fully_used_classes.add(get_enum_class(type_name))
-                            elif "default_value" in argument:
-                                fully_used_classes.add(type_name)
-                            else:
-                                used_classes.add(type_name)
-                            if is_refcounted(type_name):
-                                fully_used_classes.add("Ref")
-                if "return_value" in method:
-                    type_name = method["return_value"]["type"]
-                    if type_name.startswith("const "):
-                        type_name = type_name[6:]
-                    if type_name.endswith("*"):
-                        type_name = type_name[:-1]
-                    if is_included(type_name, class_name):
-                        if type_name.startswith("typedarray::"):
-                            fully_used_classes.add("TypedArray")
-                            array_type_name = type_name.replace("typedarray::", "")
-                            if array_type_name.startswith("const "):
-                                array_type_name = array_type_name[6:]
-                            if array_type_name.endswith("*"):
-                                array_type_name = array_type_name[:-1]
-                            if is_included(array_type_name, class_name):
-                                if is_enum(array_type_name):
-                                    fully_used_classes.add(get_enum_class(array_type_name))
-                                elif is_variant(array_type_name):
-                                    fully_used_classes.add(array_type_name)
-                                else:
-                                    used_classes.add(array_type_name)
-                        elif is_enum(type_name):
-                            fully_used_classes.add(get_enum_class(type_name))
-                        elif is_variant(type_name):
-                            fully_used_classes.add(type_name)
-                        else:
-                            used_classes.add(type_name)
-                        if is_refcounted(type_name):
-                            fully_used_classes.add("Ref")
-
-        if "members" in class_api:
-            for member in class_api["members"]:
-                if is_included(member["type"], class_name):
-                    if is_enum(member["type"]):
-                        fully_used_classes.add(get_enum_class(member["type"]))
-                    else:
-                        used_classes.add(member["type"])
-                    if is_refcounted(member["type"]):
-                        fully_used_classes.add("Ref")
-
-        if "inherits" in class_api:
-            if is_included(class_api["inherits"], class_name):
-                fully_used_classes.add(class_api["inherits"])
-            if is_refcounted(class_api["name"]):
-                fully_used_classes.add("Ref")
-        else:
-            fully_used_classes.add("Wrapped")
-
-        # In order to ensure that PtrToArg specializations for native structs are
-        # always used, let's move any of them into 'fully_used_classes'.
-        for type_name in used_classes:
-            if is_struct_type(type_name) and not is_included_struct_type(type_name):
-                fully_used_classes.add(type_name)
-
-        for type_name in fully_used_classes:
-            if type_name in used_classes:
-                used_classes.remove(type_name)
-
-        used_classes = list(used_classes)
-        used_classes.sort()
-        fully_used_classes = list(fully_used_classes)
-        fully_used_classes.sort()
-
-        with header_filename.open("w+", encoding="utf-8") as header_file:
-            header_file.write(
-                generate_engine_class_header(class_api, used_classes, fully_used_classes, use_template_get_node)
-            )
-
-        with source_filename.open("w+", encoding="utf-8") as source_file:
-            source_file.write(
-                generate_engine_class_source(class_api, used_classes, fully_used_classes, use_template_get_node)
-            )
+    # Classes are independent from each other once the maps above are filled, so split them across processes.
+    run_in_process_pool(
+        _generate_engine_class_files,
+        [(class_api, include_gen_folder, source_gen_folder, use_template_get_node) for class_api in api["classes"]],
+        _init_engine_class_worker,
+        (engine_classes, singletons, native_structures, builtin_classes),
+    )
 
     for native_struct in api["native_structures"]:
         struct_name = native_struct["name"]
@@ -1267,8 +1459,139 @@ def generate_engine_classes_bindings(api, output_dir, use_template_get_node):
         result.append("")
         result.append(f"#endif // ! {header_guard}")
 
-        with header_filename.open("w+", encoding="utf-8") as header_file:
-            header_file.write("\n".join(result))
+        write_file_if_changed(header_filename, "\n".join(result))
+
+
+def _init_engine_class_worker(
+    worker_engine_classes, worker_singletons, worker_native_structures, worker_builtin_classes
+):
+    global engine_classes
+    global singletons
+    global native_structures
+    global builtin_classes
+
+    engine_classes = worker_engine_classes
+    singletons = worker_singletons
+    native_structures = worker_native_structures
+    builtin_classes = worker_builtin_classes
+
+
+def _generate_engine_class_files(class_api, include_gen_folder, source_gen_folder, use_template_get_node):
+    # Check used classes for header include.
+    used_classes = set()
+    fully_used_classes = set()
+
+    class_name = class_api["name"]
+
+    header_filename = include_gen_folder / (camel_to_snake(class_api["name"]) + ".hpp")
+    property_header_filename = include_gen_folder / "properties" / (camel_to_snake(class_api["name"]) + ".hpp")
+    source_filename = source_gen_folder / (camel_to_snake(class_api["name"]) + ".cpp")
+
+    if "methods" in class_api:
+        for method in class_api["methods"]:
+            if "arguments" in method:
+                for argument in method["arguments"]:
+                    type_name = argument["type"]
+                    if type_name.startswith("const "):
+                        type_name = type_name[6:]
+                    if type_name.endswith("*"):
+                        type_name = type_name[:-1]
+                    if is_included(type_name, class_name):
+                        if type_name.startswith("typedarray::"):
+                            fully_used_classes.add("TypedArray")
+                            array_type_name = type_name.replace("typedarray::", "")
+                            if array_type_name.startswith("const "):
+                                array_type_name = array_type_name[6:]
+                            if array_type_name.endswith("*"):
+                                array_type_name = array_type_name[:-1]
+                            if is_included(array_type_name, class_name):
+                                if is_enum(array_type_name):
+                                    fully_used_classes.add(get_enum_class(array_type_name))
+                                elif "default_value" in argument:
+                                    fully_used_classes.add(array_type_name)
+                                else:
+                                    used_classes.add(array_type_name)
+                        elif is_enum(type_name):
+                            fully_used_classes.add(get_enum_class(type_name))
+                        elif "default_value" in argument:
+                            fully_used_classes.add(type_name)
+                        else:
+                            used_classes.add(type_name)
+                        if is_refcounted(type_name):
+                            fully_used_classes.add("Ref")
+            if "return_value" in method:
+                type_name = method["return_value"]["type"]
+                if type_name.startswith("const "):
+                    type_name = type_name[6:]
+                if type_name.endswith("*"):
+                    type_name = type_name[:-1]
+                if is_included(type_name, class_name):
+                    if type_name.startswith("typedarray::"):
+                        fully_used_classes.add("TypedArray")
+                        array_type_name = type_name.replace("typedarray::", "")
+                        if array_type_name.startswith("const "):
+                            array_type_name = array_type_name[6:]
+                        if array_type_name.endswith("*"):
+                            array_type_name = array_type_name[:-1]
+                        if is_included(array_type_name, class_name):
+                            if is_enum(array_type_name):
+                                fully_used_classes.add(get_enum_class(array_type_name))
+                            elif is_variant(array_type_name):
+                                fully_used_classes.add(array_type_name)
+                            else:
+                                used_classes.add(array_type_name)
+                    elif is_enum(type_name):
+                        fully_used_classes.add(get_enum_class(type_name))
+                    elif is_variant(type_name):
+                        fully_used_classes.add(type_name)
+                    else:
+                        used_classes.add(type_name)
+                    if is_refcounted(type_name):
+                        fully_used_classes.add("Ref")
+
+    if "members" in class_api:
+        for member in class_api["members"]:
+            if is_included(member["type"], class_name):
+                if is_enum(member["type"]):
+                    fully_used_classes.add(get_enum_class(member["type"]))
+                else:
+                    used_classes.add(member["type"])
+                if is_refcounted(member["type"]):
+                    fully_used_classes.add("Ref")
+
+    if "inherits" in class_api:
+        if is_included(class_api["inherits"], class_name):
+            fully_used_classes.add(class_api["inherits"])
+        if is_refcounted(class_api["name"]):
+            fully_used_classes.add("Ref")
+    else:
+        fully_used_classes.add("Wrapped")
+
+    # In order to ensure that PtrToArg specializations for native structs are
+    # always used, let's move any of them into 'fully_used_classes'.
+    for type_name in used_classes:
+        if is_struct_type(type_name) and not is_included_struct_type(type_name):
+            fully_used_classes.add(type_name)
+
+    for type_name in fully_used_classes:
+        if type_name in used_classes:
+            used_classes.remove(type_name)
+
+    used_classes = list(used_classes)
+    used_classes.sort()
+    fully_used_classes = list(fully_used_classes)
+    fully_used_classes.sort()
+
+    write_file_if_changed(
+        header_filename,
+        generate_engine_class_header(class_api, used_classes, fully_used_classes, use_template_get_node),
+    )
+    write_file_if_changed(property_header_filename, generate_engine_class_property_header(class_api))
+    write_file_if_changed(
+        source_filename,
+        generate_engine_class_source(class_api, used_classes, fully_used_classes, use_template_get_node),
+    )
+
 
 property_helper_definitions = ""
 
@@ -1299,8 +1622,8 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
     if class_name == "EditorPlugin":
         result.append("#include <godot_cpp/classes/editor_plugin_registration.hpp>")
 
-    if len(fully_used_classes) > 0:
-        result.append("")
+    result.append("#include <godot_cpp/classes/properties_fwd.hpp>")
+    result.append("")
 
     if class_name != "Object" and class_name != "ClassDBSingleton":
         result.append("#include <godot_cpp/core/class_db.hpp>")
@@ -1438,7 +1761,9 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
                 result.append("public:")
                 # continue
             
-            result.append(f"\tProperty<{prop_type}, {getter}, {setter}> {name}() {{ return this; }}")
+            # A template, so the Property<> is only instantiated when the accessor is used.
+            result.append(f"\ttemplate <typename P = Property<{prop_type}, {getter}, {setter}>>")
+            result.append(f"\tP {name}() {{ return this; }}")
             # print(f"{class_name} has {prop}!")
 
     result.append("protected:")
@@ -1514,7 +1839,9 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
     result.append("};")
     result.append("")
 
-    result.extend(generate_property_version(class_api, listed_methods))
+    result.extend(
+        generate_property_declaration(class_name, f"godot_cpp/classes/properties/{snake_class_name.lower()}.hpp")
+    )
 
     result.append("")
     result.append("} // namespace godot")
@@ -1578,6 +1905,41 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
     return "\n".join(result)
 
 
+def generate_engine_class_property_header(class_api):
+    result = []
+
+    class_name = class_api["name"]
+    snake_class_name = camel_to_snake(class_name).upper()
+
+    header_guard = f"GODOT_CPP_PROPERTIES_{snake_class_name}_HPP"
+
+    add_header(f"{snake_class_name.lower()}.hpp", result)
+
+    result.append(f"#ifndef {header_guard}")
+    result.append(f"#define {header_guard}")
+
+    result.append("")
+    result.append("#include <godot_cpp/classes/property_wrappers.hpp>")
+    if "inherits" in class_api:
+        result.append(f"#include <godot_cpp/classes/properties/{camel_to_snake(class_api['inherits'])}.hpp>")
+    result.append(f"#include <godot_cpp/classes/{snake_class_name.lower()}.hpp>")
+    result.append("#include <godot_cpp/variant/builtin_properties.hpp>")
+    result.append("")
+
+    result.append("namespace godot {")
+
+    listed_methods = [method["name"] for method in class_api.get("methods", [])]
+    result.extend(generate_property_version(class_api, listed_methods))
+
+    result.append("")
+    result.append("} // namespace godot")
+    result.append("")
+
+    result.append(f"#endif // ! {header_guard}")
+
+    return "\n".join(result)
+
+
 def generate_engine_class_source(class_api, used_classes, fully_used_classes, use_template_get_node):
     global singletons
     global property_helper_definitions
@@ -1792,8 +2154,7 @@ def generate_global_constants(api, output_dir):
     header.append("")
     header.append(f"#endif // ! {header_guard}")
 
-    with header_filename.open("w+", encoding="utf-8") as header_file:
-        header_file.write("\n".join(header))
+    write_file_if_changed(header_filename, "\n".join(header))
 
 
 def generate_version_header(api, output_dir):
@@ -1821,8 +2182,7 @@ def generate_version_header(api, output_dir):
     header.append(f"#endif // {header_guard}")
     header.append("")
 
-    with header_file_path.open("w+", encoding="utf-8") as header_file:
-        header_file.write("\n".join(header))
+    write_file_if_changed(header_file_path, "\n".join(header))
 
 
 def generate_global_constant_binds(api, output_dir):
@@ -1862,8 +2222,7 @@ def generate_global_constant_binds(api, output_dir):
 
     header.append(f"#endif // ! {header_guard}")
 
-    with header_filename.open("w+", encoding="utf-8") as header_file:
-        header_file.write("\n".join(header))
+    write_file_if_changed(header_filename, "\n".join(header))
 
 
 def generate_utility_functions(api, output_dir):
@@ -1933,9 +2292,7 @@ def generate_utility_functions(api, output_dir):
     header.append("")
     header.append(f"#endif // ! {header_guard}")
 
-    with header_filename.open("w+", encoding="utf-8") as header_file:
-        header_file.write("\n".join(header))
-
+    write_file_if_changed(header_filename, "\n".join(header))
 
     # Generate source.
 
@@ -2011,19 +2368,29 @@ def generate_utility_functions(api, output_dir):
 
     source.append("} // namespace godot")
 
-    with source_filename.open("w+", encoding="utf-8") as source_file:
-        source_file.write("\n".join(source))
+    write_file_if_changed(source_filename, "\n".join(source))
+
+
+def generate_property_declaration(class_name, property_header):
+    # The specialization is generated in its own header, declaring it here turns a use without that
+    # header into an error instead of an instantiation of the generic Property<>.
+    result = []
+    result.append("")
+    result.append(f"// Defined in <{property_header}>.")
+    result.append("template <auto Getter, auto Setter>")
+    result.append(f"class Property<{class_name}, Getter, Setter>;")
+    return result
 
 
 def generate_property_version(api, listed_methods=None):
     result = []
-    for i in range(0, 3): result.append("")
+    result.append("")
 
     class_name = api["name"]
     snake_class_name = camel_to_snake(class_name).upper()
 
     if "inherits" in api:
-        result.append("template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)")
+        result.append("template <auto Getter, auto Setter>")
         result.append(f"class Property<{class_name}, Getter, Setter> : public Property<{api['inherits']}, Getter, Setter>, public PropertyOperations<Property<{class_name}, Getter, Setter>> {{")
         result.append(f"\tusing T = {class_name};")
         result.append(f"\tusing Self = Property<{class_name}, Getter, Setter>;")
@@ -2031,7 +2398,7 @@ def generate_property_version(api, listed_methods=None):
         result.append("\tPROPERTY_CORE(Getter, Setter)")
         result.append("")
     else:
-        result.append("template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)")
+        result.append("template <auto Getter, auto Setter>")
         result.append(f"class Property<{class_name}, Getter, Setter> : public PropertyOperations<Property<{class_name}, Getter, Setter>> {{")
         result.append(f"\tusing T = {class_name};")
         result.append(f"\tusing Self = Property<{class_name}, Getter, Setter>;")
@@ -0,0 +1,62 @@
+/**************************************************************************/
+/*  gdextension_profiler.hpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_GDEXTENSION_PROFILER_HPP
+#define GODOT_GDEXTENSION_PROFILER_HPP
+
+#include <godot_cpp/classes/global_constants.hpp>
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+namespace godot {
+
+// Exposes MethodProfiler to scripts, e.g. `GDExtensionProfiler.save_csv("user://calls.csv")`.
+// Registered automatically at the scene level when the library is built with
+// the method profiler; since class names are global, only one extension
+// loaded in the editor or game can enable it at a time.
+class GDExtensionProfiler : public Object {
+	GDCLASS(GDExtensionProfiler, Object);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static bool is_enabled();
+	static void reset();
+	static TypedArray<Dictionary> get_report();
+	static String get_csv();
+	static String get_json();
+	static Error save_csv(const String &p_path);
+	static Error save_json(const String &p_path);
+};
+
+} // namespace godot
+
+#endif // GODOT_GDEXTENSION_PROFILER_HPP
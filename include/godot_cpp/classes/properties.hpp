@@ -1,7 +1,8 @@
 #ifndef GODOT_PROPERTIES_HPP
 #define GODOT_PROPERTIES_HPP
 
-#include <concepts>
+#include <godot_cpp/classes/properties_fwd.hpp>
+
 #include <type_traits>
 #include <utility>
 
@@ -56,17 +57,19 @@ namespace detail {
 	struct IsMethodConst<F> { static constexpr bool value = true; };
 } // detail
 
+// Checked on every use of a wrapped member, so they only look at the flags set by PROPERTY_CORE
+// instead of resolving calls to the constrained get() and set().
 template<typename T>
-concept getable = requires(T t) { t.get(); };
+concept getable = bool(T::hasGetter);
 
 template<typename T>
-concept setable = requires(T t, T::value_type v) { t.set(v); };
+concept setable = bool(T::hasSetter);
 
 template<typename T>
 concept getsetable = getable<T> && setable<T>;
 
 template<typename F, typename... Args>
-concept returns_void = std::invocable<F> && requires (F f, Args... args) { { f(args...) } -> std::same_as<void>; };
+concept returns_void = requires (F f, Args... args) { requires std::is_void_v<decltype(f(args...))>; };
 
 template<typename Derived>
 struct PropertyOperations {
@@ -82,7 +85,7 @@ struct PropertyOperations {
 
     template<typename Other>
 	requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t += o; }))
-	Derived& operator+=(Other o) { auto temp = underlying().get(); underlying().set(temp += o); return underlying(); }
+	Derived& operator+=(Other o) { auto temp = underlying().get(); temp += o; underlying().set(temp); return underlying(); }
 
 	Derived& operator++() requires (getsetable<Derived> && requires (Derived::value_type t) { ++t; })
         { auto temp = underlying().get(); underlying().set(++temp); return underlying(); }
@@ -96,7 +99,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t *= o; }))
-	Derived& operator*=(Other o) { auto temp = underlying().get(); underlying().set(temp *= o); return underlying(); }
+	Derived& operator*=(Other o) { auto temp = underlying().get(); temp *= o; underlying().set(temp); return underlying(); }
 
 	template<typename Other>
 	requires (getable<Derived> && (requires (Derived::value_type t, Other o) { t / o; }))
@@ -104,7 +107,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t /= o; }))
-	Derived& operator/=(Other o) { auto temp = underlying().get(); underlying().set(temp /= o); return underlying(); }
+	Derived& operator/=(Other o) { auto temp = underlying().get(); temp /= o; underlying().set(temp); return underlying(); }
 
 	template<typename Other>
 	requires (getable<Derived> && (requires (Derived::value_type t, Other o) { t - o; }))
@@ -115,7 +118,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t -= o; }))
-	Derived& operator-=(Other o) { auto temp = underlying().get(); underlying().set(temp -= o); return underlying(); }
+	Derived& operator-=(Other o) { auto temp = underlying().get(); temp -= o; underlying().set(temp); return underlying(); }
 
     Derived& operator--() requires (getsetable<Derived> && (requires (Derived::value_type t) { --t; }))
         { auto temp = underlying().get(); underlying().set(--temp); return underlying(); }
@@ -129,7 +132,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t %= o; }))
-	Derived& operator%=(Other o) { auto temp = underlying().get(); underlying().set(temp %= o); return underlying(); }
+	Derived& operator%=(Other o) { auto temp = underlying().get(); temp %= o; underlying().set(temp); return underlying(); }
 
     // Bitwise operations
     template<typename Other>
@@ -138,7 +141,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t ^= o; }))
-	Derived& operator^=(Other o) { auto temp = underlying().get(); underlying().set(temp ^= o); return underlying(); }
+	Derived& operator^=(Other o) { auto temp = underlying().get(); temp ^= o; underlying().set(temp); return underlying(); }
 
     template<typename Other>
 	requires (getable<Derived> && (requires (Derived::value_type t, Other o) { t & o; }))
@@ -146,7 +149,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t &= o; }))
-	Derived& operator&=(Other o) { auto temp = underlying().get(); underlying().set(temp &= o); return underlying(); }
+	Derived& operator&=(Other o) { auto temp = underlying().get(); temp &= o; underlying().set(temp); return underlying(); }
 
     template<typename Other>
 	requires (getable<Derived> && (requires (Derived::value_type t, Other o) { t | o; }))
@@ -154,7 +157,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t |= o; }))
-	Derived& operator|=(Other o) { auto temp = underlying().get(); underlying().set(temp |= o); return underlying(); }
+	Derived& operator|=(Other o) { auto temp = underlying().get(); temp |= o; underlying().set(temp); return underlying(); }
 
 	auto operator~() requires (getable<Derived> && requires (Derived::value_type t) { ~t; })
         { return ~underlying().get(); }
@@ -169,7 +172,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t <<= o; }))
-	Derived& operator<<=(Other o) { auto temp = underlying().get(); underlying().set(temp <<= o); return underlying(); }
+	Derived& operator<<=(Other o) { auto temp = underlying().get(); temp <<= o; underlying().set(temp); return underlying(); }
 
     template<typename Other>
 	requires (getable<Derived> && (requires (Derived::value_type t, Other o) { t >> o; }))
@@ -177,7 +180,7 @@ struct PropertyOperations {
 
     template<typename Other>
     requires (getsetable<Derived> && (requires (Derived::value_type t, Other o) { t >>= o; }))
-	Derived& operator>>=(Other o) { auto temp = underlying().get(); underlying().set(temp >>= o); return underlying(); }
+	Derived& operator>>=(Other o) { auto temp = underlying().get(); temp >>= o; underlying().set(temp); return underlying(); }
 
 	// Relational operations
 	template<typename Other>
@@ -231,6 +234,8 @@ struct PropertyOperations {
 	static constexpr bool hasSetter = !std::is_same_v<decltype(Setter), std::nullptr_t>;\
 	static constexpr bool setterReturns = !std::is_same_v<typename godot::detail::ReturnType<Setter>::type, void>;\
 	static_assert(hasGetter || hasSetter, "Properties must have at least a getter or a setter!");\
+	static_assert(!hasGetter || godot::detail::IsMemberFunction<Getter>::value, "The getter must be a member function or nullptr");\
+	static_assert(!hasSetter || godot::detail::IsMemberFunction<Setter>::value, "The setter must be a member function or nullptr");\
 	static_assert(!hasGetter || std::is_convertible_v<std::remove_cvref_t<std::remove_cvref_t<typename godot::detail::ReturnType<Getter>::type>>, T>, "The getter function must return T");\
 	static_assert(!hasSetter || std::is_convertible_v<std::remove_cvref_t<std::remove_cvref_t<typename godot::detail::FirstArgumentType<Setter>::type>>, T>, "The setter function must take a T as its first argument");\
 	static_assert(!hasGetter || !hasSetter || std::is_convertible_v<typename godot::detail::ObjectType<Getter>::type, typename godot::detail::ObjectType<Setter>::type>, "The getter and setter must belong to the same class!");\
@@ -284,11 +289,12 @@ public:\
 
 
 
-#define PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter) requires((detail::IsMemberFunction<Getter>::value || std::is_same_v<decltype(Getter), std::nullptr_t>)\
-	&& (detail::IsMemberFunction<Setter>::value || std::is_same_v<decltype(Setter), std::nullptr_t>)\
-)
+// The getter and setter are checked by static asserts in PROPERTY_CORE. A requires clause here had to be
+// checked against every specialization each time a Property<> was named. Kept so existing
+// specializations still compile.
+#define PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
 
-template <class T, auto Getter, auto Setter = nullptr, bool Assert = true> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
+template <class T, auto Getter, auto Setter, bool Assert>
 struct Property : PropertyOperations<Property<T, Getter, Setter>> {
 	PROPERTY_CORE(Getter, Setter)
 };
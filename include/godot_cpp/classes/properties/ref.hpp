@@ -0,0 +1,64 @@
+/**************************************************************************/
+/*  ref.hpp                                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_REF_HPP
+#define GODOT_PROPERTIES_REF_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/ref.hpp>
+
+namespace godot {
+
+template <class T0, auto Getter, auto Setter>
+class Property<Ref<T0>, Getter, Setter> : public PropertyOperations<Property<Ref<T0>, Getter, Setter>> {
+    using T = Ref<T0>;
+    using Self = Property<Ref<T0>, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(ptr, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(reference_ptr, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_valid, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_null, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(unref, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(instantiate, Self)
+
+	_FORCE_INLINE_ T0 *operator*() const {
+		return ptr();
+	}
+
+	_FORCE_INLINE_ T0 *operator->() const {
+		return ptr();
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_REF_HPP
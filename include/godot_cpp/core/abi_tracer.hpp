@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*  abi_tracer.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_ABI_TRACER_HPP
+#define GODOT_ABI_TRACER_HPP
+
+#include <godot_cpp/classes/global_constants.hpp>
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <gdextension_interface.h>
+
+#include <atomic>
+#include <string_view>
+
+#ifndef GODOT_ABI_TRACER_BUFFER_SIZE
+#define GODOT_ABI_TRACER_BUFFER_SIZE 65536
+#endif
+
+namespace godot {
+
+// Records the calls the extension makes into the engine, for viewing in
+// chrome://tracing or https://ui.perfetto.dev.
+//
+// When the library is built with `abi_tracer=yes` (SCons) or `GODOT_CPP_ABI_TRACER`
+// (CMake), which define GODOT_ABI_TRACER_ENABLED, GDExtensionBinding::init()
+// replaces every `internal::gdextension_interface_*` pointer with a shim that
+// times the call while recording. Engine methods called through
+// `object_method_bind_call` and `object_method_bind_ptrcall` are named after the
+// method, e.g. `Node.get_child`. Calls through the pointers returned by the
+// engine (builtin methods, constructors, utility functions) aren't traced.
+//
+// Each thread writes into its own ring buffer of GODOT_ABI_TRACER_BUFFER_SIZE
+// events without locking, so only the most recent events are kept.
+class ABITracer {
+public:
+	static constexpr bool is_enabled() {
+#ifdef GODOT_ABI_TRACER_ENABLED
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	static void start();
+	static void stop();
+	_FORCE_INLINE_ static bool is_recording() { return recording.load(std::memory_order_relaxed); }
+
+	// Events recorded since the last start(), in the Chrome trace event format.
+	static String get_chrome_trace();
+	static Error save_chrome_trace(const String &p_path);
+
+	// Frees the buffers and forgets the method names. Only safe once the
+	// extension can't call into the engine anymore.
+	static void clear();
+
+	static uint64_t get_ticks_nsec();
+	static void record(const char *p_name, GDExtensionMethodBindPtr p_method_bind, uint64_t p_begin_nsec, uint64_t p_end_nsec);
+	static void register_method_bind(GDExtensionMethodBindPtr p_method_bind, GDExtensionConstStringNamePtr p_class_name, GDExtensionConstStringNamePtr p_method_name, GDExtensionInt p_hash);
+
+	template <class Tag, class F>
+	static F wrap(F p_function);
+
+private:
+	static std::atomic<bool> recording;
+};
+
+namespace internal {
+
+template <class Tag, class F>
+struct ABITraceShim;
+
+// One per interface function. `Tag::get_name()` gives the name it's loaded with.
+template <class Tag, class R, class... Args>
+struct ABITraceShim<Tag, R (*)(Args...)> {
+	static constexpr std::string_view name = Tag::get_name();
+	static constexpr bool is_method_bind_call = name == "object_method_bind_call" || name == "object_method_bind_ptrcall";
+	static constexpr bool is_method_bind_lookup = name == "classdb_get_method_bind";
+
+	static inline R (*function)(Args...) = nullptr;
+
+	_FORCE_INLINE_ static GDExtensionMethodBindPtr get_method_bind() { return nullptr; }
+	template <class T, class... Rest>
+	_FORCE_INLINE_ static GDExtensionMethodBindPtr get_method_bind(T p_first, Rest...) {
+		if constexpr (is_method_bind_call) {
+			return p_first;
+		} else {
+			return nullptr;
+		}
+	}
+
+	static R call(Args... p_args) {
+		if constexpr (is_method_bind_lookup) {
+			// Keeps the names of the engine methods for the calls above, whether recording or not:
+			// the generated bindings only look each method up once.
+			const uint64_t begin = ABITracer::get_ticks_nsec();
+			R method_bind = function(p_args...);
+			if (ABITracer::is_recording()) {
+				ABITracer::record(Tag::get_name(), nullptr, begin, ABITracer::get_ticks_nsec());
+			}
+			ABITracer::register_method_bind(method_bind, p_args...);
+			return method_bind;
+		} else {
+			if (likely(!ABITracer::is_recording())) {
+				return function(p_args...);
+			}
+			struct Scope {
+				GDExtensionMethodBindPtr method_bind;
+				uint64_t begin = ABITracer::get_ticks_nsec();
+				~Scope() { ABITracer::record(Tag::get_name(), method_bind, begin, ABITracer::get_ticks_nsec()); }
+			};
+			Scope scope{ get_method_bind(p_args...) };
+			return function(p_args...);
+		}
+	}
+};
+
+} // namespace internal
+
+template <class Tag, class F>
+F ABITracer::wrap(F p_function) {
+	if (!p_function) {
+		return nullptr;
+	}
+	internal::ABITraceShim<Tag, F>::function = p_function;
+	return &internal::ABITraceShim<Tag, F>::call;
+}
+
+} // namespace godot
+
+#endif // GODOT_ABI_TRACER_HPP
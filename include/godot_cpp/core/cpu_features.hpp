@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*  cpu_features.hpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_CPU_FEATURES_HPP
+#define GODOT_CPU_FEATURES_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GODOT_CPU_X86
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+#define GODOT_CPU_ARM_NEON
+#endif
+
+namespace godot {
+
+// Runtime detection of the instruction sets available on the host CPU.
+//
+// Kernels that benefit from wider vectors are compiled several times in
+// dedicated translation units (files ending in `_sse4_1.cpp`, `_avx2.cpp` or
+// `_avx512.cpp`, built with the matching compiler flags when `simd_dispatch`
+// is enabled) and the best variant is selected once, in GDExtensionBinding::init.
+// The library itself keeps targeting the baseline ISA of the platform.
+class CPUFeatures {
+public:
+	enum Feature : uint32_t {
+		FEATURE_SSE2 = 1 << 0,
+		FEATURE_SSE3 = 1 << 1,
+		FEATURE_SSSE3 = 1 << 2,
+		FEATURE_SSE4_1 = 1 << 3,
+		FEATURE_SSE4_2 = 1 << 4,
+		FEATURE_POPCNT = 1 << 5,
+		FEATURE_AVX = 1 << 6,
+		FEATURE_AVX2 = 1 << 7,
+		FEATURE_FMA = 1 << 8,
+		FEATURE_F16C = 1 << 9,
+		FEATURE_BMI1 = 1 << 10,
+		FEATURE_BMI2 = 1 << 11,
+		FEATURE_AVX512F = 1 << 12,
+		FEATURE_AVX512DQ = 1 << 13,
+		FEATURE_AVX512BW = 1 << 14,
+		FEATURE_AVX512VL = 1 << 15,
+		FEATURE_NEON = 1 << 16,
+	};
+
+	// Tiers kernels are compiled for, ordered from most to least portable.
+	enum SIMDLevel {
+		SIMD_LEVEL_SCALAR,
+		SIMD_LEVEL_SSE4_1, // SSE4.1 (implies SSSE3).
+		SIMD_LEVEL_AVX2, // AVX2 + FMA.
+		SIMD_LEVEL_AVX512, // AVX-512 F/DQ/BW/VL.
+		SIMD_LEVEL_MAX
+	};
+
+private:
+	static uint32_t features;
+	static SIMDLevel simd_level;
+	static bool initialized;
+
+	static void _detect();
+
+public:
+	static void initialize();
+	static _FORCE_INLINE_ bool is_initialized() { return initialized; }
+
+	static _FORCE_INLINE_ uint32_t get_features() { return features; }
+	static _FORCE_INLINE_ bool has_feature(Feature p_feature) { return (features & p_feature) == (uint32_t)p_feature; }
+
+	// Level currently used by dispatched kernels.
+	static _FORCE_INLINE_ SIMDLevel get_simd_level() { return simd_level; }
+	// Highest level supported by the host CPU and OS.
+	static SIMDLevel get_supported_simd_level();
+	// Highest level this build of godot-cpp has kernels for.
+	static SIMDLevel get_compiled_simd_level();
+	// Caps the level used by dispatched kernels, and reselects them. Mostly useful
+	// to compare variants against each other, or to work around a broken CPU/driver.
+	static void set_max_simd_level(SIMDLevel p_level);
+
+	static const char *get_simd_level_name(SIMDLevel p_level);
+};
+
+// Registry of kernel groups which pick their implementation for a given SIMDLevel.
+//
+// A kernel group keeps its function pointers in a table initialized with the
+// scalar variants, so it is usable even before the binding is initialized, and
+// registers a selector with GDCPU_DISPATCH_REGISTER. Selectors run once when
+// CPUFeatures is initialized, and again if the level is changed later on.
+class CPUDispatch {
+public:
+	typedef void (*SelectFunc)(CPUFeatures::SIMDLevel p_level);
+
+	struct Registrar {
+		Registrar(SelectFunc p_func) { CPUDispatch::register_selector(p_func); }
+	};
+
+private:
+	static constexpr int MAX_SELECTORS = 64;
+	static SelectFunc selectors[MAX_SELECTORS];
+	static int selector_count;
+
+public:
+	static void register_selector(SelectFunc p_func);
+	static void select_all(CPUFeatures::SIMDLevel p_level);
+};
+
+#define GDCPU_DISPATCH_REGISTER(m_func) \
+	static ::godot::CPUDispatch::Registrar _gdcpu_dispatch_registrar_##m_func(m_func)
+
+} // namespace godot
+
+#endif // GODOT_CPU_FEATURES_HPP
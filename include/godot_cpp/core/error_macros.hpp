@@ -49,6 +49,18 @@ void _err_print_index_error(const char *p_function, const char *p_file, int p_li
 void _err_print_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const String &p_message, bool p_editor_notify = false, bool p_fatal = false);
 void _err_flush_stdout();
 
+// Counts an error of the call site at p_file and p_line, and returns whether to print it,
+// so the _MSG macros only build their message when it's printed.
+bool _err_rate_check(const char *p_file, int p_line, uint64_t &r_suppressed);
+// Whether the p_count-th error of a call site is printed, and how many were suppressed before it.
+bool _err_rate_limit(uint64_t p_count, uint64_t &r_suppressed);
+// Print unconditionally, after _err_rate_check().
+void _err_print_checked_error(const char *p_function, const char *p_file, int p_line, const char *p_error, const char *p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed);
+void _err_print_checked_error(const char *p_function, const char *p_file, int p_line, const char *p_error, const String &p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed);
+void _err_print_checked_error(const char *p_function, const char *p_file, int p_line, const String &p_error, const char *p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed);
+void _err_print_checked_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const char *p_message, bool p_editor_notify, bool p_fatal, uint64_t p_suppressed);
+void _err_print_checked_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const String &p_message, bool p_editor_notify, bool p_fatal, uint64_t p_suppressed);
+
 } // namespace godot
 
 #ifdef __GNUC__
@@ -69,6 +81,54 @@ void _err_flush_stdout();
 #define GENERATE_TRAP() __builtin_trap()
 #endif
 
+#ifdef GODOT_STRIP_ERROR_MESSAGES
+/**
+ * Don't use _ERR_STR() directly, should only be used by the macros below.
+ * Errors only keep their function, file and line, and messages aren't evaluated.
+ */
+#define _ERR_STR(m_str) ""
+#else
+/**
+ * Don't use _ERR_STR() directly, should only be used by the macros below.
+ */
+#define _ERR_STR(m_str) m_str
+#endif
+
+/**
+ * Errors are rate limited per file and line, so a check failing every frame
+ * doesn't flood the output: the first GODOT_ERROR_RATE_LIMIT_FIRST errors of
+ * each call site are printed, then one in GODOT_ERROR_RATE_LIMIT_EVERY, with the
+ * number of errors suppressed in between. Set the latter to 1 to print all errors.
+ * Both are read when godot-cpp itself is compiled.
+ */
+#ifndef GODOT_ERROR_RATE_LIMIT_FIRST
+#define GODOT_ERROR_RATE_LIMIT_FIRST 16
+#endif
+
+#ifndef GODOT_ERROR_RATE_LIMIT_EVERY
+#define GODOT_ERROR_RATE_LIMIT_EVERY 1000
+#endif
+
+/**
+ * Don't use _ERR_PRINT_MSG() directly, should only be used by the macros below.
+ * The rate limit is checked first, so `m_error` and `m_msg` aren't evaluated
+ * when the error is suppressed.
+ */
+#define _ERR_PRINT_MSG(m_error, m_msg, m_editor_notify, m_is_warning)                                                                        \
+	if (uint64_t _err_suppressed = 0; ::godot::_err_rate_check(__FILE__, __LINE__, _err_suppressed))                                         \
+		::godot::_err_print_checked_error(FUNCTION_STR, __FILE__, __LINE__, m_error, m_msg, m_editor_notify, m_is_warning, _err_suppressed); \
+	else                                                                                                                                     \
+		((void)0)
+
+/**
+ * Don't use _ERR_PRINT_INDEX_MSG() directly, should only be used by the macros below.
+ */
+#define _ERR_PRINT_INDEX_MSG(m_index, m_size, m_msg, m_editor_notify, m_fatal)                                                                                                                         \
+	if (uint64_t _err_suppressed = 0; ::godot::_err_rate_check(__FILE__, __LINE__, _err_suppressed))                                                                                                   \
+		::godot::_err_print_checked_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size)), m_msg, m_editor_notify, m_fatal, _err_suppressed); \
+	else                                                                                                                                                                                               \
+		((void)0)
+
 /**
  * Error macros.
  * WARNING: These macros work in the opposite way to assert().
@@ -97,32 +157,32 @@ void _err_flush_stdout();
  * Ensures an integer index `m_index` is less than `m_size` and greater than or equal to 0.
  * If not, the current function returns.
  */
-#define ERR_FAIL_INDEX(m_index, m_size)                                                                                  \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                              \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size)); \
-		return;                                                                                                          \
-	} else                                                                                                               \
+#define ERR_FAIL_INDEX(m_index, m_size)                                                                                                      \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                                  \
+		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size))); \
+		return;                                                                                                                              \
+	} else                                                                                                                                   \
 		((void)0)
 
 /**
  * Ensures an integer index `m_index` is less than `m_size` and greater than or equal to 0.
  * If not, prints `m_msg` and the current function returns.
  */
-#define ERR_FAIL_INDEX_MSG(m_index, m_size, m_msg)                                                                              \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                     \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg); \
-		return;                                                                                                                 \
-	} else                                                                                                                      \
+#define ERR_FAIL_INDEX_MSG(m_index, m_size, m_msg)                            \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                   \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), false, false); \
+		return;                                                               \
+	} else                                                                    \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_INDEX_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_INDEX_EDMSG(m_index, m_size, m_msg)                                                                                  \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                           \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg, true); \
-		return;                                                                                                                       \
-	} else                                                                                                                            \
+#define ERR_FAIL_INDEX_EDMSG(m_index, m_size, m_msg)                         \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                  \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), true, false); \
+		return;                                                              \
+	} else                                                                   \
 		((void)0)
 
 /**
@@ -132,32 +192,32 @@ void _err_flush_stdout();
  * Ensures an integer index `m_index` is less than `m_size` and greater than or equal to 0.
  * If not, the current function returns `m_retval`.
  */
-#define ERR_FAIL_INDEX_V(m_index, m_size, m_retval)                                                                      \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                              \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size)); \
-		return m_retval;                                                                                                 \
-	} else                                                                                                               \
+#define ERR_FAIL_INDEX_V(m_index, m_size, m_retval)                                                                                          \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                                  \
+		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size))); \
+		return m_retval;                                                                                                                     \
+	} else                                                                                                                                   \
 		((void)0)
 
 /**
  * Ensures an integer index `m_index` is less than `m_size` and greater than or equal to 0.
  * If not, prints `m_msg` and the current function returns `m_retval`.
  */
-#define ERR_FAIL_INDEX_V_MSG(m_index, m_size, m_retval, m_msg)                                                                  \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                     \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg); \
-		return m_retval;                                                                                                        \
-	} else                                                                                                                      \
+#define ERR_FAIL_INDEX_V_MSG(m_index, m_size, m_retval, m_msg)                \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                   \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), false, false); \
+		return m_retval;                                                      \
+	} else                                                                    \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_INDEX_V_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_INDEX_V_EDMSG(m_index, m_size, m_retval, m_msg)                                                                      \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                           \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg, true); \
-		return m_retval;                                                                                                              \
-	} else                                                                                                                            \
+#define ERR_FAIL_INDEX_V_EDMSG(m_index, m_size, m_retval, m_msg)             \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                  \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), true, false); \
+		return m_retval;                                                     \
+	} else                                                                   \
 		((void)0)
 
 /**
@@ -168,12 +228,12 @@ void _err_flush_stdout();
  * Ensures an integer index `m_index` is less than `m_size` and greater than or equal to 0.
  * If not, the application crashes.
  */
-#define CRASH_BAD_INDEX(m_index, m_size)                                                                                                  \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                               \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), "", false, true); \
-		::godot::_err_flush_stdout();                                                                                                     \
-		GENERATE_TRAP();                                                                                                                  \
-	} else                                                                                                                                \
+#define CRASH_BAD_INDEX(m_index, m_size)                                                                                                                      \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                                                   \
+		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size)), "", false, true); \
+		::godot::_err_flush_stdout();                                                                                                                         \
+		GENERATE_TRAP();                                                                                                                                      \
+	} else                                                                                                                                                    \
 		((void)0)
 
 /**
@@ -183,12 +243,12 @@ void _err_flush_stdout();
  * Ensures an integer index `m_index` is less than `m_size` and greater than or equal to 0.
  * If not, prints `m_msg` and the application crashes.
  */
-#define CRASH_BAD_INDEX_MSG(m_index, m_size, m_msg)                                                                                          \
-	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                                                                                  \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg, false, true); \
-		::godot::_err_flush_stdout();                                                                                                        \
-		GENERATE_TRAP();                                                                                                                     \
-	} else                                                                                                                                   \
+#define CRASH_BAD_INDEX_MSG(m_index, m_size, m_msg)                          \
+	if (unlikely((m_index) < 0 || (m_index) >= (m_size))) {                  \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), false, true); \
+		::godot::_err_flush_stdout();                                        \
+		GENERATE_TRAP();                                                     \
+	} else                                                                   \
 		((void)0)
 
 // Unsigned integer index out of bounds error macros.
@@ -200,32 +260,32 @@ void _err_flush_stdout();
  * Ensures an unsigned integer index `m_index` is less than `m_size`.
  * If not, the current function returns.
  */
-#define ERR_FAIL_UNSIGNED_INDEX(m_index, m_size)                                                                         \
-	if (unlikely((m_index) >= (m_size))) {                                                                               \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size)); \
-		return;                                                                                                          \
-	} else                                                                                                               \
+#define ERR_FAIL_UNSIGNED_INDEX(m_index, m_size)                                                                                             \
+	if (unlikely((m_index) >= (m_size))) {                                                                                                   \
+		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size))); \
+		return;                                                                                                                              \
+	} else                                                                                                                                   \
 		((void)0)
 
 /**
  * Ensures an unsigned integer index `m_index` is less than `m_size`.
  * If not, prints `m_msg` and the current function returns.
  */
-#define ERR_FAIL_UNSIGNED_INDEX_MSG(m_index, m_size, m_msg)                                                                     \
-	if (unlikely((m_index) >= (m_size))) {                                                                                      \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg); \
-		return;                                                                                                                 \
-	} else                                                                                                                      \
+#define ERR_FAIL_UNSIGNED_INDEX_MSG(m_index, m_size, m_msg)                   \
+	if (unlikely((m_index) >= (m_size))) {                                    \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), false, false); \
+		return;                                                               \
+	} else                                                                    \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_UNSIGNED_INDEX_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_UNSIGNED_INDEX_EDMSG(m_index, m_size, m_msg)                                                                         \
-	if (unlikely((m_index) >= (m_size))) {                                                                                            \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg, true); \
-		return;                                                                                                                       \
-	} else                                                                                                                            \
+#define ERR_FAIL_UNSIGNED_INDEX_EDMSG(m_index, m_size, m_msg)                \
+	if (unlikely((m_index) >= (m_size))) {                                   \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), true, false); \
+		return;                                                              \
+	} else                                                                   \
 		((void)0)
 
 /**
@@ -235,32 +295,32 @@ void _err_flush_stdout();
  * Ensures an unsigned integer index `m_index` is less than `m_size`.
  * If not, the current function returns `m_retval`.
  */
-#define ERR_FAIL_UNSIGNED_INDEX_V(m_index, m_size, m_retval)                                                             \
-	if (unlikely((m_index) >= (m_size))) {                                                                               \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size)); \
-		return m_retval;                                                                                                 \
-	} else                                                                                                               \
+#define ERR_FAIL_UNSIGNED_INDEX_V(m_index, m_size, m_retval)                                                                                 \
+	if (unlikely((m_index) >= (m_size))) {                                                                                                   \
+		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size))); \
+		return m_retval;                                                                                                                     \
+	} else                                                                                                                                   \
 		((void)0)
 
 /**
  * Ensures an unsigned integer index `m_index` is less than `m_size`.
  * If not, prints `m_msg` and the current function returns `m_retval`.
  */
-#define ERR_FAIL_UNSIGNED_INDEX_V_MSG(m_index, m_size, m_retval, m_msg)                                                         \
-	if (unlikely((m_index) >= (m_size))) {                                                                                      \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg); \
-		return m_retval;                                                                                                        \
-	} else                                                                                                                      \
+#define ERR_FAIL_UNSIGNED_INDEX_V_MSG(m_index, m_size, m_retval, m_msg)       \
+	if (unlikely((m_index) >= (m_size))) {                                    \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), false, false); \
+		return m_retval;                                                      \
+	} else                                                                    \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_UNSIGNED_INDEX_V_EDMSG` but also notifies the editor.
  */
-#define ERR_FAIL_UNSIGNED_INDEX_V_EDMSG(m_index, m_size, m_retval, m_msg)                                                             \
-	if (unlikely((m_index) >= (m_size))) {                                                                                            \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg, true); \
-		return m_retval;                                                                                                              \
-	} else                                                                                                                            \
+#define ERR_FAIL_UNSIGNED_INDEX_V_EDMSG(m_index, m_size, m_retval, m_msg)    \
+	if (unlikely((m_index) >= (m_size))) {                                   \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), true, false); \
+		return m_retval;                                                     \
+	} else                                                                   \
 		((void)0)
 
 /**
@@ -271,12 +331,12 @@ void _err_flush_stdout();
  * Ensures an unsigned integer index `m_index` is less than `m_size`.
  * If not, the application crashes.
  */
-#define CRASH_BAD_UNSIGNED_INDEX(m_index, m_size)                                                                                         \
-	if (unlikely((m_index) >= (m_size))) {                                                                                                \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), "", false, true); \
-		::godot::_err_flush_stdout();                                                                                                     \
-		GENERATE_TRAP();                                                                                                                  \
-	} else                                                                                                                                \
+#define CRASH_BAD_UNSIGNED_INDEX(m_index, m_size)                                                                                                             \
+	if (unlikely((m_index) >= (m_size))) {                                                                                                                    \
+		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _ERR_STR(_STR(m_index)), _ERR_STR(_STR(m_size)), "", false, true); \
+		::godot::_err_flush_stdout();                                                                                                                         \
+		GENERATE_TRAP();                                                                                                                                      \
+	} else                                                                                                                                                    \
 		((void)0)
 
 /**
@@ -286,12 +346,12 @@ void _err_flush_stdout();
  * Ensures an unsigned integer index `m_index` is less than `m_size`.
  * If not, prints `m_msg` and the application crashes.
  */
-#define CRASH_BAD_UNSIGNED_INDEX_MSG(m_index, m_size, m_msg)                                                                                 \
-	if (unlikely((m_index) >= (m_size))) {                                                                                                   \
-		::godot::_err_print_index_error(FUNCTION_STR, __FILE__, __LINE__, m_index, m_size, _STR(m_index), _STR(m_size), m_msg, false, true); \
-		::godot::_err_flush_stdout();                                                                                                        \
-		GENERATE_TRAP();                                                                                                                     \
-	} else                                                                                                                                   \
+#define CRASH_BAD_UNSIGNED_INDEX_MSG(m_index, m_size, m_msg)                 \
+	if (unlikely((m_index) >= (m_size))) {                                   \
+		_ERR_PRINT_INDEX_MSG(m_index, m_size, _ERR_STR(m_msg), false, true); \
+		::godot::_err_flush_stdout();                                        \
+		GENERATE_TRAP();                                                     \
+	} else                                                                   \
 		((void)0)
 
 // Null reference error macros.
@@ -303,32 +363,32 @@ void _err_flush_stdout();
  * Ensures a pointer `m_param` is not null.
  * If it is null, the current function returns.
  */
-#define ERR_FAIL_NULL(m_param)                                                                                   \
-	if (unlikely(m_param == nullptr)) {                                                                          \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Parameter \"" _STR(m_param) "\" is null."); \
-		return;                                                                                                  \
-	} else                                                                                                       \
+#define ERR_FAIL_NULL(m_param)                                                                                             \
+	if (unlikely(m_param == nullptr)) {                                                                                    \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Parameter \"" _STR(m_param) "\" is null.")); \
+		return;                                                                                                            \
+	} else                                                                                                                 \
 		((void)0)
 
 /**
  * Ensures a pointer `m_param` is not null.
  * If it is null, prints `m_msg` and the current function returns.
  */
-#define ERR_FAIL_NULL_MSG(m_param, m_msg)                                                                               \
-	if (unlikely(m_param == nullptr)) {                                                                                 \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Parameter \"" _STR(m_param) "\" is null.", m_msg); \
-		return;                                                                                                         \
-	} else                                                                                                              \
+#define ERR_FAIL_NULL_MSG(m_param, m_msg)                                                                    \
+	if (unlikely(m_param == nullptr)) {                                                                      \
+		_ERR_PRINT_MSG(_ERR_STR("Parameter \"" _STR(m_param) "\" is null."), _ERR_STR(m_msg), false, false); \
+		return;                                                                                              \
+	} else                                                                                                   \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_NULL_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_NULL_EDMSG(m_param, m_msg)                                                                                   \
-	if (unlikely(m_param == nullptr)) {                                                                                       \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Parameter \"" _STR(m_param) "\" is null.", m_msg, true); \
-		return;                                                                                                               \
-	} else                                                                                                                    \
+#define ERR_FAIL_NULL_EDMSG(m_param, m_msg)                                                                 \
+	if (unlikely(m_param == nullptr)) {                                                                     \
+		_ERR_PRINT_MSG(_ERR_STR("Parameter \"" _STR(m_param) "\" is null."), _ERR_STR(m_msg), true, false); \
+		return;                                                                                             \
+	} else                                                                                                  \
 		((void)0)
 
 /**
@@ -338,32 +398,32 @@ void _err_flush_stdout();
  * Ensures a pointer `m_param` is not null.
  * If it is null, the current function returns `m_retval`.
  */
-#define ERR_FAIL_NULL_V(m_param, m_retval)                                                                       \
-	if (unlikely(m_param == nullptr)) {                                                                          \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Parameter \"" _STR(m_param) "\" is null."); \
-		return m_retval;                                                                                         \
-	} else                                                                                                       \
+#define ERR_FAIL_NULL_V(m_param, m_retval)                                                                                 \
+	if (unlikely(m_param == nullptr)) {                                                                                    \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Parameter \"" _STR(m_param) "\" is null.")); \
+		return m_retval;                                                                                                   \
+	} else                                                                                                                 \
 		((void)0)
 
 /**
  * Ensures a pointer `m_param` is not null.
  * If it is null, prints `m_msg` and the current function returns `m_retval`.
  */
-#define ERR_FAIL_NULL_V_MSG(m_param, m_retval, m_msg)                                                                   \
-	if (unlikely(m_param == nullptr)) {                                                                                 \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Parameter \"" _STR(m_param) "\" is null.", m_msg); \
-		return m_retval;                                                                                                \
-	} else                                                                                                              \
+#define ERR_FAIL_NULL_V_MSG(m_param, m_retval, m_msg)                                                        \
+	if (unlikely(m_param == nullptr)) {                                                                      \
+		_ERR_PRINT_MSG(_ERR_STR("Parameter \"" _STR(m_param) "\" is null."), _ERR_STR(m_msg), false, false); \
+		return m_retval;                                                                                     \
+	} else                                                                                                   \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_NULL_V_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_NULL_V_EDMSG(m_param, m_retval, m_msg)                                                                       \
-	if (unlikely(m_param == nullptr)) {                                                                                       \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Parameter \"" _STR(m_param) "\" is null.", m_msg, true); \
-		return m_retval;                                                                                                      \
-	} else                                                                                                                    \
+#define ERR_FAIL_NULL_V_EDMSG(m_param, m_retval, m_msg)                                                     \
+	if (unlikely(m_param == nullptr)) {                                                                     \
+		_ERR_PRINT_MSG(_ERR_STR("Parameter \"" _STR(m_param) "\" is null."), _ERR_STR(m_msg), true, false); \
+		return m_retval;                                                                                    \
+	} else                                                                                                  \
 		((void)0)
 
 /**
@@ -375,11 +435,11 @@ void _err_flush_stdout();
  * Ensures `m_cond` is false.
  * If `m_cond` is true, the current function returns.
  */
-#define ERR_FAIL_COND(m_cond)                                                                                   \
-	if (unlikely(m_cond)) {                                                                                     \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true."); \
-		return;                                                                                                 \
-	} else                                                                                                      \
+#define ERR_FAIL_COND(m_cond)                                                                                             \
+	if (unlikely(m_cond)) {                                                                                               \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Condition \"" _STR(m_cond) "\" is true.")); \
+		return;                                                                                                           \
+	} else                                                                                                                \
 		((void)0)
 
 /**
@@ -389,21 +449,21 @@ void _err_flush_stdout();
  * If checking for null use ERR_FAIL_NULL_MSG instead.
  * If checking index bounds use ERR_FAIL_INDEX_MSG instead.
  */
-#define ERR_FAIL_COND_MSG(m_cond, m_msg)                                                                               \
-	if (unlikely(m_cond)) {                                                                                            \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true.", m_msg); \
-		return;                                                                                                        \
-	} else                                                                                                             \
+#define ERR_FAIL_COND_MSG(m_cond, m_msg)                                                                    \
+	if (unlikely(m_cond)) {                                                                                 \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true."), _ERR_STR(m_msg), false, false); \
+		return;                                                                                             \
+	} else                                                                                                  \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_COND_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_COND_EDMSG(m_cond, m_msg)                                                                                   \
-	if (unlikely(m_cond)) {                                                                                                  \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true.", m_msg, true); \
-		return;                                                                                                              \
-	} else                                                                                                                   \
+#define ERR_FAIL_COND_EDMSG(m_cond, m_msg)                                                                 \
+	if (unlikely(m_cond)) {                                                                                \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true."), _ERR_STR(m_msg), true, false); \
+		return;                                                                                            \
+	} else                                                                                                 \
 		((void)0)
 
 /**
@@ -415,11 +475,11 @@ void _err_flush_stdout();
  * Ensures `m_cond` is false.
  * If `m_cond` is true, the current function returns `m_retval`.
  */
-#define ERR_FAIL_COND_V(m_cond, m_retval)                                                                                                  \
-	if (unlikely(m_cond)) {                                                                                                                \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Returning: " _STR(m_retval)); \
-		return m_retval;                                                                                                                   \
-	} else                                                                                                                                 \
+#define ERR_FAIL_COND_V(m_cond, m_retval)                                                                                                            \
+	if (unlikely(m_cond)) {                                                                                                                          \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Condition \"" _STR(m_cond) "\" is true. Returning: " _STR(m_retval))); \
+		return m_retval;                                                                                                                             \
+	} else                                                                                                                                           \
 		((void)0)
 
 /**
@@ -429,21 +489,21 @@ void _err_flush_stdout();
  * If checking for null use ERR_FAIL_NULL_V_MSG instead.
  * If checking index bounds use ERR_FAIL_INDEX_V_MSG instead.
  */
-#define ERR_FAIL_COND_V_MSG(m_cond, m_retval, m_msg)                                                                                              \
-	if (unlikely(m_cond)) {                                                                                                                       \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Returning: " _STR(m_retval), m_msg); \
-		return m_retval;                                                                                                                          \
-	} else                                                                                                                                        \
+#define ERR_FAIL_COND_V_MSG(m_cond, m_retval, m_msg)                                                                                   \
+	if (unlikely(m_cond)) {                                                                                                            \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true. Returning: " _STR(m_retval)), _ERR_STR(m_msg), false, false); \
+		return m_retval;                                                                                                               \
+	} else                                                                                                                             \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_COND_V_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_COND_V_EDMSG(m_cond, m_retval, m_msg)                                                                                                  \
-	if (unlikely(m_cond)) {                                                                                                                             \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Returning: " _STR(m_retval), m_msg, true); \
-		return m_retval;                                                                                                                                \
-	} else                                                                                                                                              \
+#define ERR_FAIL_COND_V_EDMSG(m_cond, m_retval, m_msg)                                                                                \
+	if (unlikely(m_cond)) {                                                                                                           \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true. Returning: " _STR(m_retval)), _ERR_STR(m_msg), true, false); \
+		return m_retval;                                                                                                              \
+	} else                                                                                                                            \
 		((void)0)
 
 /**
@@ -453,32 +513,32 @@ void _err_flush_stdout();
  * Ensures `m_cond` is false.
  * If `m_cond` is true, the current loop continues.
  */
-#define ERR_CONTINUE(m_cond)                                                                                                \
-	if (unlikely(m_cond)) {                                                                                                 \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Continuing."); \
-		continue;                                                                                                           \
-	} else                                                                                                                  \
+#define ERR_CONTINUE(m_cond)                                                                                                          \
+	if (unlikely(m_cond)) {                                                                                                           \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Condition \"" _STR(m_cond) "\" is true. Continuing.")); \
+		continue;                                                                                                                     \
+	} else                                                                                                                            \
 		((void)0)
 
 /**
  * Ensures `m_cond` is false.
  * If `m_cond` is true, prints `m_msg` and the current loop continues.
  */
-#define ERR_CONTINUE_MSG(m_cond, m_msg)                                                                                            \
-	if (unlikely(m_cond)) {                                                                                                        \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Continuing.", m_msg); \
-		continue;                                                                                                                  \
-	} else                                                                                                                         \
+#define ERR_CONTINUE_MSG(m_cond, m_msg)                                                                                 \
+	if (unlikely(m_cond)) {                                                                                             \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true. Continuing."), _ERR_STR(m_msg), false, false); \
+		continue;                                                                                                       \
+	} else                                                                                                              \
 		((void)0)
 
 /**
  * Same as `ERR_CONTINUE_MSG` but also notifies the editor.
  */
-#define ERR_CONTINUE_EDMSG(m_cond, m_msg)                                                                                                \
-	if (unlikely(m_cond)) {                                                                                                              \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Continuing.", m_msg, true); \
-		continue;                                                                                                                        \
-	} else                                                                                                                               \
+#define ERR_CONTINUE_EDMSG(m_cond, m_msg)                                                                              \
+	if (unlikely(m_cond)) {                                                                                            \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true. Continuing."), _ERR_STR(m_msg), true, false); \
+		continue;                                                                                                      \
+	} else                                                                                                             \
 		((void)0)
 
 /**
@@ -488,32 +548,32 @@ void _err_flush_stdout();
  * Ensures `m_cond` is false.
  * If `m_cond` is true, the current loop breaks.
  */
-#define ERR_BREAK(m_cond)                                                                                                 \
-	if (unlikely(m_cond)) {                                                                                               \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Breaking."); \
-		break;                                                                                                            \
-	} else                                                                                                                \
+#define ERR_BREAK(m_cond)                                                                                                           \
+	if (unlikely(m_cond)) {                                                                                                         \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Condition \"" _STR(m_cond) "\" is true. Breaking.")); \
+		break;                                                                                                                      \
+	} else                                                                                                                          \
 		((void)0)
 
 /**
  * Ensures `m_cond` is false.
  * If `m_cond` is true, prints `m_msg` and the current loop breaks.
  */
-#define ERR_BREAK_MSG(m_cond, m_msg)                                                                                             \
-	if (unlikely(m_cond)) {                                                                                                      \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Breaking.", m_msg); \
-		break;                                                                                                                   \
-	} else                                                                                                                       \
+#define ERR_BREAK_MSG(m_cond, m_msg)                                                                                  \
+	if (unlikely(m_cond)) {                                                                                           \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true. Breaking."), _ERR_STR(m_msg), false, false); \
+		break;                                                                                                        \
+	} else                                                                                                            \
 		((void)0)
 
 /**
  * Same as `ERR_BREAK_MSG` but also notifies the editor.
  */
-#define ERR_BREAK_EDMSG(m_cond, m_msg)                                                                                                 \
-	if (unlikely(m_cond)) {                                                                                                            \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Condition \"" _STR(m_cond) "\" is true. Breaking.", m_msg, true); \
-		break;                                                                                                                         \
-	} else                                                                                                                             \
+#define ERR_BREAK_EDMSG(m_cond, m_msg)                                                                               \
+	if (unlikely(m_cond)) {                                                                                          \
+		_ERR_PRINT_MSG(_ERR_STR("Condition \"" _STR(m_cond) "\" is true. Breaking."), _ERR_STR(m_msg), true, false); \
+		break;                                                                                                       \
+	} else                                                                                                           \
 		((void)0)
 
 /**
@@ -524,12 +584,12 @@ void _err_flush_stdout();
  * Ensures `m_cond` is false.
  * If `m_cond` is true, the application crashes.
  */
-#define CRASH_COND(m_cond)                                                                                             \
-	if (unlikely(m_cond)) {                                                                                            \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "FATAL: Condition \"" _STR(m_cond) "\" is true."); \
-		::godot::_err_flush_stdout();                                                                                  \
-		GENERATE_TRAP();                                                                                               \
-	} else                                                                                                             \
+#define CRASH_COND(m_cond)                                                                                                       \
+	if (unlikely(m_cond)) {                                                                                                      \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("FATAL: Condition \"" _STR(m_cond) "\" is true.")); \
+		::godot::_err_flush_stdout();                                                                                            \
+		GENERATE_TRAP();                                                                                                         \
+	} else                                                                                                                       \
 		((void)0)
 
 /**
@@ -539,12 +599,12 @@ void _err_flush_stdout();
  * Ensures `m_cond` is false.
  * If `m_cond` is true, prints `m_msg` and the application crashes.
  */
-#define CRASH_COND_MSG(m_cond, m_msg)                                                                                         \
-	if (unlikely(m_cond)) {                                                                                                   \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "FATAL: Condition \"" _STR(m_cond) "\" is true.", m_msg); \
-		::godot::_err_flush_stdout();                                                                                         \
-		GENERATE_TRAP();                                                                                                      \
-	} else                                                                                                                    \
+#define CRASH_COND_MSG(m_cond, m_msg)                                                                              \
+	if (unlikely(m_cond)) {                                                                                        \
+		_ERR_PRINT_MSG(_ERR_STR("FATAL: Condition \"" _STR(m_cond) "\" is true."), _ERR_STR(m_msg), false, false); \
+		::godot::_err_flush_stdout();                                                                              \
+		GENERATE_TRAP();                                                                                           \
+	} else                                                                                                         \
 		((void)0)
 
 // Generic error macros.
@@ -556,11 +616,11 @@ void _err_flush_stdout();
  *
  * The current function returns.
  */
-#define ERR_FAIL()                                                                              \
-	if (true) {                                                                                 \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Method/function failed."); \
-		return;                                                                                 \
-	} else                                                                                      \
+#define ERR_FAIL()                                                                                        \
+	if (true) {                                                                                           \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Method/function failed.")); \
+		return;                                                                                           \
+	} else                                                                                                \
 		((void)0)
 
 /**
@@ -569,21 +629,21 @@ void _err_flush_stdout();
  *
  * Prints `m_msg`, and the current function returns.
  */
-#define ERR_FAIL_MSG(m_msg)                                                                            \
-	if (true) {                                                                                        \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Method/function failed.", m_msg); \
-		return;                                                                                        \
-	} else                                                                                             \
+#define ERR_FAIL_MSG(m_msg)                                                                 \
+	if (true) {                                                                             \
+		_ERR_PRINT_MSG(_ERR_STR("Method/function failed."), _ERR_STR(m_msg), false, false); \
+		return;                                                                             \
+	} else                                                                                  \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_EDMSG(m_msg)                                                                                \
-	if (true) {                                                                                              \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Method/function failed.", m_msg, true); \
-		return;                                                                                              \
-	} else                                                                                                   \
+#define ERR_FAIL_EDMSG(m_msg)                                                              \
+	if (true) {                                                                            \
+		_ERR_PRINT_MSG(_ERR_STR("Method/function failed."), _ERR_STR(m_msg), true, false); \
+		return;                                                                            \
+	} else                                                                                 \
 		((void)0)
 
 /**
@@ -593,11 +653,11 @@ void _err_flush_stdout();
  *
  * The current function returns `m_retval`.
  */
-#define ERR_FAIL_V(m_retval)                                                                                               \
-	if (true) {                                                                                                            \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Method/function failed. Returning: " _STR(m_retval)); \
-		return m_retval;                                                                                                   \
-	} else                                                                                                                 \
+#define ERR_FAIL_V(m_retval)                                                                                                         \
+	if (true) {                                                                                                                      \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("Method/function failed. Returning: " _STR(m_retval))); \
+		return m_retval;                                                                                                             \
+	} else                                                                                                                           \
 		((void)0)
 
 /**
@@ -606,21 +666,21 @@ void _err_flush_stdout();
  *
  * Prints `m_msg`, and the current function returns `m_retval`.
  */
-#define ERR_FAIL_V_MSG(m_retval, m_msg)                                                                                           \
-	if (true) {                                                                                                                   \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Method/function failed. Returning: " _STR(m_retval), m_msg); \
-		return m_retval;                                                                                                          \
-	} else                                                                                                                        \
+#define ERR_FAIL_V_MSG(m_retval, m_msg)                                                                                \
+	if (true) {                                                                                                        \
+		_ERR_PRINT_MSG(_ERR_STR("Method/function failed. Returning: " _STR(m_retval)), _ERR_STR(m_msg), false, false); \
+		return m_retval;                                                                                               \
+	} else                                                                                                             \
 		((void)0)
 
 /**
  * Same as `ERR_FAIL_V_MSG` but also notifies the editor.
  */
-#define ERR_FAIL_V_EDMSG(m_retval, m_msg)                                                                                               \
-	if (true) {                                                                                                                         \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "Method/function failed. Returning: " _STR(m_retval), m_msg, true); \
-		return m_retval;                                                                                                                \
-	} else                                                                                                                              \
+#define ERR_FAIL_V_EDMSG(m_retval, m_msg)                                                                             \
+	if (true) {                                                                                                       \
+		_ERR_PRINT_MSG(_ERR_STR("Method/function failed. Returning: " _STR(m_retval)), _ERR_STR(m_msg), true, false); \
+		return m_retval;                                                                                              \
+	} else                                                                                                            \
 		((void)0)
 
 /**
@@ -631,38 +691,38 @@ void _err_flush_stdout();
  * Prints `m_msg`.
  */
 #define ERR_PRINT(m_msg) \
-	::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg)
+	_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, false, false)
 
 /**
  * Same as `ERR_PRINT` but also notifies the editor.
  */
 #define ERR_PRINT_ED(m_msg) \
-	::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg, true)
+	_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, true, false)
 
 /**
  * Prints `m_msg` once during the application lifetime.
  */
-#define ERR_PRINT_ONCE(m_msg)                                                   \
-	if (true) {                                                                 \
-		static bool first_print = true;                                         \
-		if (first_print) {                                                      \
-			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg); \
-			first_print = false;                                                \
-		}                                                                       \
-	} else                                                                      \
+#define ERR_PRINT_ONCE(m_msg)                                       \
+	if (true) {                                                     \
+		static bool first_print = true;                             \
+		if (first_print) {                                          \
+			_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, false, false); \
+			first_print = false;                                    \
+		}                                                           \
+	} else                                                          \
 		((void)0)
 
 /**
  * Same as `ERR_PRINT_ONCE` but also notifies the editor.
  */
-#define ERR_PRINT_ONCE_ED(m_msg)                                                      \
-	if (true) {                                                                       \
-		static bool first_print = true;                                               \
-		if (first_print) {                                                            \
-			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg, true); \
-			first_print = false;                                                      \
-		}                                                                             \
-	} else                                                                            \
+#define ERR_PRINT_ONCE_ED(m_msg)                                   \
+	if (true) {                                                    \
+		static bool first_print = true;                            \
+		if (first_print) {                                         \
+			_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, true, false); \
+			first_print = false;                                   \
+		}                                                          \
+	} else                                                         \
 		((void)0)
 
 // Print warning message macros.
@@ -673,40 +733,40 @@ void _err_flush_stdout();
  * If warning about deprecated usage, use `WARN_DEPRECATED` or `WARN_DEPRECATED_MSG` instead.
  */
 #define WARN_PRINT(m_msg) \
-	::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg, false, true)
+	_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, false, true)
 
 /**
  * Same as `WARN_PRINT` but also notifies the editor.
  */
 #define WARN_PRINT_ED(m_msg) \
-	::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg, true, true)
+	_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, true, true)
 
 /**
  * Prints `m_msg` once during the application lifetime.
  *
  * If warning about deprecated usage, use `WARN_DEPRECATED` or `WARN_DEPRECATED_MSG` instead.
  */
-#define WARN_PRINT_ONCE(m_msg)                                                               \
-	if (true) {                                                                              \
-		static bool first_print = true;                                                      \
-		if (first_print) {                                                                   \
-			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg, false, true); \
-			first_print = false;                                                             \
-		}                                                                                    \
-	} else                                                                                   \
+#define WARN_PRINT_ONCE(m_msg)                                     \
+	if (true) {                                                    \
+		static bool first_print = true;                            \
+		if (first_print) {                                         \
+			_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, false, true); \
+			first_print = false;                                   \
+		}                                                          \
+	} else                                                         \
 		((void)0)
 
 /**
  * Same as `WARN_PRINT_ONCE` but also notifies the editor.
  */
-#define WARN_PRINT_ONCE_ED(m_msg)                                                           \
-	if (true) {                                                                             \
-		static bool first_print = true;                                                     \
-		if (first_print) {                                                                  \
-			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, m_msg, true, true); \
-			first_print = false;                                                            \
-		}                                                                                   \
-	} else                                                                                  \
+#define WARN_PRINT_ONCE_ED(m_msg)                                 \
+	if (true) {                                                   \
+		static bool first_print = true;                           \
+		if (first_print) {                                        \
+			_ERR_PRINT_MSG(_ERR_STR(m_msg), nullptr, true, true); \
+			first_print = false;                                  \
+		}                                                         \
+	} else                                                        \
 		((void)0)
 
 // Print deprecated warning message macros.
@@ -714,27 +774,27 @@ void _err_flush_stdout();
 /**
  * Warns that the current function is deprecated.
  */
-#define WARN_DEPRECATED                                                                                                                                     \
-	if (true) {                                                                                                                                             \
-		static std::atomic<bool> warning_shown;                                                                                                             \
-		if (!warning_shown.load()) {                                                                                                                        \
-			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "This method has been deprecated and will be removed in the future.", false, true); \
-			warning_shown.store(true);                                                                                                                      \
-		}                                                                                                                                                   \
-	} else                                                                                                                                                  \
+#define WARN_DEPRECATED                                                                                                                                               \
+	if (true) {                                                                                                                                                       \
+		static std::atomic<bool> warning_shown;                                                                                                                       \
+		if (!warning_shown.load()) {                                                                                                                                  \
+			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("This method has been deprecated and will be removed in the future."), false, true); \
+			warning_shown.store(true);                                                                                                                                \
+		}                                                                                                                                                             \
+	} else                                                                                                                                                            \
 		((void)0)
 
 /**
  * Warns that the current function is deprecated and prints `m_msg`.
  */
-#define WARN_DEPRECATED_MSG(m_msg)                                                                                                                                 \
-	if (true) {                                                                                                                                                    \
-		static std::atomic<bool> warning_shown;                                                                                                                    \
-		if (!warning_shown.load()) {                                                                                                                               \
-			::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "This method has been deprecated and will be removed in the future.", m_msg, false, true); \
-			warning_shown.store(true);                                                                                                                             \
-		}                                                                                                                                                          \
-	} else                                                                                                                                                         \
+#define WARN_DEPRECATED_MSG(m_msg)                                                                                                        \
+	if (true) {                                                                                                                           \
+		static std::atomic<bool> warning_shown;                                                                                           \
+		if (!warning_shown.load()) {                                                                                                      \
+			_ERR_PRINT_MSG(_ERR_STR("This method has been deprecated and will be removed in the future."), _ERR_STR(m_msg), false, true); \
+			warning_shown.store(true);                                                                                                    \
+		}                                                                                                                                 \
+	} else                                                                                                                                \
 		((void)0)
 
 /**
@@ -743,12 +803,12 @@ void _err_flush_stdout();
  *
  * The application crashes.
  */
-#define CRASH_NOW()                                                                                    \
-	if (true) {                                                                                        \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "FATAL: Method/function failed."); \
-		::godot::_err_flush_stdout();                                                                  \
-		GENERATE_TRAP();                                                                               \
-	} else                                                                                             \
+#define CRASH_NOW()                                                                                              \
+	if (true) {                                                                                                  \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("FATAL: Method/function failed.")); \
+		::godot::_err_flush_stdout();                                                                            \
+		GENERATE_TRAP();                                                                                         \
+	} else                                                                                                       \
 		((void)0)
 
 /**
@@ -756,12 +816,12 @@ void _err_flush_stdout();
  *
  * Prints `m_msg`, and then the application crashes.
  */
-#define CRASH_NOW_MSG(m_msg)                                                                                  \
-	if (true) {                                                                                               \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "FATAL: Method/function failed.", m_msg); \
-		::godot::_err_flush_stdout();                                                                         \
-		GENERATE_TRAP();                                                                                      \
-	} else                                                                                                    \
+#define CRASH_NOW_MSG(m_msg)                                                                       \
+	if (true) {                                                                                    \
+		_ERR_PRINT_MSG(_ERR_STR("FATAL: Method/function failed."), _ERR_STR(m_msg), false, false); \
+		::godot::_err_flush_stdout();                                                              \
+		GENERATE_TRAP();                                                                           \
+	} else                                                                                         \
 		((void)0)
 
 /**
@@ -769,12 +829,12 @@ void _err_flush_stdout();
  *  only used in dev builds.
  */
 #ifdef DEBUG_ENABLED
-#define DEV_ASSERT(m_cond)                                                                                                       \
-	if (unlikely(!(m_cond))) {                                                                                                   \
-		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, "FATAL: DEV_ASSERT failed  \"" _STR(m_cond) "\" is false."); \
-		::godot::_err_flush_stdout();                                                                                            \
-		GENERATE_TRAP();                                                                                                         \
-	} else                                                                                                                       \
+#define DEV_ASSERT(m_cond)                                                                                                                 \
+	if (unlikely(!(m_cond))) {                                                                                                             \
+		::godot::_err_print_error(FUNCTION_STR, __FILE__, __LINE__, _ERR_STR("FATAL: DEV_ASSERT failed  \"" _STR(m_cond) "\" is false.")); \
+		::godot::_err_flush_stdout();                                                                                                      \
+		GENERATE_TRAP();                                                                                                                   \
+	} else                                                                                                                                 \
 		((void)0)
 #else
 #define DEV_ASSERT(m_cond)
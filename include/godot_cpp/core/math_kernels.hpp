@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  math_kernels.hpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_MATH_KERNELS_HPP
+#define GODOT_MATH_KERNELS_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+namespace godot {
+
+// Batch math over contiguous buffers, with SSE4.1/AVX2/AVX-512 variants
+// selected at runtime (see CPUFeatures).
+//
+// All functions accept p_count == 0, except min() and max(). Destination buffers
+// may alias sources exactly, but must not partially overlap them. Vectorized
+// reductions don't sum in the same order as the scalar fallback, and the sRGB
+// transfer functions use a polynomial pow() approximation (relative error below
+// 1e-5), so results can differ from the scalar path in the last bits.
+namespace MathKernels {
+
+struct Table {
+	float (*sum_f32)(const float *p_src, int64_t p_count);
+	float (*min_f32)(const float *p_src, int64_t p_count);
+	float (*max_f32)(const float *p_src, int64_t p_count);
+	float (*dot_f32)(const float *p_a, const float *p_b, int64_t p_count);
+	void (*scale_f32)(float *p_dst, const float *p_src, float p_scale, int64_t p_count);
+	void (*add_f32)(float *p_dst, const float *p_a, const float *p_b, int64_t p_count);
+	void (*axpy_f32)(float *p_dst, float p_alpha, const float *p_x, const float *p_y, int64_t p_count);
+	void (*clamp_f32)(float *p_dst, const float *p_src, float p_min, float p_max, int64_t p_count);
+	void (*lerp_f32)(float *p_dst, const float *p_from, const float *p_to, float p_weight, int64_t p_count);
+
+	double (*sum_f64)(const double *p_src, int64_t p_count);
+	double (*min_f64)(const double *p_src, int64_t p_count);
+	double (*max_f64)(const double *p_src, int64_t p_count);
+	double (*dot_f64)(const double *p_a, const double *p_b, int64_t p_count);
+	void (*scale_f64)(double *p_dst, const double *p_src, double p_scale, int64_t p_count);
+	void (*add_f64)(double *p_dst, const double *p_a, const double *p_b, int64_t p_count);
+	void (*axpy_f64)(double *p_dst, double p_alpha, const double *p_x, const double *p_y, int64_t p_count);
+	void (*clamp_f64)(double *p_dst, const double *p_src, double p_min, double p_max, int64_t p_count);
+	void (*lerp_f64)(double *p_dst, const double *p_from, const double *p_to, double p_weight, int64_t p_count);
+
+	// RGBA quadruplets (the layout of Color), p_count is the number of colors.
+	// Alpha is left untouched.
+	void (*srgb_to_linear_rgba)(float *p_dst, const float *p_src, int64_t p_count);
+	void (*linear_to_srgb_rgba)(float *p_dst, const float *p_src, int64_t p_count);
+	void (*premultiply_alpha_rgba)(float *p_dst, const float *p_src, int64_t p_count);
+	// HSV is stored as (h, s, v, a), as taken by Color::from_hsv(). No vector
+	// variant yet: every level uses the scalar loop.
+	void (*rgb_to_hsv_rgba)(float *p_dst, const float *p_src, int64_t p_count);
+	void (*hsv_to_rgb_rgba)(float *p_dst, const float *p_src, int64_t p_count);
+
+	// Column-major 4x4 matrices (the layout of Projection). mat4_inverse returns
+	// false and leaves p_dst untouched if the determinant is approximately zero
+	// (Math::is_zero_approx()). mat4_xform3 transforms points with w = 1 and
+	// divides the result by w. The vector double variants need AVX2.
+	void (*mat4_mul_f32)(float *p_dst, const float *p_a, const float *p_b);
+	bool (*mat4_inverse_f32)(float *p_dst, const float *p_src);
+	void (*mat4_xform4_f32)(float *p_dst, const float *p_matrix, const float *p_src, int64_t p_count);
+	void (*mat4_xform3_f32)(float *p_dst, const float *p_matrix, const float *p_src, int64_t p_count);
+
+	void (*mat4_mul_f64)(double *p_dst, const double *p_a, const double *p_b);
+	bool (*mat4_inverse_f64)(double *p_dst, const double *p_src);
+	void (*mat4_xform4_f64)(double *p_dst, const double *p_matrix, const double *p_src, int64_t p_count);
+	void (*mat4_xform3_f64)(double *p_dst, const double *p_matrix, const double *p_src, int64_t p_count);
+
+	// Accumulates p_count 64-byte stripes into eight 64-bit lanes for
+	// hash64_buffer(). Stripe i is keyed with p_secret[i..i + 7]. Every level
+	// gives the same result.
+	void (*hash64_stripes)(uint64_t *r_acc, const uint8_t *p_data, const uint64_t *p_secret, int64_t p_count);
+
+	// Text. mismatch_u8 returns the index of the first differing byte, or
+	// p_count if there's none. find returns the index of the first match, or -1.
+	// ascii_case_u8 converts A-Z to lowercase, or a-z to uppercase if p_upper is
+	// set, and copies everything else; p_dst may be p_src.
+	int64_t (*mismatch_u8)(const uint8_t *p_a, const uint8_t *p_b, int64_t p_count);
+	int64_t (*find_u16)(const uint16_t *p_src, int64_t p_count, uint16_t p_value);
+	int64_t (*find_u32)(const uint32_t *p_src, int64_t p_count, uint32_t p_value);
+	void (*ascii_case_u8)(uint8_t *p_dst, const uint8_t *p_src, int64_t p_count, bool p_upper);
+};
+
+// Currently selected kernels. Initialized with the scalar variants.
+extern Table table;
+
+// Per-ISA table fillers, defined in math_kernels_<isa>.cpp. These translation units
+// are compiled with a wider instruction set than the rest of the library, so they
+// must not instantiate any inline function or template from other headers: the
+// linker could otherwise keep their copy for every caller.
+void fill_scalar(Table &r_table);
+#ifdef GODOT_SIMD_DISPATCH_ENABLED
+void fill_sse4_1(Table &r_table);
+void fill_avx2(Table &r_table);
+void fill_avx512(Table &r_table);
+#endif
+
+_FORCE_INLINE_ float sum(const float *p_src, int64_t p_count) { return table.sum_f32(p_src, p_count); }
+_FORCE_INLINE_ float min(const float *p_src, int64_t p_count) { return table.min_f32(p_src, p_count); }
+_FORCE_INLINE_ float max(const float *p_src, int64_t p_count) { return table.max_f32(p_src, p_count); }
+_FORCE_INLINE_ float dot(const float *p_a, const float *p_b, int64_t p_count) { return table.dot_f32(p_a, p_b, p_count); }
+_FORCE_INLINE_ void scale(float *p_dst, const float *p_src, float p_scale, int64_t p_count) { table.scale_f32(p_dst, p_src, p_scale, p_count); }
+_FORCE_INLINE_ void add(float *p_dst, const float *p_a, const float *p_b, int64_t p_count) { table.add_f32(p_dst, p_a, p_b, p_count); }
+// p_dst = p_alpha * p_x + p_y
+_FORCE_INLINE_ void axpy(float *p_dst, float p_alpha, const float *p_x, const float *p_y, int64_t p_count) { table.axpy_f32(p_dst, p_alpha, p_x, p_y, p_count); }
+_FORCE_INLINE_ void clamp(float *p_dst, const float *p_src, float p_min, float p_max, int64_t p_count) { table.clamp_f32(p_dst, p_src, p_min, p_max, p_count); }
+_FORCE_INLINE_ void lerp(float *p_dst, const float *p_from, const float *p_to, float p_weight, int64_t p_count) { table.lerp_f32(p_dst, p_from, p_to, p_weight, p_count); }
+
+_FORCE_INLINE_ double sum(const double *p_src, int64_t p_count) { return table.sum_f64(p_src, p_count); }
+_FORCE_INLINE_ double min(const double *p_src, int64_t p_count) { return table.min_f64(p_src, p_count); }
+_FORCE_INLINE_ double max(const double *p_src, int64_t p_count) { return table.max_f64(p_src, p_count); }
+_FORCE_INLINE_ double dot(const double *p_a, const double *p_b, int64_t p_count) { return table.dot_f64(p_a, p_b, p_count); }
+_FORCE_INLINE_ void scale(double *p_dst, const double *p_src, double p_scale, int64_t p_count) { table.scale_f64(p_dst, p_src, p_scale, p_count); }
+_FORCE_INLINE_ void add(double *p_dst, const double *p_a, const double *p_b, int64_t p_count) { table.add_f64(p_dst, p_a, p_b, p_count); }
+_FORCE_INLINE_ void axpy(double *p_dst, double p_alpha, const double *p_x, const double *p_y, int64_t p_count) { table.axpy_f64(p_dst, p_alpha, p_x, p_y, p_count); }
+_FORCE_INLINE_ void clamp(double *p_dst, const double *p_src, double p_min, double p_max, int64_t p_count) { table.clamp_f64(p_dst, p_src, p_min, p_max, p_count); }
+_FORCE_INLINE_ void lerp(double *p_dst, const double *p_from, const double *p_to, double p_weight, int64_t p_count) { table.lerp_f64(p_dst, p_from, p_to, p_weight, p_count); }
+
+_FORCE_INLINE_ void srgb_to_linear_rgba(float *p_dst, const float *p_src, int64_t p_count) { table.srgb_to_linear_rgba(p_dst, p_src, p_count); }
+_FORCE_INLINE_ void linear_to_srgb_rgba(float *p_dst, const float *p_src, int64_t p_count) { table.linear_to_srgb_rgba(p_dst, p_src, p_count); }
+_FORCE_INLINE_ void premultiply_alpha_rgba(float *p_dst, const float *p_src, int64_t p_count) { table.premultiply_alpha_rgba(p_dst, p_src, p_count); }
+_FORCE_INLINE_ void rgb_to_hsv_rgba(float *p_dst, const float *p_src, int64_t p_count) { table.rgb_to_hsv_rgba(p_dst, p_src, p_count); }
+_FORCE_INLINE_ void hsv_to_rgb_rgba(float *p_dst, const float *p_src, int64_t p_count) { table.hsv_to_rgb_rgba(p_dst, p_src, p_count); }
+
+_FORCE_INLINE_ void mat4_mul(float *p_dst, const float *p_a, const float *p_b) { table.mat4_mul_f32(p_dst, p_a, p_b); }
+_FORCE_INLINE_ bool mat4_inverse(float *p_dst, const float *p_src) { return table.mat4_inverse_f32(p_dst, p_src); }
+_FORCE_INLINE_ void mat4_xform4(float *p_dst, const float *p_matrix, const float *p_src, int64_t p_count) { table.mat4_xform4_f32(p_dst, p_matrix, p_src, p_count); }
+_FORCE_INLINE_ void mat4_xform3(float *p_dst, const float *p_matrix, const float *p_src, int64_t p_count) { table.mat4_xform3_f32(p_dst, p_matrix, p_src, p_count); }
+
+_FORCE_INLINE_ void mat4_mul(double *p_dst, const double *p_a, const double *p_b) { table.mat4_mul_f64(p_dst, p_a, p_b); }
+_FORCE_INLINE_ bool mat4_inverse(double *p_dst, const double *p_src) { return table.mat4_inverse_f64(p_dst, p_src); }
+_FORCE_INLINE_ void mat4_xform4(double *p_dst, const double *p_matrix, const double *p_src, int64_t p_count) { table.mat4_xform4_f64(p_dst, p_matrix, p_src, p_count); }
+_FORCE_INLINE_ void mat4_xform3(double *p_dst, const double *p_matrix, const double *p_src, int64_t p_count) { table.mat4_xform3_f64(p_dst, p_matrix, p_src, p_count); }
+
+_FORCE_INLINE_ void hash64_stripes(uint64_t *r_acc, const uint8_t *p_data, const uint64_t *p_secret, int64_t p_count) { table.hash64_stripes(r_acc, p_data, p_secret, p_count); }
+
+_FORCE_INLINE_ int64_t mismatch(const uint8_t *p_a, const uint8_t *p_b, int64_t p_count) { return table.mismatch_u8(p_a, p_b, p_count); }
+_FORCE_INLINE_ int64_t find(const uint16_t *p_src, int64_t p_count, uint16_t p_value) { return table.find_u16(p_src, p_count, p_value); }
+_FORCE_INLINE_ int64_t find(const uint32_t *p_src, int64_t p_count, uint32_t p_value) { return table.find_u32(p_src, p_count, p_value); }
+_FORCE_INLINE_ void ascii_case(uint8_t *p_dst, const uint8_t *p_src, int64_t p_count, bool p_upper) { table.ascii_case_u8(p_dst, p_src, p_count, p_upper); }
+
+} // namespace MathKernels
+
+} // namespace godot
+
+#endif // GODOT_MATH_KERNELS_HPP
@@ -40,6 +40,10 @@
 
 #include <type_traits>
 
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+#include <godot_cpp/core/memory_accounting.hpp>
+#endif
+
 #ifndef PAD_ALIGN
 #define PAD_ALIGN 16 //must always be greater than this at much
 #endif
@@ -69,8 +73,9 @@ class Memory {
 	Memory();
 
 public:
-	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
-	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
+	// `p_tag` comes from GODOT_MEMORY_TAG(), see MemoryAccounting.
+	static void *alloc_static(size_t p_bytes, bool p_pad_align = false, uint32_t p_tag = 0);
+	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false, uint32_t p_tag = 0);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
 };
 
@@ -86,7 +91,13 @@ _ALWAYS_INLINE_ T *_post_initialize(T *p_obj) {
 #define memrealloc(m_mem, m_size) ::godot::Memory::realloc_static(m_mem, m_size)
 #define memfree(m_mem) ::godot::Memory::free_static(m_mem)
 
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+#define GODOT_MEMORY_TAG(...) ::godot::MemoryAccounting::get_tag<__VA_ARGS__>()
+#define memnew(m_class) ::godot::_post_initialize(::godot::MemoryAccounting::tag_new(new ("", "") m_class))
+#else
+#define GODOT_MEMORY_TAG(...) 0
 #define memnew(m_class) ::godot::_post_initialize(new ("", "") m_class)
+#endif
 
 #define memnew_allocator(m_class, m_allocator) ::godot::_post_initialize(new ("", m_allocator::alloc) m_class)
 #define memnew_placement(m_placement, m_class) ::godot::_post_initialize(new ("", m_placement, sizeof(m_class), "") m_class)
@@ -145,7 +156,7 @@ T *memnew_arr_template(size_t p_elements, const char *p_descr = "") {
 	same strategy used by std::vector, and the Vector class, so it should be safe.*/
 
 	size_t len = sizeof(T) * p_elements;
-	uint64_t *mem = (uint64_t *)Memory::alloc_static(len, true);
+	uint64_t *mem = (uint64_t *)Memory::alloc_static(len, true, GODOT_MEMORY_TAG(T[]));
 	T *failptr = nullptr; // Get rid of a warning.
 	ERR_FAIL_NULL_V(mem, failptr);
 	*(mem - 1) = p_elements;
@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*  memory_accounting.hpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_MEMORY_ACCOUNTING_HPP
+#define GODOT_MEMORY_ACCOUNTING_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace godot {
+
+// Tracks the memory allocated through Memory, per tag: the type created by
+// memnew()/memnew_arr(), or the container (LocalVector, Vector, HashMap...)
+// that owns a buffer. Allocations made with memalloc() directly are "untagged".
+//
+// Only compiled in when the library is built with `memory_accounting=yes`
+// (SCons) or `GODOT_CPP_MEMORY_ACCOUNTING` (CMake), which define
+// GODOT_MEMORY_ACCOUNTING_ENABLED. Every allocation then carries a small header
+// with its size and tag, and each thread counts its own allocations. The
+// exact live size is computed by snapshot(), while the peak is tracked from
+// batches of 64 KiB per thread and tag, so it's approximate for small tags.
+// Reallocations count as a free and a new allocation.
+class MemoryAccounting {
+public:
+	// Bucket `i` counts allocations of [2^i, 2^(i+1)) bytes, the last one also
+	// takes everything larger.
+	static constexpr uint32_t SIZE_BUCKETS = 32;
+	static constexpr uint32_t TAG_UNTAGGED = 0;
+	// Keeps the user part of allocations aligned like the engine's.
+	static constexpr size_t HEADER_SIZE = 16;
+
+	struct TagStats {
+		std::string name;
+		uint64_t allocations = 0;
+		uint64_t frees = 0;
+		uint64_t allocated_bytes = 0;
+		uint64_t freed_bytes = 0;
+		int64_t live_bytes = 0;
+		int64_t peak_bytes = 0;
+		uint64_t size_histogram[SIZE_BUCKETS] = {};
+
+		_FORCE_INLINE_ int64_t get_live_allocations() const { return (int64_t)allocations - (int64_t)frees; }
+	};
+	// Indexed by tag.
+	typedef std::vector<TagStats> Snapshot;
+
+	static Snapshot snapshot();
+	// What happened between two snapshots, the peak is the one of `p_after`.
+	static Snapshot diff(const Snapshot &p_before, const Snapshot &p_after);
+	// One line per tag with live or changed allocations, largest first.
+	static std::string format(const Snapshot &p_snapshot);
+	// Warns about everything still allocated, GDExtensionBinding calls it once
+	// the extension is deinitialized. Static variables are only destroyed after
+	// that and show up here too.
+	static void print_leaks();
+
+	static uint32_t register_tag(const char *p_name);
+	template <class T>
+	static uint32_t get_tag() {
+#if defined(_MSC_VER)
+		static const uint32_t tag = register_type_tag(__FUNCSIG__);
+#else
+		static const uint32_t tag = register_type_tag(__PRETTY_FUNCTION__);
+#endif
+		return tag;
+	}
+
+	// Used by Memory, `p_base` is the start of the allocation, including the header.
+	static void *track_alloc(void *p_base, size_t p_bytes, uint32_t p_tag);
+	static void *get_base(void *p_memory, size_t &r_bytes, uint32_t &r_tag);
+	static void track_free(size_t p_bytes, uint32_t p_tag);
+	static void retag(void *p_memory, uint32_t p_tag);
+
+	template <class T>
+	_FORCE_INLINE_ static T *tag_new(T *p_object) {
+		retag(p_object, get_tag<T>());
+		return p_object;
+	}
+
+private:
+	// Extracts the type from the signature of get_tag<T>().
+	static uint32_t register_type_tag(const char *p_signature);
+};
+
+} // namespace godot
+
+#endif // GODOT_MEMORY_ACCOUNTING_HPP
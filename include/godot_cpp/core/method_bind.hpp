@@ -62,6 +62,11 @@ class MethodBind {
 	GDExtensionVariantType *argument_types = nullptr;
 	std::vector<Variant> default_arguments;
 
+	// Assigned by MethodProfiler::register_method(), part of the layout even
+	// when the profiler is disabled.
+	uint32_t profiler_index = UINT32_MAX;
+	friend class MethodProfiler;
+
 protected:
 	virtual GDExtensionVariantType gen_argument_type(int p_arg) const = 0;
 	virtual PropertyInfo gen_argument_type_info(int p_arg) const = 0;
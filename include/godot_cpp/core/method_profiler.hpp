@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*  method_profiler.hpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_METHOD_PROFILER_HPP
+#define GODOT_METHOD_PROFILER_HPP
+
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <vector>
+
+namespace godot {
+
+class MethodBind;
+
+// Per-method call counts and latencies for everything bound through ClassDB.
+//
+// The instrumentation in MethodBind::bind_call() and MethodBind::bind_ptrcall()
+// only exists when the library is built with `method_profiler=yes` (SCons) or
+// `GODOT_CPP_METHOD_PROFILER` (CMake), which define GODOT_METHOD_PROFILER_ENABLED.
+// Otherwise every function here is still available but reports nothing.
+//
+// Each thread records into its own counters, so calls never contend with each
+// other; they are only summed up when a report is requested.
+class MethodProfiler {
+public:
+	// Bucket `i` counts calls that took [2^i, 2^(i+1)) nanoseconds, the last
+	// one also takes everything slower than that.
+	static constexpr uint32_t HISTOGRAM_BUCKETS = 32;
+
+	struct Counters {
+		uint64_t variant_calls = 0;
+		uint64_t ptrcalls = 0;
+		uint64_t total_nsec = 0;
+		uint64_t max_nsec = 0;
+		uint64_t histogram[HISTOGRAM_BUCKETS] = {};
+
+		_FORCE_INLINE_ uint64_t get_call_count() const { return variant_calls + ptrcalls; }
+		_FORCE_INLINE_ uint64_t get_mean_nsec() const { return get_call_count() ? total_nsec / get_call_count() : 0; }
+		// Upper bound of the histogram bucket containing the given fraction of the calls.
+		uint64_t get_percentile_nsec(double p_fraction) const;
+		void merge(const Counters &p_other);
+	};
+
+	struct Entry {
+		StringName class_name;
+		StringName method_name;
+		Counters counters;
+	};
+
+	static constexpr bool is_enabled() {
+#ifdef GODOT_METHOD_PROFILER_ENABLED
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	static void register_method(const StringName &p_class_name, MethodBind *p_method);
+	static void record(const MethodBind *p_method, bool p_ptrcall, uint64_t p_nsec);
+	static uint64_t get_ticks_nsec();
+
+	// Methods that were called at least once, slowest in total first.
+	static std::vector<Entry> get_report();
+	static String get_csv();
+	static String get_json();
+	static void reset();
+
+	// Forgets all methods and frees the per-thread counters. Only safe once no
+	// bound method can be called anymore, GDExtensionBinding does it when the
+	// extension is deinitialized.
+	static void clear();
+};
+
+} // namespace godot
+
+#endif // GODOT_METHOD_PROFILER_HPP
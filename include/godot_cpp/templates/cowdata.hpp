@@ -40,6 +40,7 @@
 #include <cstring>
 #include <new>
 #include <type_traits>
+#include <utility>
 
 namespace godot {
 
@@ -72,6 +73,13 @@ class CowData {
 private:
 	mutable T *_ptr = nullptr;
 
+	// The data is preceded by a header holding the capacity, padding, the
+	// refcount and the size, which keeps it aligned like the allocation.
+	static constexpr size_t DATA_OFFSET = 4 * sizeof(uint32_t);
+
+	// Trivially copyable types grow with realloc, others are moved element by element.
+	static constexpr bool RELOCATE_WITH_REALLOC = std::is_trivially_copyable<T>::value;
+
 	// internal helpers
 
 	_FORCE_INLINE_ SafeNumeric<uint32_t> *_get_refcount() const {
@@ -90,15 +98,19 @@ private:
 		return reinterpret_cast<uint32_t *>(_ptr) - 1;
 	}
 
-	_FORCE_INLINE_ T *_get_data() const {
+	_FORCE_INLINE_ uint32_t *_get_capacity() const {
 		if (!_ptr) {
 			return nullptr;
 		}
-		return reinterpret_cast<T *>(_ptr);
+
+		return reinterpret_cast<uint32_t *>(_ptr) - 4;
 	}
 
-	_FORCE_INLINE_ size_t _get_alloc_size(size_t p_elements) const {
-		return next_power_of_2(p_elements * sizeof(T));
+	_FORCE_INLINE_ T *_get_data() const {
+		if (!_ptr) {
+			return nullptr;
+		}
+		return reinterpret_cast<T *>(_ptr);
 	}
 
 	_FORCE_INLINE_ bool _get_alloc_size_checked(size_t p_elements, size_t *out) const {
@@ -120,11 +132,27 @@ private:
 #else
 		// Speed is more important than correctness here, do the operations unchecked
 		// and hope for the best.
-		*out = _get_alloc_size(p_elements);
+		*out = next_power_of_2(p_elements * sizeof(T));
 #endif
 		return *out;
 	}
 
+	// Capacity used when growing to p_elements: as many elements as fit in the
+	// next power of two bytes, so repeated growth is exponential.
+	_FORCE_INLINE_ bool _get_capacity_checked(size_t p_elements, uint32_t *r_capacity) const {
+		size_t alloc_size;
+		if (!_get_alloc_size_checked(p_elements, &alloc_size)) {
+			return false;
+		}
+		*r_capacity = (uint32_t)MIN(alloc_size / sizeof(T), (size_t)INT32_MAX);
+		return *r_capacity >= p_elements;
+	}
+
+	T *_allocate(uint32_t p_capacity);
+	void _free_buffer(T *p_data);
+	Error _reallocate(uint32_t p_capacity);
+	Error _unshare(uint32_t p_capacity, uint32_t p_count);
+
 	void _unref(void *p_data);
 	void _ref(const CowData *p_from);
 	void _ref(const CowData &p_from);
@@ -132,6 +160,15 @@ private:
 
 public:
 	void operator=(const CowData<T> &p_from) { _ref(p_from); }
+	void operator=(CowData<T> &&p_from) {
+		if (_ptr == p_from._ptr) {
+			return;
+		}
+
+		_unref(_ptr);
+		_ptr = p_from._ptr;
+		p_from._ptr = nullptr;
+	}
 
 	_FORCE_INLINE_ T *ptrw() {
 		_copy_on_write();
@@ -151,8 +188,17 @@ public:
 		}
 	}
 
+	_FORCE_INLINE_ int get_capacity() const {
+		uint32_t *capacity = _get_capacity();
+		if (capacity) {
+			return *capacity;
+		} else {
+			return 0;
+		}
+	}
+
 	_FORCE_INLINE_ void clear() { resize(0); }
-	_FORCE_INLINE_ bool is_empty() const { return _ptr == nullptr; }
+	_FORCE_INLINE_ bool is_empty() const { return size() == 0; }
 
 	_FORCE_INLINE_ void set(int p_index, const T &p_elem) {
 		ERR_FAIL_INDEX(p_index, size());
@@ -173,13 +219,16 @@ public:
 	}
 
 	Error resize(int p_size);
+	// Makes room for p_capacity elements without changing the size, so that
+	// growing up to it doesn't reallocate.
+	Error reserve(int p_capacity);
 
 	_FORCE_INLINE_ void remove_at(int p_index) {
 		ERR_FAIL_INDEX(p_index, size());
 		T *p = ptrw();
 		int len = size();
 		for (int i = p_index; i < len - 1; i++) {
-			p[i] = p[i + 1];
+			p[i] = std::move(p[i + 1]);
 		}
 
 		resize(len - 1);
@@ -187,11 +236,13 @@ public:
 
 	Error insert(int p_pos, const T &p_val) {
 		ERR_FAIL_INDEX_V(p_pos, size() + 1, ERR_INVALID_PARAMETER);
-		resize(size() + 1);
+		Error err = resize(size() + 1);
+		ERR_FAIL_COND_V(err, err);
+		T *p = _get_data();
 		for (int i = (size() - 1); i > p_pos; i--) {
-			set(i, get(i - 1));
+			p[i] = std::move(p[i - 1]);
 		}
-		set(p_pos, p_val);
+		p[p_pos] = p_val;
 
 		return OK;
 	}
@@ -201,8 +252,29 @@ public:
 	_FORCE_INLINE_ CowData() {}
 	_FORCE_INLINE_ ~CowData();
 	_FORCE_INLINE_ CowData(CowData<T> &p_from) { _ref(p_from); }
+	_FORCE_INLINE_ CowData(CowData<T> &&p_from) {
+		_ptr = p_from._ptr;
+		p_from._ptr = nullptr;
+	}
 };
 
+template <class T>
+T *CowData<T>::_allocate(uint32_t p_capacity) {
+	uint8_t *mem = (uint8_t *)Memory::alloc_static(DATA_OFFSET + p_capacity * sizeof(T), true, GODOT_MEMORY_TAG(CowData));
+	ERR_FAIL_NULL_V(mem, nullptr);
+
+	uint32_t *data = (uint32_t *)(mem + DATA_OFFSET);
+	new (data - 2) SafeNumeric<uint32_t>(1); // refcount
+	*(data - 1) = 0; // size, currently none
+	*(data - 4) = p_capacity;
+	return (T *)data;
+}
+
+template <class T>
+void CowData<T>::_free_buffer(T *p_data) {
+	Memory::free_static((uint8_t *)p_data - DATA_OFFSET, true);
+}
+
 template <class T>
 void CowData<T>::_unref(void *p_data) {
 	if (!p_data) {
@@ -227,7 +299,53 @@ void CowData<T>::_unref(void *p_data) {
 	}
 
 	// free mem
-	Memory::free_static((uint8_t *)p_data, true);
+	_free_buffer(_ptr);
+}
+
+// Moves the elements to a buffer of p_capacity elements. Only when not shared.
+template <class T>
+Error CowData<T>::_reallocate(uint32_t p_capacity) {
+	if constexpr (RELOCATE_WITH_REALLOC) {
+		uint8_t *mem = (uint8_t *)Memory::realloc_static((uint8_t *)_ptr - DATA_OFFSET, DATA_OFFSET + p_capacity * sizeof(T), true, GODOT_MEMORY_TAG(CowData));
+		ERR_FAIL_NULL_V(mem, ERR_OUT_OF_MEMORY);
+		_ptr = (T *)(mem + DATA_OFFSET);
+	} else {
+		T *data = _allocate(p_capacity);
+		ERR_FAIL_NULL_V(data, ERR_OUT_OF_MEMORY);
+
+		const uint32_t count = *_get_size();
+		for (uint32_t i = 0; i < count; i++) {
+			memnew_placement(&data[i], T(std::move(_ptr[i])));
+			_ptr[i].~T();
+		}
+		*((uint32_t *)data - 1) = count;
+
+		_free_buffer(_ptr);
+		_ptr = data;
+	}
+	*_get_capacity() = p_capacity;
+	return OK;
+}
+
+// Replaces a shared buffer by a private one of p_capacity elements, holding a
+// copy of the first p_count elements.
+template <class T>
+Error CowData<T>::_unshare(uint32_t p_capacity, uint32_t p_count) {
+	T *data = _allocate(p_capacity);
+	ERR_FAIL_NULL_V(data, ERR_OUT_OF_MEMORY);
+
+	if (std::is_trivially_copyable<T>::value) {
+		memcpy((void *)data, (const void *)_ptr, p_count * sizeof(T));
+	} else {
+		for (uint32_t i = 0; i < p_count; i++) {
+			memnew_placement(&data[i], T(_ptr[i]));
+		}
+	}
+	*((uint32_t *)data - 1) = p_count;
+
+	_unref(_ptr);
+	_ptr = data;
+	return OK;
 }
 
 template <class T>
@@ -242,26 +360,9 @@ uint32_t CowData<T>::_copy_on_write() {
 	if (unlikely(rc > 1)) {
 		/* in use by more than me */
 		uint32_t current_size = *_get_size();
-
-		uint32_t *mem_new = (uint32_t *)Memory::alloc_static(_get_alloc_size(current_size), true);
-
-		new (mem_new - 2) SafeNumeric<uint32_t>(1); // refcount
-		*(mem_new - 1) = current_size; // size
-
-		T *_data = (T *)(mem_new);
-
-		// initialize new elements
-		if (std::is_trivially_copyable<T>::value) {
-			memcpy(mem_new, _ptr, current_size * sizeof(T));
-
-		} else {
-			for (uint32_t i = 0; i < current_size; i++) {
-				memnew_placement(&_data[i], T(_get_data()[i]));
-			}
-		}
-
-		_unref(_ptr);
-		_ptr = _data;
+		uint32_t capacity = 0;
+		_get_capacity_checked(current_size, &capacity);
+		CRASH_COND_MSG(_unshare(MAX(capacity, current_size), current_size) != OK, "Out of memory");
 
 		rc = 1;
 	}
@@ -285,68 +386,83 @@ Error CowData<T>::resize(int p_size) {
 		return OK;
 	}
 
-	// possibly changing size, copy on write
-	uint32_t rc = _copy_on_write();
-
-	size_t current_alloc_size = _get_alloc_size(current_size);
-	size_t alloc_size;
-	ERR_FAIL_COND_V(!_get_alloc_size_checked(p_size, &alloc_size), ERR_OUT_OF_MEMORY);
+	uint32_t capacity;
+	ERR_FAIL_COND_V(!_get_capacity_checked(p_size, &capacity), ERR_OUT_OF_MEMORY);
 
-	if (p_size > current_size) {
-		if (alloc_size != current_alloc_size) {
-			if (current_size == 0) {
-				// alloc from scratch
-				uint32_t *ptr = (uint32_t *)Memory::alloc_static(alloc_size, true);
-				ERR_FAIL_NULL_V(ptr, ERR_OUT_OF_MEMORY);
-				*(ptr - 1) = 0; // size, currently none
-				new (ptr - 2) SafeNumeric<uint32_t>(1); // refcount
-
-				_ptr = (T *)ptr;
-
-			} else {
-				uint32_t *_ptrnew = (uint32_t *)Memory::realloc_static(_ptr, alloc_size, true);
-				ERR_FAIL_NULL_V(_ptrnew, ERR_OUT_OF_MEMORY);
-				new (_ptrnew - 2) SafeNumeric<uint32_t>(rc); // refcount
-
-				_ptr = (T *)(_ptrnew);
-			}
+	if (!_ptr) {
+		// alloc from scratch
+		_ptr = _allocate(capacity);
+		ERR_FAIL_NULL_V(_ptr, ERR_OUT_OF_MEMORY);
+	} else if (_get_refcount()->get() > 1) {
+		// In use by more than me: copy only the elements that are kept, straight
+		// into a buffer of the new size.
+		current_size = MIN(current_size, p_size);
+		Error err = _unshare(capacity, current_size);
+		ERR_FAIL_COND_V(err, err);
+	} else if ((uint32_t)p_size > *_get_capacity()) {
+		// At least double, in case the capacity was set by reserve().
+		uint32_t grown_capacity;
+		if (_get_capacity_checked(MAX((size_t)p_size, (size_t)*_get_capacity() * 2), &grown_capacity)) {
+			capacity = grown_capacity;
 		}
+		Error err = _reallocate(capacity);
+		ERR_FAIL_COND_V(err, err);
+	}
 
+	if (p_size > current_size) {
 		// construct the newly created elements
-
 		if (!std::is_trivially_constructible<T>::value) {
 			T *elems = _get_data();
 
-			for (int i = *_get_size(); i < p_size; i++) {
+			for (int i = current_size; i < p_size; i++) {
 				memnew_placement(&elems[i], T);
 			}
 		}
 
-		*_get_size() = p_size;
-
 	} else if (p_size < current_size) {
 		if (!std::is_trivially_destructible<T>::value) {
 			// deinitialize no longer needed elements
-			for (uint32_t i = p_size; i < *_get_size(); i++) {
-				T *t = &_get_data()[i];
-				t->~T();
+			T *elems = _get_data();
+
+			for (int i = p_size; i < current_size; i++) {
+				elems[i].~T();
 			}
 		}
+	}
 
-		if (alloc_size != current_alloc_size) {
-			uint32_t *_ptrnew = (uint32_t *)Memory::realloc_static(_ptr, alloc_size, true);
-			ERR_FAIL_NULL_V(_ptrnew, ERR_OUT_OF_MEMORY);
-			new (_ptrnew - 2) SafeNumeric<uint32_t>(rc); // refcount
-
-			_ptr = (T *)(_ptrnew);
-		}
+	*_get_size() = p_size;
 
-		*_get_size() = p_size;
+	// Give the memory back once most of it is unused.
+	if (p_size < current_size && capacity <= *_get_capacity() / 4) {
+		Error err = _reallocate(capacity);
+		ERR_FAIL_COND_V(err, err);
 	}
 
 	return OK;
 }
 
+template <class T>
+Error CowData<T>::reserve(int p_capacity) {
+	ERR_FAIL_COND_V(p_capacity < 0, ERR_INVALID_PARAMETER);
+
+	if (p_capacity <= get_capacity()) {
+		return OK;
+	}
+
+	size_t alloc_size;
+	ERR_FAIL_COND_V(!_get_alloc_size_checked(p_capacity, &alloc_size), ERR_OUT_OF_MEMORY);
+
+	if (!_ptr) {
+		_ptr = _allocate(p_capacity);
+		ERR_FAIL_NULL_V(_ptr, ERR_OUT_OF_MEMORY);
+		return OK;
+	}
+	if (_get_refcount()->get() > 1) {
+		return _unshare(p_capacity, *_get_size());
+	}
+	return _reallocate(p_capacity);
+}
+
 template <class T>
 int CowData<T>::find(const T &p_val, int p_from) const {
 	int ret = -1;
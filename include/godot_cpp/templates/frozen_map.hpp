@@ -0,0 +1,286 @@
+/**************************************************************************/
+/*  frozen_map.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_FROZEN_MAP_HPP
+#define GODOT_FROZEN_MAP_HPP
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/search_array.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/templates/vmap.hpp>
+
+#include <type_traits>
+
+namespace godot {
+
+// Stands for the missing values of FrozenSet.
+struct _FrozenSetValue {};
+
+// Read-optimized sorted map for lookup tables that are built once and queried
+// a lot. The keys are stored on their own, in an EytzingerArray, so a lookup
+// goes through a few cache lines instead of one per step of a binary search.
+// Copies share the frozen data (copy-on-write).
+//
+// Inserting and erasing go to a small sorted buffer, which lookups check first,
+// and freeze() merges it into the frozen data in linear time. Modify in batches
+// and call freeze() after each one: lookups are only fast while the buffer is
+// small.
+template <class K, class V, class Comparator = _DefaultComparator<K>>
+class FrozenMap {
+	static constexpr bool HAS_VALUES = !std::is_same<V, _FrozenSetValue>::value;
+
+	struct Pending {
+		K key;
+		V value;
+		bool erased = false;
+	};
+
+	// In Eytzinger order, keys[0] is unused.
+	Vector<K> keys;
+	// Same order as keys, without the unused one. Empty for sets.
+	Vector<V> values;
+	int frozen_count = 0;
+	// Sorted changes since the last freeze().
+	LocalVector<Pending> pending;
+	int count = 0;
+
+	EytzingerArray<K, Comparator> search;
+
+	int _find_frozen(const K &p_key) const {
+		return search.find(keys.ptr(), frozen_count, p_key);
+	}
+
+	// Position of p_key in pending, or where it would be inserted.
+	int _find_pending(const K &p_key, bool &r_exact) const {
+		int low = 0;
+		int high = pending.size();
+		while (low < high) {
+			const int middle = (low + high) / 2;
+			if (search.compare(pending[middle].key, p_key)) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		r_exact = low < (int)pending.size() && !search.compare(p_key, pending[low].key);
+		return low;
+	}
+
+	void _set_frozen(const LocalVector<K> &p_keys, const LocalVector<V> &p_values) {
+		frozen_count = p_keys.size();
+		keys.resize(frozen_count + 1);
+		EytzingerArray<K, Comparator>::build(p_keys.ptr(), keys.ptrw(), frozen_count);
+		if constexpr (HAS_VALUES) {
+			values.resize(frozen_count);
+			V *w = values.ptrw();
+			EytzingerArray<K, Comparator>::for_each_in_order(frozen_count, [&](int p_index, int p_rank) {
+				w[p_index - 1] = p_values[p_rank];
+			});
+		}
+	}
+
+public:
+	_FORCE_INLINE_ int size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	// Whether there are no changes waiting for freeze().
+	_FORCE_INLINE_ bool is_frozen() const { return pending.is_empty(); }
+
+	// Replaces the contents with p_count pairs, sorted by key without duplicates.
+	void build(const K *p_keys, const V *p_values, int p_count) {
+		ERR_FAIL_COND(p_count < 0);
+		LocalVector<K> sorted_keys;
+		LocalVector<V> sorted_values;
+		sorted_keys.resize(p_count);
+		if constexpr (HAS_VALUES) {
+			sorted_values.resize(p_count);
+		}
+		for (int i = 0; i < p_count; i++) {
+			ERR_FAIL_COND_MSG(i > 0 && !search.compare(p_keys[i - 1], p_keys[i]), "Keys must be sorted and unique.");
+			sorted_keys[i] = p_keys[i];
+			if constexpr (HAS_VALUES) {
+				sorted_values[i] = p_values[i];
+			}
+		}
+
+		pending.clear();
+		_set_frozen(sorted_keys, sorted_values);
+		count = frozen_count;
+	}
+
+	void insert(const K &p_key, const V &p_value) {
+		bool exact;
+		const int pos = _find_pending(p_key, exact);
+		if (exact) {
+			if (pending[pos].erased) {
+				pending[pos].erased = false;
+				count++;
+			}
+			pending[pos].value = p_value;
+			return;
+		}
+		if (!_find_frozen(p_key)) {
+			count++;
+		}
+		pending.insert(pos, Pending{ p_key, p_value, false });
+	}
+
+	void erase(const K &p_key) {
+		bool exact;
+		const int pos = _find_pending(p_key, exact);
+		const bool frozen = _find_frozen(p_key) != 0;
+		if (exact) {
+			if (pending[pos].erased) {
+				return;
+			}
+			count--;
+			if (frozen) {
+				pending[pos].erased = true;
+				pending[pos].value = V();
+			} else {
+				pending.remove_at(pos);
+			}
+		} else if (frozen) {
+			count--;
+			pending.insert(pos, Pending{ p_key, V(), true });
+		}
+	}
+
+	const V *getptr(const K &p_key) const {
+		if (!pending.is_empty()) {
+			bool exact;
+			const int pos = _find_pending(p_key, exact);
+			if (exact) {
+				return pending[pos].erased ? nullptr : &pending[pos].value;
+			}
+		}
+		const int k = _find_frozen(p_key);
+		if (k == 0) {
+			return nullptr;
+		}
+		if constexpr (HAS_VALUES) {
+			return values.ptr() + k - 1;
+		} else {
+			static const V value{};
+			return &value;
+		}
+	}
+
+	_FORCE_INLINE_ bool has(const K &p_key) const {
+		return getptr(p_key) != nullptr;
+	}
+
+	inline const V &operator[](const K &p_key) const {
+		const V *value = getptr(p_key);
+		CRASH_COND(!value);
+		return *value;
+	}
+
+	// Merges the changes made since the last call into the frozen data.
+	void freeze() {
+		if (pending.is_empty()) {
+			return;
+		}
+
+		LocalVector<K> frozen_keys;
+		LocalVector<V> frozen_values;
+		frozen_keys.resize(frozen_count);
+		if constexpr (HAS_VALUES) {
+			frozen_values.resize(frozen_count);
+		}
+		const K *k = keys.ptr();
+		const V *v = values.ptr();
+		EytzingerArray<K, Comparator>::for_each_in_order(frozen_count, [&](int p_index, int p_rank) {
+			frozen_keys[p_rank] = k[p_index];
+			if constexpr (HAS_VALUES) {
+				frozen_values[p_rank] = v[p_index - 1];
+			}
+		});
+
+		LocalVector<K> merged_keys;
+		LocalVector<V> merged_values;
+		merged_keys.reserve(count);
+		if constexpr (HAS_VALUES) {
+			merged_values.reserve(count);
+		}
+		uint32_t i = 0;
+		uint32_t j = 0;
+		while (i < frozen_keys.size() || j < pending.size()) {
+			if (j == pending.size() || (i < frozen_keys.size() && search.compare(frozen_keys[i], pending[j].key))) {
+				merged_keys.push_back(frozen_keys[i]);
+				if constexpr (HAS_VALUES) {
+					merged_values.push_back(frozen_values[i]);
+				}
+				i++;
+				continue;
+			}
+			if (i < frozen_keys.size() && !search.compare(pending[j].key, frozen_keys[i])) {
+				i++; // Replaced or erased.
+			}
+			if (!pending[j].erased) {
+				merged_keys.push_back(pending[j].key);
+				if constexpr (HAS_VALUES) {
+					merged_values.push_back(pending[j].value);
+				}
+			}
+			j++;
+		}
+
+		pending.clear();
+		_set_frozen(merged_keys, merged_values);
+	}
+
+	void clear() {
+		keys.clear();
+		values.clear();
+		frozen_count = 0;
+		pending.clear();
+		count = 0;
+	}
+
+	FrozenMap() {}
+	// VMap is sorted with operator<, which Comparator must agree with.
+	explicit FrozenMap(const VMap<K, V> &p_map) {
+		LocalVector<K> sorted_keys;
+		LocalVector<V> sorted_values;
+		sorted_keys.resize(p_map.size());
+		sorted_values.resize(p_map.size());
+		for (int i = 0; i < p_map.size(); i++) {
+			sorted_keys[i] = p_map.getk(i);
+			sorted_values[i] = p_map.getv(i);
+		}
+		_set_frozen(sorted_keys, sorted_values);
+		count = frozen_count;
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_FROZEN_MAP_HPP
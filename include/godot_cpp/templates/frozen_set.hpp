@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  frozen_set.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_FROZEN_SET_HPP
+#define GODOT_FROZEN_SET_HPP
+
+#include <godot_cpp/templates/frozen_map.hpp>
+#include <godot_cpp/templates/vset.hpp>
+
+namespace godot {
+
+// Read-optimized sorted set, see FrozenMap.
+template <class T, class Comparator = _DefaultComparator<T>>
+class FrozenSet {
+	FrozenMap<T, _FrozenSetValue, Comparator> map;
+
+public:
+	_FORCE_INLINE_ int size() const { return map.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return map.is_empty(); }
+	_FORCE_INLINE_ bool is_frozen() const { return map.is_frozen(); }
+
+	// Replaces the contents with p_count values, sorted without duplicates.
+	void build(const T *p_values, int p_count) { map.build(p_values, nullptr, p_count); }
+
+	_FORCE_INLINE_ void insert(const T &p_value) { map.insert(p_value, _FrozenSetValue()); }
+	_FORCE_INLINE_ void erase(const T &p_value) { map.erase(p_value); }
+	_FORCE_INLINE_ bool has(const T &p_value) const { return map.has(p_value); }
+	_FORCE_INLINE_ void freeze() { map.freeze(); }
+	_FORCE_INLINE_ void clear() { map.clear(); }
+
+	FrozenSet() {}
+	// VSet is sorted with operator<, which Comparator must agree with.
+	explicit FrozenSet(const VSet<T> &p_set) {
+		LocalVector<T> values;
+		values.resize(p_set.size());
+		for (int i = 0; i < p_set.size(); i++) {
+			values[i] = p_set[i];
+		}
+		build(values.ptr(), values.size());
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_FROZEN_SET_HPP
@@ -37,6 +37,7 @@
 #endif
 
 #include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/math_kernels.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/variant/aabb.hpp>
 #include <godot_cpp/variant/node_path.hpp>
@@ -53,6 +54,8 @@
 #include <godot_cpp/variant/vector4.hpp>
 #include <godot_cpp/variant/vector4i.hpp>
 
+#include <cstring>
+
 /**
  * Hashing functions
  */
@@ -298,6 +301,179 @@ static _FORCE_INLINE_ uint64_t hash_make_uint64_t(T p_in) {
 	return _u._u64;
 }
 
+/**
+ * 64-bit hashing
+ *
+ * hash64_buffer() reads 48 bytes per step in three independent lanes, in the
+ * style of wyhash, and from HASH64_STRIPED_MIN_LENGTH bytes on, 64-byte stripes
+ * over eight lanes in the style of XXH3, which MathKernels vectorizes. Results
+ * are the same for every instruction set, but don't match the reference
+ * wyhash or XXH3, and differ on big-endian platforms.
+ */
+
+#define HASH64_SEED 0x9e3779b97f4a7c15
+
+static constexpr uint64_t HASH64_P0 = 0x2d358dccaa6c78a5;
+static constexpr uint64_t HASH64_P1 = 0x8bb84b93962eacc9;
+static constexpr uint64_t HASH64_P2 = 0x4b33a62ed433d4a3;
+static constexpr uint64_t HASH64_P3 = 0x4d5a2da51de1aa47;
+
+static constexpr int64_t HASH64_STRIPED_MIN_LENGTH = 1024;
+static constexpr int64_t HASH64_STRIPE_SIZE = 64;
+static constexpr int64_t HASH64_BLOCK_STRIPES = 16;
+
+// Keys of the striped hash. Stripe i of a block is keyed by 8 words from index
+// i, the accumulators are scrambled with the last 8 words after each block.
+static constexpr uint64_t HASH64_SECRET[24] = {
+	0x1ac046dda8e86e2a, 0xbe2c3b00b1d348c8, 0x9b1a66a95412ff75, 0xc448c2b1f05f7e4c,
+	0xc111ca6b8f6e73c4, 0xb54861920d05b01d, 0x8d61500f4a7bbe16, 0x5e0c25471f89e02e,
+	0x48105a3d28f0e221, 0x2169f8846b637746, 0x3d628782e0c0d863, 0xa5ddb2216078aa40,
+	0xc8119d17f0571101, 0x98e2e2eb8f33280f, 0x8cd1e28860679cc4, 0x9dca6189c923aef3,
+	0x9d8d3071ba4f04c4, 0x5d395ada34220c26, 0xe6de42a441a1e28e, 0x308fbf68cc864f59,
+	0x216a3c81332862f9, 0xbaceca0a77f3132e, 0xdf2a2215339ca69c, 0x3e4c11a103a5d859
+};
+
+// Full 128-bit product of r_a and r_b, low half in r_a, high half in r_b.
+static _FORCE_INLINE_ void hash64_mum(uint64_t &r_a, uint64_t &r_b) {
+#if defined(__SIZEOF_INT128__)
+	const __uint128_t r = (__uint128_t)r_a * r_b;
+	r_a = (uint64_t)r;
+	r_b = (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	r_a = _umul128(r_a, r_b, &r_b);
+#else
+	const uint64_t ha = r_a >> 32, hb = r_b >> 32, la = (uint32_t)r_a, lb = (uint32_t)r_b;
+	const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	const uint64_t t = rl + (rm0 << 32);
+	uint64_t carry = t < rl;
+	const uint64_t lo = t + (rm1 << 32);
+	carry += lo < t;
+	r_a = lo;
+	r_b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+static _FORCE_INLINE_ uint64_t hash64_mix(uint64_t p_a, uint64_t p_b) {
+	hash64_mum(p_a, p_b);
+	return p_a ^ p_b;
+}
+
+static _FORCE_INLINE_ uint64_t hash64_read_64(const uint8_t *p_ptr) {
+	uint64_t v;
+	memcpy(&v, p_ptr, 8);
+	return v;
+}
+
+static _FORCE_INLINE_ uint64_t hash64_read_32(const uint8_t *p_ptr) {
+	uint32_t v;
+	memcpy(&v, p_ptr, 4);
+	return v;
+}
+
+// Integer mixers. Every input bit affects every output bit.
+static _FORCE_INLINE_ uint64_t hash64_one_64(uint64_t p_in, uint64_t p_seed = HASH64_SEED) {
+	uint64_t a = p_in ^ HASH64_P0;
+	uint64_t b = p_seed ^ HASH64_P1;
+	hash64_mum(a, b);
+	return hash64_mix(a ^ HASH64_P0, b ^ HASH64_P1);
+}
+
+static _FORCE_INLINE_ uint64_t hash64_two_64(uint64_t p_a, uint64_t p_b, uint64_t p_seed = HASH64_SEED) {
+	uint64_t a = p_a ^ HASH64_P0;
+	uint64_t b = p_b ^ p_seed ^ HASH64_P1;
+	hash64_mum(a, b);
+	return hash64_mix(a ^ HASH64_P2, b ^ HASH64_P3);
+}
+
+static _FORCE_INLINE_ uint64_t hash64_pack_32(int32_t p_a, int32_t p_b) {
+	return ((uint64_t)(uint32_t)p_a << 32) | (uint32_t)p_b;
+}
+
+// Folds a 64-bit hash for 32-bit consumers like HashMap.
+static _FORCE_INLINE_ uint32_t hash64_to_32(uint64_t p_hash) {
+	return (uint32_t)(p_hash ^ (p_hash >> 32));
+}
+
+static inline uint64_t hash64_buffer_striped(const uint8_t *p_data, int64_t p_len, uint64_t p_seed) {
+	uint64_t acc[8];
+	for (int i = 0; i < 8; i++) {
+		acc[i] = HASH64_SECRET[i] ^ p_seed;
+	}
+
+	const int64_t block_size = HASH64_STRIPE_SIZE * HASH64_BLOCK_STRIPES;
+	const uint8_t *p = p_data;
+	int64_t remaining = p_len;
+	while (remaining > block_size) {
+		MathKernels::hash64_stripes(acc, p, HASH64_SECRET, HASH64_BLOCK_STRIPES);
+		for (int i = 0; i < 8; i++) {
+			acc[i] ^= acc[i] >> 47;
+			acc[i] ^= HASH64_SECRET[16 + i];
+			acc[i] *= 0x9e3779b1;
+		}
+		p += block_size;
+		remaining -= block_size;
+	}
+	// The last stripe always has its own key, and may overlap the one before.
+	MathKernels::hash64_stripes(acc, p, HASH64_SECRET, (remaining - 1) / HASH64_STRIPE_SIZE);
+	MathKernels::hash64_stripes(acc, p_data + p_len - HASH64_STRIPE_SIZE, HASH64_SECRET + 9, 1);
+
+	uint64_t h = (uint64_t)p_len * HASH64_P0 ^ p_seed;
+	for (int i = 0; i < 4; i++) {
+		h += hash64_mix(acc[2 * i] ^ HASH64_SECRET[11 + 2 * i], acc[2 * i + 1] ^ HASH64_SECRET[12 + 2 * i]);
+	}
+	h ^= h >> 37;
+	h *= 0x165667919e3779f9;
+	return h ^ (h >> 32);
+}
+
+static inline uint64_t hash64_buffer(const void *p_data, int64_t p_len, uint64_t p_seed = HASH64_SEED) {
+	if (p_len >= HASH64_STRIPED_MIN_LENGTH) {
+		return hash64_buffer_striped((const uint8_t *)p_data, p_len, p_seed);
+	}
+
+	const uint8_t *p = (const uint8_t *)p_data;
+	uint64_t seed = p_seed ^ hash64_mix(p_seed ^ HASH64_P0, HASH64_P1);
+	uint64_t a;
+	uint64_t b;
+	if (likely(p_len <= 16)) {
+		if (likely(p_len >= 4)) {
+			const int64_t offset = (p_len >> 3) << 2;
+			a = (hash64_read_32(p) << 32) | hash64_read_32(p + offset);
+			b = (hash64_read_32(p + p_len - 4) << 32) | hash64_read_32(p + p_len - 4 - offset);
+		} else if (likely(p_len > 0)) {
+			a = ((uint64_t)p[0] << 16) | ((uint64_t)p[p_len >> 1] << 8) | p[p_len - 1];
+			b = 0;
+		} else {
+			a = b = 0;
+		}
+	} else {
+		int64_t i = p_len;
+		if (unlikely(i > 48)) {
+			uint64_t see1 = seed;
+			uint64_t see2 = seed;
+			do {
+				seed = hash64_mix(hash64_read_64(p) ^ HASH64_P1, hash64_read_64(p + 8) ^ seed);
+				see1 = hash64_mix(hash64_read_64(p + 16) ^ HASH64_P2, hash64_read_64(p + 24) ^ see1);
+				see2 = hash64_mix(hash64_read_64(p + 32) ^ HASH64_P3, hash64_read_64(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (likely(i > 48));
+			seed ^= see1 ^ see2;
+		}
+		while (unlikely(i > 16)) {
+			seed = hash64_mix(hash64_read_64(p) ^ HASH64_P1, hash64_read_64(p + 8) ^ seed);
+			i -= 16;
+			p += 16;
+		}
+		a = hash64_read_64(p + i - 16);
+		b = hash64_read_64(p + i - 8);
+	}
+	a ^= HASH64_P1;
+	b ^= seed;
+	hash64_mum(a, b);
+	return hash64_mix(a ^ HASH64_P0 ^ (uint64_t)p_len, b ^ HASH64_P1);
+}
+
 template <class T>
 class Ref;
 
@@ -310,6 +486,7 @@ struct HashMapHasherDefault {
 	static _FORCE_INLINE_ uint32_t hash(const Ref<T> &p_ref) { return hash_one_uint64((uint64_t)p_ref.operator->()); }
 
 	static _FORCE_INLINE_ uint32_t hash(const String &p_string) { return p_string.hash(); }
+	static _FORCE_INLINE_ uint32_t hash(const CharString &p_string) { return p_string.hash(); }
 	static _FORCE_INLINE_ uint32_t hash(const char *p_cstr) { return hash_djb2(p_cstr); }
 	static _FORCE_INLINE_ uint32_t hash(const wchar_t p_wchar) { return hash_fmix32(p_wchar); }
 	static _FORCE_INLINE_ uint32_t hash(const char16_t p_uchar) { return hash_fmix32(p_uchar); }
@@ -390,6 +567,36 @@ struct HashMapHasherDefault {
 	}
 };
 
+// Hasher for HashMap/HashSet (e.g. `HashMap<Vector3i, int, HashMapHasherFast>`)
+// built on the 64-bit functions: strong mixing of integer vectors and IDs, and
+// buffer hashing that doesn't go through the engine.
+struct HashMapHasherFast {
+	template <class T>
+	static _FORCE_INLINE_ uint32_t hash(const T *p_pointer) { return hash64_to_32(hash64_one_64((uint64_t)p_pointer)); }
+
+	static _FORCE_INLINE_ uint32_t hash(const uint64_t p_int) { return hash64_to_32(hash64_one_64(p_int)); }
+	static _FORCE_INLINE_ uint32_t hash(const int64_t p_int) { return hash64_to_32(hash64_one_64(p_int)); }
+	static _FORCE_INLINE_ uint32_t hash(const uint32_t p_int) { return hash64_to_32(hash64_one_64(p_int)); }
+	static _FORCE_INLINE_ uint32_t hash(const int32_t p_int) { return hash64_to_32(hash64_one_64((uint32_t)p_int)); }
+	static _FORCE_INLINE_ uint32_t hash(const RID &p_rid) { return hash64_to_32(hash64_one_64(p_rid.get_id())); }
+	static _FORCE_INLINE_ uint32_t hash(const ObjectID &p_id) { return hash64_to_32(hash64_one_64(p_id)); }
+	static _FORCE_INLINE_ uint32_t hash(const Vector2i &p_vec) {
+		return hash64_to_32(hash64_one_64(hash64_pack_32(p_vec.x, p_vec.y)));
+	}
+	static _FORCE_INLINE_ uint32_t hash(const Vector3i &p_vec) {
+		return hash64_to_32(hash64_two_64(hash64_pack_32(p_vec.x, p_vec.y), (uint32_t)p_vec.z));
+	}
+	static _FORCE_INLINE_ uint32_t hash(const Vector4i &p_vec) {
+		return hash64_to_32(hash64_two_64(hash64_pack_32(p_vec.x, p_vec.y), hash64_pack_32(p_vec.z, p_vec.w)));
+	}
+	static _FORCE_INLINE_ uint32_t hash(const Rect2i &p_rect) {
+		return hash64_to_32(hash64_two_64(hash64_pack_32(p_rect.position.x, p_rect.position.y), hash64_pack_32(p_rect.size.x, p_rect.size.y)));
+	}
+	static _FORCE_INLINE_ uint32_t hash(const char *p_cstr) { return hash64_to_32(hash64_buffer(p_cstr, strlen(p_cstr))); }
+	static _FORCE_INLINE_ uint32_t hash(const CharString &p_string) { return p_string.hash(); }
+	static _FORCE_INLINE_ uint32_t hash(const PackedByteArray &p_array) { return hash64_to_32(hash64_buffer(p_array.ptr(), p_array.size())); }
+};
+
 template <typename T>
 struct HashMapComparatorDefault {
 	static bool compare(const T &p_lhs, const T &p_rhs) {
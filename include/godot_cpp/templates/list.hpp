@@ -33,6 +33,8 @@
 
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/paged_allocator.hpp>
+#include <godot_cpp/templates/radix_sort.hpp>
 #include <godot_cpp/templates/sort_array.hpp>
 
 /**
@@ -250,6 +252,9 @@ private:
 	_Data *_data = nullptr;
 
 public:
+	// Largest allocation made through A.
+	static constexpr size_t NODE_SIZE = sizeof(Element) > sizeof(_Data) ? sizeof(Element) : sizeof(_Data);
+
 	/**
 	 * return a const iterator to the beginning of the list.
 	 */
@@ -705,7 +710,24 @@ public:
 	void sort_custom() {
 		// this version uses auxiliary memory for speed.
 		// if you don't want to use auxiliary memory, use the in_place version
+		_sort_auxiliary([](Element **p_elements, int p_count) {
+			SortArray<Element *, AuxiliaryComparator<C>> sort;
+			sort.sort(p_elements, p_count);
+		});
+	}
 
+	// Sorts by the key p_key returns for each value, see Vector::sort_custom().
+	template <class K>
+	void sort_custom(const K &p_key) {
+		_sort_auxiliary([&p_key](Element **p_elements, int p_count) {
+			const auto element_key = [&p_key](const Element *p_element) { return p_key(p_element->value); };
+			sort_by_key(p_elements, p_count, element_key);
+		});
+	}
+
+	// Sorts an array of the elements with p_sort, then relinks them in that order.
+	template <class S>
+	void _sort_auxiliary(const S &p_sort) {
 		int s = size();
 		if (s < 2) {
 			return;
@@ -719,8 +741,7 @@ public:
 			idx++;
 		}
 
-		SortArray<Element *, AuxiliaryComparator<C>> sort;
-		sort.sort(aux_buffer, s);
+		p_sort(aux_buffer, s);
 
 		_data->first = aux_buffer[0];
 		aux_buffer[0]->prev_ptr = nullptr;
@@ -764,6 +785,10 @@ public:
 	}
 };
 
+// List with its nodes in pages shared by all the lists of the same node size.
+template <class T, bool THREAD_SAFE = true>
+using PagedList = List<T, PagedNodeAllocator<List<T>::NODE_SIZE, THREAD_SAFE>>;
+
 } // namespace godot
 
 #endif // GODOT_LIST_HPP
@@ -33,7 +33,9 @@
 
 #include "godot_cpp/core/error_macros.hpp"
 #include "godot_cpp/core/memory.hpp"
+#include "godot_cpp/templates/radix_sort.hpp"
 #include "godot_cpp/templates/sort_array.hpp"
+#include "godot_cpp/templates/span.hpp"
 #include "godot_cpp/templates/vector.hpp"
 
 #include <initializer_list>
@@ -59,6 +61,9 @@ public:
 		return data;
 	}
 
+	_FORCE_INLINE_ Span<T> span() const { return Span<T>(data, count); }
+	_FORCE_INLINE_ operator Span<T>() const { return span(); }
+
 	_FORCE_INLINE_ void push_back(T p_elem) {
 		if (unlikely(count == capacity)) {
 			if (capacity == 0) {
@@ -66,7 +71,7 @@ public:
 			} else {
 				capacity <<= 1;
 			}
-			data = (T *)memrealloc(data, capacity * sizeof(T));
+			data = (T *)Memory::realloc_static(data, capacity * sizeof(T), false, GODOT_MEMORY_TAG(LocalVector));
 			CRASH_COND_MSG(!data, "Out of memory");
 		}
 
@@ -129,7 +134,7 @@ public:
 		p_size = tight ? p_size : nearest_power_of_2_templated(p_size);
 		if (p_size > capacity) {
 			capacity = p_size;
-			data = (T *)memrealloc(data, capacity * sizeof(T));
+			data = (T *)Memory::realloc_static(data, capacity * sizeof(T), false, GODOT_MEMORY_TAG(LocalVector));
 			CRASH_COND_MSG(!data, "Out of memory");
 		}
 	}
@@ -151,7 +156,7 @@ public:
 				while (capacity < p_size) {
 					capacity <<= 1;
 				}
-				data = (T *)memrealloc(data, capacity * sizeof(T));
+				data = (T *)Memory::realloc_static(data, capacity * sizeof(T), false, GODOT_MEMORY_TAG(LocalVector));
 				CRASH_COND_MSG(!data, "Out of memory");
 			}
 			if constexpr (!std::is_trivially_constructible<T>::value && !force_trivial) {
@@ -268,8 +273,24 @@ public:
 		sorter.sort(data, len);
 	}
 
+	// Sorts by the key p_key returns for each element, compared with operator<,
+	// e.g. `sort_custom([](const Entry &p_entry) { return p_entry.score; })`.
+	// Integer, enum and floating-point keys use a radix sort on large arrays.
+	template <class K>
+	void sort_custom(const K &p_key) {
+		if (count == 0) {
+			return;
+		}
+
+		sort_by_key(data, count, p_key);
+	}
+
 	void sort() {
-		sort_custom<_DefaultComparator<T>>();
+		if constexpr (RadixSort<T>::KEY_SUPPORTED) {
+			sort_custom(_IdentityKey<T>());
+		} else {
+			sort_custom<_DefaultComparator<T>>();
+		}
 	}
 
 	void ordered_insert(T p_val) {
@@ -0,0 +1,257 @@
+/**************************************************************************/
+/*  paged_allocator.hpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PAGED_ALLOCATOR_HPP
+#define GODOT_PAGED_ALLOCATOR_HPP
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace godot {
+
+// Hands out objects of type T from pages of p_page_size slots, each page being a
+// single engine allocation. Freed slots are kept in an intrusive free list and
+// reused before the current page is extended, so churn doesn't reach the engine
+// allocator at all. Pages are only released by reset() or the destructor.
+//
+// With THREAD_SAFE, alloc() and free() are guarded by a SpinLock and can be
+// called from any thread. Otherwise, the allocator must only be used from one
+// thread at a time.
+//
+// Also usable as the element allocator of HashMap, through new_allocation()
+// and delete_allocation().
+template <class T, bool THREAD_SAFE = false, uint32_t DEFAULT_PAGE_SIZE = 4096>
+class PagedAllocator {
+	union Slot {
+		Slot *next_free;
+		alignas(T) uint8_t data[sizeof(T)];
+	};
+
+	// Pages are chained through a header placed before their slots.
+	struct Page {
+		Page *next;
+	};
+	static constexpr size_t PAGE_HEADER_SIZE = (sizeof(Page) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+	static_assert(alignof(Slot) <= alignof(std::max_align_t), "Over-aligned types are not supported by PagedAllocator.");
+
+	Page *pages = nullptr;
+	Slot *free_list = nullptr;
+	// Slots of the last page which were never handed out.
+	Slot *page_cursor = nullptr;
+	Slot *page_end = nullptr;
+	uint32_t page_size = 0;
+	uint32_t page_count = 0;
+	uint64_t allocation_count = 0;
+
+	SpinLock spin_lock;
+
+	_FORCE_INLINE_ void _lock() {
+		if constexpr (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+	}
+
+	_FORCE_INLINE_ void _unlock() {
+		if constexpr (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+	}
+
+	Slot *_alloc_slot() {
+		if (free_list) {
+			Slot *slot = free_list;
+			free_list = slot->next_free;
+			return slot;
+		}
+		if (unlikely(page_cursor == page_end)) {
+			Page *page = (Page *)Memory::alloc_static(PAGE_HEADER_SIZE + sizeof(Slot) * page_size, false, GODOT_MEMORY_TAG(PagedAllocator));
+			CRASH_COND_MSG(!page, "Out of memory");
+			page->next = pages;
+			pages = page;
+			page_count++;
+			page_cursor = (Slot *)((uint8_t *)page + PAGE_HEADER_SIZE);
+			page_end = page_cursor + page_size;
+		}
+		return page_cursor++;
+	}
+
+	void _free_pages() {
+		while (pages) {
+			Page *next = pages->next;
+			Memory::free_static(pages);
+			pages = next;
+		}
+		free_list = nullptr;
+		page_cursor = nullptr;
+		page_end = nullptr;
+		page_count = 0;
+		allocation_count = 0;
+	}
+
+public:
+	template <class... Args>
+	T *alloc(Args &&...p_args) {
+		_lock();
+		Slot *slot = _alloc_slot();
+		allocation_count++;
+		_unlock();
+		return memnew_placement(slot->data, T(std::forward<Args>(p_args)...));
+	}
+
+	void free(T *p_mem) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_mem->~T();
+		}
+		Slot *slot = (Slot *)p_mem;
+		_lock();
+		slot->next_free = free_list;
+		free_list = slot;
+		allocation_count--;
+		_unlock();
+	}
+
+	template <class... Args>
+	_FORCE_INLINE_ T *new_allocation(Args &&...p_args) { return alloc(std::forward<Args>(p_args)...); }
+	_FORCE_INLINE_ void delete_allocation(T *p_mem) { free(p_mem); }
+
+	// Releases all pages at once. Objects still allocated are not destroyed, and
+	// must not be used anymore: unless p_allow_unfreed, that is reported as an error.
+	void reset(bool p_allow_unfreed = false) {
+		_lock();
+		if (!p_allow_unfreed && allocation_count > 0) {
+			ERR_PRINT("Paged allocator reset while objects are still allocated.");
+		}
+		_free_pages();
+		_unlock();
+	}
+
+	// Number of slots per page, for the next pages allocated.
+	void configure(uint32_t p_page_size) {
+		ERR_FAIL_COND(p_page_size == 0);
+		_lock();
+		page_size = p_page_size;
+		_unlock();
+	}
+
+	uint64_t get_allocation_count() const { return allocation_count; }
+	uint32_t get_page_count() const { return page_count; }
+
+	PagedAllocator(uint32_t p_page_size = DEFAULT_PAGE_SIZE) {
+		configure(p_page_size);
+	}
+
+	PagedAllocator(const PagedAllocator &) = delete;
+	PagedAllocator &operator=(const PagedAllocator &) = delete;
+
+	~PagedAllocator() {
+		reset();
+	}
+};
+
+// Every pool of PagedNodeAllocator registers itself here. Pools are static and
+// never destroyed: containers with static storage may free their nodes after
+// the pool would have been, and after the extension is deinitialized, when the
+// engine's allocator is gone. GDExtensionBinding calls release() instead once
+// the last initialization level is deinitialized, which frees the pages of the
+// pools with no nodes left. Pools still holding nodes keep their pages, which
+// are leaked.
+class PagedNodeAllocatorPools {
+public:
+	struct Pool {
+		Pool *next = nullptr;
+		void (*release)(Pool *p_pool) = nullptr;
+	};
+
+	static void add(Pool *p_pool);
+	static void release();
+};
+
+// Static allocator interface (alloc(size)/free(ptr), like DefaultAllocator) over a
+// PagedAllocator of SLOT_SIZE-byte slots shared by the whole library, for the
+// containers taking an allocator class: List, RBMap and RBSet. Nodes of different
+// containers with the same slot size share pages. See PagedNodeAllocatorPools for
+// when the pages are released.
+//
+// The shared pool is thread-safe by default, since any container of the same
+// slot size may use it from any thread. With THREAD_SAFE = false, every container
+// using that slot size must be confined to a single thread.
+template <size_t SLOT_SIZE, bool THREAD_SAFE = true>
+class PagedNodeAllocator {
+	struct Slot {
+		alignas(std::max_align_t) uint8_t data[SLOT_SIZE];
+	};
+	typedef PagedAllocator<Slot, THREAD_SAFE> Allocator;
+
+	// The allocator is constructed in place and never destroyed, so the pool
+	// has no destructor to run at exit.
+	struct Pool : PagedNodeAllocatorPools::Pool {
+		alignas(Allocator) uint8_t allocator[sizeof(Allocator)];
+
+		_FORCE_INLINE_ Allocator &get_allocator() { return *(Allocator *)allocator; }
+
+		static void _release(PagedNodeAllocatorPools::Pool *p_pool) {
+			Allocator &pool_allocator = static_cast<Pool *>(p_pool)->get_allocator();
+			if (pool_allocator.get_allocation_count() == 0) {
+				pool_allocator.reset();
+			} else {
+				WARN_PRINT("Nodes of a PagedNodeAllocator are still allocated after the extension was deinitialized, their pages are leaked.");
+			}
+		}
+
+		Pool() {
+			memnew_placement(allocator, Allocator);
+			release = &_release;
+			PagedNodeAllocatorPools::add(this);
+		}
+	};
+	static_assert(std::is_trivially_destructible_v<Pool>);
+
+public:
+	static Allocator &get_pool() {
+		static Pool pool;
+		return pool.get_allocator();
+	}
+
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) {
+		CRASH_COND_MSG(p_memory > SLOT_SIZE, "Allocation too large for the slots of this PagedNodeAllocator.");
+		return get_pool().alloc();
+	}
+	_FORCE_INLINE_ static void free(void *p_ptr) { get_pool().free((Slot *)p_ptr); }
+};
+
+} // namespace godot
+
+#endif // GODOT_PAGED_ALLOCATOR_HPP
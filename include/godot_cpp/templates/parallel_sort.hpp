@@ -0,0 +1,242 @@
+/**************************************************************************/
+/*  parallel_sort.hpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PARALLEL_SORT_HPP
+#define GODOT_PARALLEL_SORT_HPP
+
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/radix_sort.hpp>
+#include <godot_cpp/templates/sort_array.hpp>
+
+#include <utility>
+
+namespace godot {
+
+// Sorts large arrays across WorkerThreadPool tasks: each task sorts a chunk
+// with SortArray, then the chunks are merged pairwise in rounds. Every round is
+// split into equal output segments, one per task, so all tasks stay busy until
+// the last merge. Arrays smaller than MIN_ELEMENTS are sorted on the calling
+// thread. Like SortArray, the sort isn't stable.
+//
+// Needs a scratch copy of the array. Don't use it from a WorkerThreadPool task.
+template <class T, class Comparator = _DefaultComparator<T>>
+class ParallelSortArray {
+	static constexpr int MAX_TASKS = 64;
+	static constexpr int MIN_TASK_ELEMENTS = 1 << 14;
+
+	struct Task {
+		const ParallelSortArray *sorter = nullptr;
+		T *array = nullptr;
+		T *scratch = nullptr;
+		int len = 0;
+		int run = 0; // Length of the sorted runs.
+		int segment = 0; // Output elements per task.
+		bool sorted_to_scratch = false;
+		T *src = nullptr;
+		T *dst = nullptr;
+		// Whether dst is the scratch buffer before anything was moved to it.
+		bool dst_uninitialized = false;
+		// Where each segment starts in the run from the left of its pair.
+		int splits[MAX_TASKS + 1];
+
+		static void sort_chunk(void *p_userdata, uint32_t p_index) {
+			const Task *task = static_cast<const Task *>(p_userdata);
+			const int begin = p_index * task->run;
+			const int end = MIN(begin + task->run, task->len);
+			SortArray<T, Comparator> sort;
+			sort.compare = task->sorter->compare;
+			sort.sort_range(begin, end, task->array);
+			if (task->sorted_to_scratch) {
+				for (int i = begin; i < end; i++) {
+					memnew_placement(&task->scratch[i], T(std::move(task->array[i])));
+				}
+			}
+		}
+
+		static void merge_segment(void *p_userdata, uint32_t p_index) {
+			const Task *task = static_cast<const Task *>(p_userdata);
+			task->sorter->_merge_segment(*task, p_index);
+		}
+	};
+
+	// Number of elements among the first p_count of the merge of p_a and p_b
+	// that come from p_a. Equal elements are taken from p_a first.
+	int _co_rank(int p_count, const T *p_a, int p_a_len, const T *p_b, int p_b_len) const {
+		int low = MAX(0, p_count - p_b_len);
+		int high = MIN(p_count, p_a_len);
+		while (low < high) {
+			const int i = low + (high - low) / 2;
+			if (!compare(p_b[p_count - i - 1], p_a[i])) {
+				low = i + 1;
+			} else {
+				high = i;
+			}
+		}
+		return low;
+	}
+
+	_FORCE_INLINE_ static void _move_to(T *p_dst, T &p_value, bool p_construct) {
+		if (p_construct) {
+			memnew_placement(p_dst, T(std::move(p_value)));
+		} else {
+			*p_dst = std::move(p_value);
+		}
+	}
+
+	int _split(const Task &p_task, int p_output) const {
+		const int64_t pair = p_output - p_output % (int64_t(p_task.run) * 2);
+		const int a_len = MIN(p_task.run, p_task.len - pair);
+		const int b_len = MIN(p_task.run, p_task.len - pair - a_len);
+		const T *a = p_task.src + pair;
+		return _co_rank(p_output - pair, a, a_len, a + a_len, b_len);
+	}
+
+	void _merge_segment(const Task &p_task, int p_index) const {
+		const int64_t pair_size = int64_t(p_task.run) * 2;
+		const int begin = MIN(int64_t(p_index) * p_task.segment, p_task.len);
+		const int end = MIN(int64_t(begin) + p_task.segment, p_task.len);
+
+		for (int64_t pair = begin - begin % pair_size; pair < end; pair += pair_size) {
+			const int a_len = MIN(p_task.run, p_task.len - pair);
+			const int b_len = MIN(p_task.run, p_task.len - pair - a_len);
+			T *a = p_task.src + pair;
+			T *b = a + a_len;
+
+			int i = 0;
+			int d = 0;
+			if (pair <= begin) {
+				i = p_task.splits[p_index];
+				d = begin - pair;
+			}
+			int i_end = a_len;
+			int d_end = a_len + b_len;
+			if (pair + d_end > end) {
+				i_end = p_task.splits[p_index + 1];
+				d_end = end - pair;
+			}
+			int j = d - i;
+			const int j_end = d_end - i_end;
+
+			const bool construct = p_task.dst_uninitialized;
+			T *out = p_task.dst + pair + d;
+			while (i < i_end && j < j_end) {
+				if (compare(b[j], a[i])) {
+					_move_to(out++, b[j++], construct);
+				} else {
+					_move_to(out++, a[i++], construct);
+				}
+			}
+			while (i < i_end) {
+				_move_to(out++, a[i++], construct);
+			}
+			while (j < j_end) {
+				_move_to(out++, b[j++], construct);
+			}
+		}
+	}
+
+public:
+	static constexpr int MIN_ELEMENTS = 1 << 16;
+
+	Comparator compare;
+
+	void sort(T *p_array, int p_len) const {
+		if (p_len < MIN_ELEMENTS) {
+			SortArray<T, Comparator> sort;
+			sort.compare = compare;
+			sort.sort(p_array, p_len);
+			return;
+		}
+
+		Task task;
+		task.sorter = this;
+		task.array = p_array;
+		task.len = p_len;
+		const int tasks = MIN(MAX_TASKS, p_len / MIN_TASK_ELEMENTS);
+		task.run = (p_len + tasks - 1) / tasks;
+		task.segment = task.run;
+
+		int rounds = 0;
+		for (int64_t run = task.run; run < p_len; run *= 2) {
+			rounds++;
+		}
+
+		// Raw storage, so T needs no default constructor, as with SortArray. Each
+		// element is move constructed the first time it's written: when the chunks
+		// are sorted, or by the first round of merges.
+		task.scratch = (T *)Memory::alloc_static(sizeof(T) * p_len, false, GODOT_MEMORY_TAG(ParallelSortArray));
+		ERR_FAIL_NULL(task.scratch);
+		// Start from the buffer that makes the last round write to p_array.
+		task.sorted_to_scratch = rounds % 2 == 1;
+		task.src = task.sorted_to_scratch ? task.scratch : p_array;
+		task.dst = task.sorted_to_scratch ? p_array : task.scratch;
+		task.dst_uninitialized = !task.sorted_to_scratch;
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		int64_t group = pool->add_native_group_task(&Task::sort_chunk, &task, tasks, -1, true);
+		pool->wait_for_group_task_completion(group);
+
+		for (int round = 0; round < rounds; round++) {
+			// Split points are found before any element is moved.
+			for (int i = 0; i <= tasks; i++) {
+				task.splits[i] = _split(task, MIN(int64_t(i) * task.segment, p_len));
+			}
+			group = pool->add_native_group_task(&Task::merge_segment, &task, tasks, -1, true);
+			pool->wait_for_group_task_completion(group);
+
+			task.run = MIN(int64_t(task.run) * 2, p_len);
+			SWAP(task.src, task.dst);
+			task.dst_uninitialized = false;
+		}
+
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (int i = 0; i < p_len; i++) {
+				task.scratch[i].~T();
+			}
+		}
+		Memory::free_static(task.scratch);
+	}
+};
+
+// ParallelSortArray sorting by the key p_key returns for each element, compared
+// with operator<.
+template <class T, class KeyGetter>
+void parallel_sort_by_key(T *p_array, int p_len, const KeyGetter &p_key) {
+	ParallelSortArray<T, _KeyComparator<T, KeyGetter>> sorter;
+	sorter.compare.key = &p_key;
+	sorter.sort(p_array, p_len);
+}
+
+} // namespace godot
+
+#endif // GODOT_PARALLEL_SORT_HPP
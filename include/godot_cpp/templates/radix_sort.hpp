@@ -0,0 +1,243 @@
+/**************************************************************************/
+/*  radix_sort.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_RADIX_SORT_HPP
+#define GODOT_RADIX_SORT_HPP
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/sort_array.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace godot {
+
+// Maps keys to unsigned integers with the same order, which are sorted one byte
+// at a time. Floating-point keys order -0.0 before 0.0, and NaNs at both ends
+// depending on their sign.
+template <class K, class Enable = void>
+struct _RadixKey {
+	static constexpr bool SUPPORTED = false;
+	using Bits = uint8_t;
+};
+
+template <class K>
+struct _RadixKey<K, std::enable_if_t<std::is_integral<K>::value && !std::is_same<K, bool>::value>> {
+	static constexpr bool SUPPORTED = true;
+	using Bits = std::make_unsigned_t<K>;
+
+	_FORCE_INLINE_ static Bits get(K p_key) {
+		if constexpr (std::is_signed<K>::value) {
+			return Bits(p_key) ^ (Bits(1) << (sizeof(K) * 8 - 1));
+		} else {
+			return p_key;
+		}
+	}
+};
+
+template <class K>
+struct _RadixKey<K, std::enable_if_t<std::is_enum<K>::value>> {
+	static constexpr bool SUPPORTED = true;
+	using Underlying = _RadixKey<std::underlying_type_t<K>>;
+	using Bits = typename Underlying::Bits;
+
+	_FORCE_INLINE_ static Bits get(K p_key) {
+		return Underlying::get(std::underlying_type_t<K>(p_key));
+	}
+};
+
+template <class K>
+struct _RadixKey<K, std::enable_if_t<std::is_floating_point<K>::value && (sizeof(K) == 4 || sizeof(K) == 8)>> {
+	static constexpr bool SUPPORTED = true;
+	using Bits = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+
+	_FORCE_INLINE_ static Bits get(K p_key) {
+		Bits bits;
+		memcpy(&bits, &p_key, sizeof(K));
+		const Bits sign = Bits(1) << (sizeof(K) * 8 - 1);
+		// Negative values: flip everything so larger magnitudes come first.
+		return (bits & sign) ? ~bits : (bits | sign);
+	}
+};
+
+template <class T>
+struct _IdentityKey {
+	_FORCE_INLINE_ const T &operator()(const T &p_value) const { return p_value; }
+};
+
+// Compares elements by the key KeyGetter returns for them, for SortArray.
+template <class T, class KeyGetter>
+struct _KeyComparator {
+	const KeyGetter *key = nullptr;
+	_FORCE_INLINE_ bool operator()(const T &a, const T &b) const { return (*key)(a) < (*key)(b); }
+};
+
+// Stable LSD radix sort of elements by an integer, enum or floating-point key
+// returned by KeyGetter. Passes on a byte that is the same for all the keys are
+// skipped. Small trivially copyable elements are moved around on each pass,
+// others are sorted as (key, index) pairs and permuted once at the end.
+template <class T, class KeyGetter = _IdentityKey<T>>
+class RadixSort {
+	using Key = std::decay_t<decltype(std::declval<const KeyGetter &>()(std::declval<const T &>()))>;
+	using Radix = _RadixKey<Key>;
+
+public:
+	static constexpr bool KEY_SUPPORTED = Radix::SUPPORTED;
+
+private:
+	using Bits = typename Radix::Bits;
+	static constexpr int PASSES = sizeof(Bits);
+
+	struct Entry {
+		Bits bits;
+		uint32_t index;
+	};
+
+	static constexpr bool SORT_IN_PLACE = std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(Entry);
+
+	// Sorts p_array by the bits p_get returns for each element, using p_scratch
+	// as the other buffer. The result is in p_array.
+	template <class U, class G>
+	static void _sort_passes(U *p_array, U *p_scratch, int p_len, const G &p_get) {
+		uint32_t counts[PASSES][256] = {};
+		for (int i = 0; i < p_len; i++) {
+			const Bits bits = p_get(p_array[i]);
+			for (int pass = 0; pass < PASSES; pass++) {
+				counts[pass][(bits >> (pass * 8)) & 0xff]++;
+			}
+		}
+
+		U *src = p_array;
+		U *dst = p_scratch;
+		const Bits first = p_get(p_array[0]);
+		for (int pass = 0; pass < PASSES; pass++) {
+			const int shift = pass * 8;
+			uint32_t *offsets = counts[pass];
+			if (offsets[(first >> shift) & 0xff] == uint32_t(p_len)) {
+				continue; // All the keys have the same byte here.
+			}
+
+			uint32_t sum = 0;
+			for (int digit = 0; digit < 256; digit++) {
+				const uint32_t count = offsets[digit];
+				offsets[digit] = sum;
+				sum += count;
+			}
+
+			for (int i = 0; i < p_len; i++) {
+				dst[offsets[(p_get(src[i]) >> shift) & 0xff]++] = src[i];
+			}
+			SWAP(src, dst);
+		}
+
+		if (src != p_array) {
+			memcpy((void *)p_array, (const void *)src, p_len * sizeof(U));
+		}
+	}
+
+public:
+	KeyGetter key;
+
+	RadixSort() {}
+	explicit RadixSort(const KeyGetter &p_key) :
+			key(p_key) {}
+
+	void sort(T *p_array, int p_len) const {
+		static_assert(KEY_SUPPORTED, "RadixSort needs integer, enum or floating-point keys.");
+		if (p_len < 2) {
+			return;
+		}
+
+		if constexpr (SORT_IN_PLACE) {
+			T *scratch = (T *)Memory::alloc_static(p_len * sizeof(T));
+			ERR_FAIL_NULL(scratch);
+			_sort_passes(p_array, scratch, p_len, [this](const T &p_value) { return Radix::get(key(p_value)); });
+			Memory::free_static(scratch);
+		} else {
+			Entry *entries = (Entry *)Memory::alloc_static(p_len * 2 * sizeof(Entry));
+			ERR_FAIL_NULL(entries);
+			for (int i = 0; i < p_len; i++) {
+				entries[i] = { Radix::get(key(p_array[i])), uint32_t(i) };
+			}
+			_sort_passes(entries, entries + p_len, p_len, [](const Entry &p_entry) { return p_entry.bits; });
+
+			// Element i goes to the position of its index in entries. Follow
+			// each cycle of the permutation, marking visited entries.
+			uint32_t *indices = (uint32_t *)(entries + p_len);
+			for (int i = 0; i < p_len; i++) {
+				indices[i] = entries[i].index;
+			}
+			for (int i = 0; i < p_len; i++) {
+				if (indices[i] == uint32_t(i)) {
+					continue;
+				}
+				T value = std::move(p_array[i]);
+				uint32_t hole = i;
+				while (indices[hole] != uint32_t(i)) {
+					const uint32_t next = indices[hole];
+					p_array[hole] = std::move(p_array[next]);
+					indices[hole] = hole;
+					hole = next;
+				}
+				p_array[hole] = std::move(value);
+				indices[hole] = hole;
+			}
+			Memory::free_static(entries);
+		}
+	}
+};
+
+// Below this, clearing the histograms costs more than SortArray.
+static constexpr int RADIX_SORT_MIN_ELEMENTS = 1024;
+
+// Sorts p_array by the key p_key returns for each element. Integer, enum and
+// floating-point keys use RadixSort on arrays of RADIX_SORT_MIN_ELEMENTS or
+// more, others use SortArray, comparing keys with operator<.
+template <class T, class KeyGetter>
+void sort_by_key(T *p_array, int p_len, const KeyGetter &p_key) {
+	if constexpr (RadixSort<T, KeyGetter>::KEY_SUPPORTED) {
+		if (p_len >= RADIX_SORT_MIN_ELEMENTS) {
+			RadixSort<T, KeyGetter> sorter(p_key);
+			sorter.sort(p_array, p_len);
+			return;
+		}
+	}
+
+	SortArray<T, _KeyComparator<T, KeyGetter>> sorter;
+	sorter.compare.key = &p_key;
+	sorter.sort(p_array, p_len);
+}
+
+} // namespace godot
+
+#endif // GODOT_RADIX_SORT_HPP
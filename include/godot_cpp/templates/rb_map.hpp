@@ -33,6 +33,7 @@
 
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/paged_allocator.hpp>
 #include <godot_cpp/templates/pair.hpp>
 
 namespace godot {
@@ -760,6 +761,10 @@ public:
 	}
 };
 
+// RBMap with its nodes in pages shared by all the maps of the same node size.
+template <class K, class V, class C = Comparator<K>, bool THREAD_SAFE = true>
+using PagedRBMap = RBMap<K, V, C, PagedNodeAllocator<sizeof(typename RBMap<K, V, C>::Element), THREAD_SAFE>>;
+
 } // namespace godot
 
 #endif // GODOT_RB_MAP_HPP
@@ -32,6 +32,7 @@
 #define GODOT_RB_SET_HPP
 
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/paged_allocator.hpp>
 
 // based on the very nice implementation of rb-trees by:
 // https://web.archive.org/web/20120507164830/https://web.mit.edu/~emin/www/source_code/red_black_tree/index.html
@@ -709,6 +710,10 @@ public:
 	}
 };
 
+// RBSet with its nodes in pages shared by all the sets of the same node size.
+template <class T, class C = Comparator<T>, bool THREAD_SAFE = true>
+using PagedRBSet = RBSet<T, C, PagedNodeAllocator<sizeof(typename RBSet<T, C>::Element), THREAD_SAFE>>;
+
 } // namespace godot
 
 #endif // GODOT_RB_SET_HPP
@@ -66,15 +66,15 @@ class RID_Alloc {
 			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
 
 			// grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); // but don't initialize
+			chunks = (T **)Memory::realloc_static(chunks, sizeof(T *) * (chunk_count + 1), false, GODOT_MEMORY_TAG(RID_Alloc));
+			chunks[chunk_count] = (T *)Memory::alloc_static(sizeof(T) * elements_in_chunk, false, GODOT_MEMORY_TAG(RID_Alloc)); // but don't initialize
 
 			// grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+			validator_chunks = (uint32_t **)Memory::realloc_static(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1), false, GODOT_MEMORY_TAG(RID_Alloc));
+			validator_chunks[chunk_count] = (uint32_t *)Memory::alloc_static(sizeof(uint32_t) * elements_in_chunk, false, GODOT_MEMORY_TAG(RID_Alloc));
 			// grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+			free_list_chunks = (uint32_t **)Memory::realloc_static(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1), false, GODOT_MEMORY_TAG(RID_Alloc));
+			free_list_chunks[chunk_count] = (uint32_t *)Memory::alloc_static(sizeof(uint32_t) * elements_in_chunk, false, GODOT_MEMORY_TAG(RID_Alloc));
 
 			// initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
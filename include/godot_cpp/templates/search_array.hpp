@@ -33,6 +33,8 @@
 
 #include <godot_cpp/templates/sort_array.hpp>
 
+#include <cstdint>
+
 namespace godot {
 
 template <class T, class Comparator = _DefaultComparator<T>>
@@ -66,6 +68,83 @@ public:
 	}
 };
 
+// Sorted data laid out as an implicit binary tree in breadth-first order
+// (Eytzinger layout): the children of p_array[k] are p_array[2k] and
+// p_array[2k + 1], and index 0 is unused. The first levels, which every search
+// goes through, share a few cache lines, and lower_bound() is branchless and
+// prefetches the descendants four levels down.
+template <class T, class Comparator = _DefaultComparator<T>>
+class EytzingerArray {
+	// Descendants four levels down are 16 consecutive elements.
+	static constexpr uintptr_t PREFETCH_STRIDE = 16 * sizeof(T);
+
+public:
+	Comparator compare;
+
+	// Calls p_func(index, rank) for the p_len nodes in sorted order, with the
+	// index of each node in the layout and its rank in the sorted data.
+	template <class F>
+	static void for_each_in_order(int p_len, const F &p_func) {
+		if (p_len <= 0) {
+			return;
+		}
+		int k = 1;
+		while (2 * k <= p_len) {
+			k *= 2;
+		}
+		for (int rank = 0; rank < p_len; rank++) {
+			p_func(k, rank);
+			if (2 * k + 1 <= p_len) {
+				// Leftmost node of the right subtree.
+				k = 2 * k + 1;
+				while (2 * k <= p_len) {
+					k *= 2;
+				}
+			} else {
+				// Parent of the first ancestor that is a left child.
+				while (k & 1) {
+					k >>= 1;
+				}
+				k >>= 1;
+			}
+		}
+	}
+
+	// Fills r_array, of p_len + 1 elements, from p_sorted.
+	static void build(const T *p_sorted, T *r_array, int p_len) {
+		for_each_in_order(p_len, [&](int p_index, int p_rank) {
+			r_array[p_index] = p_sorted[p_rank];
+		});
+	}
+
+	// Index of the first element that isn't less than p_value, or 0 if there's none.
+	inline int lower_bound(const T *p_array, int p_len, const T &p_value) const {
+		unsigned int k = 1;
+		while (k <= (unsigned int)p_len) {
+#if defined(__GNUC__)
+			__builtin_prefetch((const void *)((uintptr_t)p_array + k * PREFETCH_STRIDE));
+#endif
+			k = 2 * k + compare(p_array[k], p_value);
+		}
+		// Undo the right turns taken after the last left turn, and that one.
+#if defined(__GNUC__)
+		k >>= __builtin_ctz(~k) + 1;
+#else
+		while (k & 1) {
+			k >>= 1;
+		}
+		k >>= 1;
+#endif
+		return k;
+	}
+
+	// Index of p_value, or 0 if it's not there.
+	inline int find(const T *p_array, int p_len, const T &p_value) const {
+		const int k = lower_bound(p_array, p_len, p_value);
+		return (k != 0 && !compare(p_value, p_array[k])) ? k : 0;
+	}
+};
+
 } // namespace godot
 
 #endif // GODOT_SEARCH_ARRAY_HPP
@@ -116,6 +116,7 @@ private:
 
 public:
 	_FORCE_INLINE_ bool in_list() const { return _root; }
+	_FORCE_INLINE_ List *get_list() const { return _root; }
 	_FORCE_INLINE_ void remove_from_list() {
 		if (_root) {
 			_root->remove(this);
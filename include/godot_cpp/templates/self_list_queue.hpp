@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*  self_list_queue.hpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_SELF_LIST_QUEUE_HPP
+#define GODOT_SELF_LIST_QUEUE_HPP
+
+#include <godot_cpp/templates/self_list.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+
+namespace godot {
+
+// Queue of SelfList elements that any thread can push to and one thread
+// drains, e.g. objects marked dirty by worker threads and updated on the main
+// thread. Pushing an element that's already queued does nothing, so it's
+// processed once however many times it was marked. Nothing is allocated, and
+// elements can be removed in O(1).
+//
+// SelfList's destructor unlinks the element without taking the lock: remove()
+// it before destroying it if other threads may still push.
+template <class T>
+class SelfListQueue {
+	mutable SpinLock lock;
+	typename SelfList<T>::List list;
+	uint32_t count = 0;
+
+public:
+	// Returns false if the element was already in the queue.
+	bool push(SelfList<T> *p_elem) {
+		lock.lock();
+		const typename SelfList<T>::List *current = p_elem->get_list();
+		if (!current) {
+			list.add_last(p_elem);
+			count++;
+		}
+		lock.unlock();
+		ERR_FAIL_COND_V_MSG(current && current != &list, false, "The element is already in another list.");
+		return !current;
+	}
+
+	// Returns false if the element wasn't in the queue.
+	bool remove(SelfList<T> *p_elem) {
+		lock.lock();
+		const bool queued = p_elem->get_list() == &list;
+		if (queued) {
+			list.remove(p_elem);
+			count--;
+		}
+		lock.unlock();
+		return queued;
+	}
+
+	// Oldest element, or nullptr if the queue is empty.
+	T *pop() {
+		lock.lock();
+		SelfList<T> *first = list.first();
+		if (first) {
+			list.remove(first);
+			count--;
+		}
+		lock.unlock();
+		return first ? first->self() : nullptr;
+	}
+
+	// Pops the elements that are queued when it's called and passes them to
+	// p_callback, oldest first. Elements pushed meanwhile, including by
+	// p_callback itself, are left for the next call. Returns how many were
+	// processed.
+	template <class F>
+	uint32_t flush(F p_callback) {
+		uint32_t pending = size();
+		uint32_t processed = 0;
+		for (; processed < pending; processed++) {
+			T *elem = pop();
+			if (!elem) {
+				break; // Removed meanwhile.
+			}
+			p_callback(elem);
+		}
+		return processed;
+	}
+
+	void clear() {
+		lock.lock();
+		while (list.first()) {
+			list.remove(list.first());
+		}
+		count = 0;
+		lock.unlock();
+	}
+
+	uint32_t size() const {
+		lock.lock();
+		const uint32_t ret = count;
+		lock.unlock();
+		return ret;
+	}
+	_FORCE_INLINE_ bool is_empty() const { return size() == 0; }
+
+	SelfListQueue() {}
+	~SelfListQueue() { clear(); }
+};
+
+} // namespace godot
+
+#endif // GODOT_SELF_LIST_QUEUE_HPP
@@ -0,0 +1,258 @@
+/**************************************************************************/
+/*  slot_map.hpp                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_SLOT_MAP_HPP
+#define GODOT_SLOT_MAP_HPP
+
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <utility>
+
+namespace godot {
+
+// Generational handle to an element of a SlotMap: a 32-bit slot index and
+// the generation the slot had when the element was inserted. Erasing the
+// element bumps the generation, so old handles to the slot stop resolving.
+// The null handle has generation 0, which slots never have.
+struct SlotHandle {
+	uint32_t index = 0;
+	uint32_t generation = 0;
+
+	_FORCE_INLINE_ bool is_null() const { return generation == 0; }
+	_FORCE_INLINE_ bool operator==(const SlotHandle &p_other) const { return index == p_other.index && generation == p_other.generation; }
+	_FORCE_INLINE_ bool operator!=(const SlotHandle &p_other) const { return !operator==(p_other); }
+
+	// Same layout as the IDs of RID_Owner: generation in the high bits.
+	_FORCE_INLINE_ uint64_t get_id() const { return (uint64_t(generation) << 32) | index; }
+	static _FORCE_INLINE_ SlotHandle from_id(uint64_t p_id) { return SlotHandle(uint32_t(p_id), uint32_t(p_id >> 32)); }
+
+	// Only needed to pass the handle to the engine, each conversion is a call.
+	RID to_rid() const { return is_null() ? RID() : UtilityFunctions::rid_from_int64(get_id()); }
+	static SlotHandle from_rid(const RID &p_rid) { return from_id(p_rid.get_id()); }
+
+	_FORCE_INLINE_ SlotHandle() {}
+	_FORCE_INLINE_ SlotHandle(uint32_t p_index, uint32_t p_generation) :
+			index(p_index), generation(p_generation) {}
+};
+
+// Container of T addressed by SlotHandle, a lighter alternative to RID_Owner
+// for objects that never cross to the engine: handles are made locally, and a
+// lookup is two loads with no division.
+//
+// Elements are kept dense, in chunks of CHUNK_SIZE that never move, so
+// iterating goes linearly through memory. Erasing moves the last element into
+// the hole, which makes iteration order and element addresses change: keep
+// handles, not pointers. Not thread safe.
+template <class T, uint32_t CHUNK_SIZE = 256>
+class SlotMap {
+	static_assert(CHUNK_SIZE > 0 && (CHUNK_SIZE & (CHUNK_SIZE - 1)) == 0, "The chunk size must be a power of 2.");
+
+	static constexpr uint32_t _log2(uint32_t p_value) { return p_value <= 1 ? 0 : 1 + _log2(p_value >> 1); }
+
+	static constexpr uint32_t CHUNK_SHIFT = _log2(CHUNK_SIZE);
+	static constexpr uint32_t CHUNK_MASK = CHUNK_SIZE - 1;
+	static constexpr uint32_t NO_SLOT = 0xFFFFFFFF;
+
+	struct Slot {
+		uint32_t generation = 1;
+		// Dense index of the element while used, next free slot otherwise.
+		uint32_t index = NO_SLOT;
+	};
+
+	LocalVector<Slot> slots;
+	uint32_t free_slot = NO_SLOT;
+
+	T **chunks = nullptr;
+	uint32_t chunk_count = 0;
+	// Slot of each dense element, to fix it up when the element is moved.
+	LocalVector<uint32_t> dense_slots;
+
+	_FORCE_INLINE_ T *_get_dense(uint32_t p_index) const { return &chunks[p_index >> CHUNK_SHIFT][p_index & CHUNK_MASK]; }
+
+	_FORCE_INLINE_ const Slot *_get_slot(const SlotHandle &p_handle) const {
+		if (unlikely(p_handle.index >= slots.size())) {
+			return nullptr;
+		}
+		const Slot *slot = &slots[p_handle.index];
+		return slot->generation == p_handle.generation ? slot : nullptr;
+	}
+
+	template <class... Args>
+	SlotHandle _insert(Args &&...p_args) {
+		const uint32_t dense_index = dense_slots.size();
+		if (dense_index == chunk_count * CHUNK_SIZE) {
+			chunks = (T **)Memory::realloc_static(chunks, sizeof(T *) * (chunk_count + 1), false, GODOT_MEMORY_TAG(SlotMap));
+			chunks[chunk_count] = (T *)Memory::alloc_static(sizeof(T) * CHUNK_SIZE, false, GODOT_MEMORY_TAG(SlotMap));
+			chunk_count++;
+		}
+		memnew_placement(_get_dense(dense_index), T(std::forward<Args>(p_args)...));
+
+		uint32_t slot_index = free_slot;
+		if (slot_index == NO_SLOT) {
+			slot_index = slots.size();
+			slots.push_back(Slot());
+		} else {
+			free_slot = slots[slot_index].index;
+		}
+		slots[slot_index].index = dense_index;
+		dense_slots.push_back(slot_index);
+
+		return SlotHandle(slot_index, slots[slot_index].generation);
+	}
+
+	void _release_slot(uint32_t p_slot_index) {
+		Slot &slot = slots[p_slot_index];
+		slot.generation++;
+		if (unlikely(slot.generation == 0)) {
+			slot.generation = 1;
+		}
+		slot.index = free_slot;
+		free_slot = p_slot_index;
+	}
+
+public:
+	template <class E>
+	class IteratorT {
+		T *const *chunks;
+		uint32_t index;
+
+	public:
+		_FORCE_INLINE_ E &operator*() const { return chunks[index >> CHUNK_SHIFT][index & CHUNK_MASK]; }
+		_FORCE_INLINE_ E *operator->() const { return &operator*(); }
+		_FORCE_INLINE_ IteratorT &operator++() {
+			index++;
+			return *this;
+		}
+		_FORCE_INLINE_ bool operator==(const IteratorT &p_other) const { return index == p_other.index; }
+		_FORCE_INLINE_ bool operator!=(const IteratorT &p_other) const { return index != p_other.index; }
+
+		IteratorT(T *const *p_chunks, uint32_t p_index) :
+				chunks(p_chunks), index(p_index) {}
+	};
+	typedef IteratorT<T> Iterator;
+	typedef IteratorT<const T> ConstIterator;
+
+	_FORCE_INLINE_ SlotHandle insert(const T &p_value) { return _insert(p_value); }
+	_FORCE_INLINE_ SlotHandle insert(T &&p_value) { return _insert(std::move(p_value)); }
+	template <class... Args>
+	_FORCE_INLINE_ SlotHandle emplace(Args &&...p_args) { return _insert(std::forward<Args>(p_args)...); }
+
+	// Returns false if the handle doesn't resolve (already erased, or null).
+	bool erase(const SlotHandle &p_handle) {
+		const Slot *slot = _get_slot(p_handle);
+		if (!slot) {
+			return false;
+		}
+
+		const uint32_t dense_index = slot->index;
+		const uint32_t last = dense_slots.size() - 1;
+		T *elem = _get_dense(dense_index);
+		elem->~T();
+		if (dense_index != last) {
+			T *last_elem = _get_dense(last);
+			memnew_placement(elem, T(std::move(*last_elem)));
+			last_elem->~T();
+			dense_slots[dense_index] = dense_slots[last];
+			slots[dense_slots[dense_index]].index = dense_index;
+		}
+		dense_slots.resize(last);
+		_release_slot(p_handle.index);
+		return true;
+	}
+
+	_FORCE_INLINE_ T *get_or_null(const SlotHandle &p_handle) {
+		const Slot *slot = _get_slot(p_handle);
+		return slot ? _get_dense(slot->index) : nullptr;
+	}
+	_FORCE_INLINE_ const T *get_or_null(const SlotHandle &p_handle) const {
+		const Slot *slot = _get_slot(p_handle);
+		return slot ? _get_dense(slot->index) : nullptr;
+	}
+	_FORCE_INLINE_ bool owns(const SlotHandle &p_handle) const { return _get_slot(p_handle) != nullptr; }
+
+	// Dense access, in iteration order, for indices below size().
+	_FORCE_INLINE_ T &get_dense(uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, dense_slots.size());
+		return *_get_dense(p_index);
+	}
+	_FORCE_INLINE_ const T &get_dense(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, dense_slots.size());
+		return *_get_dense(p_index);
+	}
+	_FORCE_INLINE_ SlotHandle get_dense_handle(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, dense_slots.size());
+		const uint32_t slot_index = dense_slots[p_index];
+		return SlotHandle(slot_index, slots[slot_index].generation);
+	}
+
+	_FORCE_INLINE_ uint32_t size() const { return dense_slots.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return dense_slots.is_empty(); }
+
+	_FORCE_INLINE_ Iterator begin() { return Iterator(chunks, 0); }
+	_FORCE_INLINE_ Iterator end() { return Iterator(chunks, dense_slots.size()); }
+	_FORCE_INLINE_ ConstIterator begin() const { return ConstIterator(chunks, 0); }
+	_FORCE_INLINE_ ConstIterator end() const { return ConstIterator(chunks, dense_slots.size()); }
+
+	// Erases every element, invalidating their handles. Keeps the memory.
+	void clear() {
+		for (uint32_t i = 0; i < dense_slots.size(); i++) {
+			_get_dense(i)->~T();
+			_release_slot(dense_slots[i]);
+		}
+		dense_slots.clear();
+	}
+
+	// Also frees the memory. Handles from before may resolve again afterwards.
+	void reset() {
+		clear();
+		if (chunks) {
+			for (uint32_t i = 0; i < chunk_count; i++) {
+				memfree(chunks[i]);
+			}
+			memfree(chunks);
+			chunks = nullptr;
+		}
+		chunk_count = 0;
+		slots.reset();
+		dense_slots.reset();
+		free_slot = NO_SLOT;
+	}
+
+	SlotMap() {}
+	SlotMap(const SlotMap &) = delete;
+	SlotMap &operator=(const SlotMap &) = delete;
+	~SlotMap() { reset(); }
+};
+
+} // namespace godot
+
+#endif // GODOT_SLOT_MAP_HPP
@@ -0,0 +1,330 @@
+/**************************************************************************/
+/*  small_vector.hpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_SMALL_VECTOR_HPP
+#define GODOT_SMALL_VECTOR_HPP
+
+#include "godot_cpp/core/error_macros.hpp"
+#include "godot_cpp/core/memory.hpp"
+#include "godot_cpp/templates/radix_sort.hpp"
+#include "godot_cpp/templates/sort_array.hpp"
+#include "godot_cpp/templates/span.hpp"
+#include "godot_cpp/templates/vector.hpp"
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace godot {
+
+// Like LocalVector, but the first N elements are stored inside the object, so
+// short-lived arrays which rarely grow past N never allocate. Past N, elements
+// move to the heap and the capacity doubles as needed. Elements are relocated
+// with their move constructor, so any T can be stored.
+template <class T, uint32_t N = 16, class U = uint32_t>
+class SmallVector {
+	static_assert(N > 0, "SmallVector needs an inline capacity.");
+
+	static constexpr bool TRIVIAL = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+	T *data = (T *)inline_data;
+	U count = 0;
+	U capacity = N;
+	alignas(T) uint8_t inline_data[sizeof(T) * N];
+
+	_FORCE_INLINE_ bool _is_inline() const { return data == (const T *)inline_data; }
+
+	static void _relocate(T *p_dst, T *p_src, U p_count) {
+		if constexpr (TRIVIAL) {
+			memcpy((void *)p_dst, (const void *)p_src, sizeof(T) * p_count);
+		} else {
+			for (U i = 0; i < p_count; i++) {
+				memnew_placement(&p_dst[i], T(std::move(p_src[i])));
+				p_src[i].~T();
+			}
+		}
+	}
+
+	static T *_allocate(U p_capacity) {
+		T *new_data = (T *)Memory::alloc_static(sizeof(T) * p_capacity, false, GODOT_MEMORY_TAG(SmallVector));
+		CRASH_COND_MSG(!new_data, "Out of memory");
+		return new_data;
+	}
+
+	// Moves the elements to `p_new_data`, which becomes the storage.
+	void _replace_data(T *p_new_data, U p_capacity) {
+		_relocate(p_new_data, data, count);
+		if (!_is_inline()) {
+			memfree(data);
+		}
+		data = p_new_data;
+		capacity = p_capacity;
+	}
+
+	void _grow(U p_capacity) {
+		_replace_data(_allocate(p_capacity), p_capacity);
+	}
+
+	_FORCE_INLINE_ void _destroy(U p_from, U p_to) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (U i = p_from; i < p_to; i++) {
+				data[i].~T();
+			}
+		}
+	}
+
+	void _move_from(SmallVector &p_from) {
+		if (p_from._is_inline()) {
+			_relocate(data, p_from.data, p_from.count);
+		} else {
+			data = p_from.data;
+			capacity = p_from.capacity;
+			p_from.data = (T *)p_from.inline_data;
+			p_from.capacity = N;
+		}
+		count = p_from.count;
+		p_from.count = 0;
+	}
+
+public:
+	_FORCE_INLINE_ T *ptr() { return data; }
+	_FORCE_INLINE_ const T *ptr() const { return data; }
+	_FORCE_INLINE_ Span<T> span() const { return Span<T>(data, count); }
+	_FORCE_INLINE_ operator Span<T>() const { return span(); }
+
+	_FORCE_INLINE_ U size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	// True while the elements are stored in the object itself.
+	_FORCE_INLINE_ bool is_inline() const { return _is_inline(); }
+
+	_FORCE_INLINE_ void push_back(T p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(capacity * 2);
+		}
+		memnew_placement(&data[count++], T(std::move(p_elem)));
+	}
+
+	void pop_back() {
+		ERR_FAIL_COND(count == 0);
+		count--;
+		_destroy(count, count + 1);
+	}
+
+	void remove_at(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		for (U i = p_index; i < count; i++) {
+			data[i] = std::move(data[i + 1]);
+		}
+		_destroy(count, count + 1);
+	}
+
+	// Moves the last element into the removed position instead of shifting.
+	void remove_at_unordered(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		if (count > p_index) {
+			data[p_index] = std::move(data[count]);
+		}
+		_destroy(count, count + 1);
+	}
+
+	void erase(const T &p_val) {
+		int64_t idx = find(p_val);
+		if (idx >= 0) {
+			remove_at(idx);
+		}
+	}
+
+	void insert(U p_pos, T p_val) {
+		ERR_FAIL_UNSIGNED_INDEX(p_pos, count + 1);
+		if (p_pos == count) {
+			push_back(std::move(p_val));
+		} else {
+			push_back(std::move(data[count - 1]));
+			for (U i = count - 2; i > p_pos; i--) {
+				data[i] = std::move(data[i - 1]);
+			}
+			data[p_pos] = std::move(p_val);
+		}
+	}
+
+	void append_array(Span<T> p_other) {
+		const U new_count = count + p_other.size();
+		if (new_count > capacity) {
+			// `p_other` may point into our own elements, so it's copied before
+			// they are relocated.
+			const U new_capacity = MAX(new_count, capacity * 2);
+			T *new_data = _allocate(new_capacity);
+			for (U i = 0; i < p_other.size(); i++) {
+				memnew_placement(&new_data[count + i], T(p_other[i]));
+			}
+			_replace_data(new_data, new_capacity);
+		} else {
+			for (const T &element : p_other) {
+				memnew_placement(&data[count++], T(element));
+			}
+		}
+		count = new_count;
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+	// Also frees the heap storage, going back to the inline one.
+	void reset() {
+		clear();
+		if (!_is_inline()) {
+			memfree(data);
+			data = (T *)inline_data;
+			capacity = N;
+		}
+	}
+
+	void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(MAX(p_size, capacity * 2));
+		}
+	}
+
+	void resize(U p_size) {
+		if (p_size < count) {
+			_destroy(p_size, count);
+			count = p_size;
+		} else if (p_size > count) {
+			reserve(p_size);
+			if constexpr (!std::is_trivially_constructible_v<T>) {
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&data[i], T);
+				}
+			}
+			count = p_size;
+		}
+	}
+
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+
+	int64_t find(const T &p_val, U p_from = 0) const {
+		for (U i = p_from; i < count; i++) {
+			if (data[i] == p_val) {
+				return int64_t(i);
+			}
+		}
+		return -1;
+	}
+
+	_FORCE_INLINE_ bool has(const T &p_val) const { return find(p_val) != -1; }
+
+	template <class C>
+	void sort_custom() {
+		if (count == 0) {
+			return;
+		}
+		SortArray<T, C> sorter;
+		sorter.sort(data, count);
+	}
+
+	// Sorts by the key p_key returns for each element, compared with operator<,
+	// e.g. `sort_custom([](const Entry &p_entry) { return p_entry.score; })`.
+	// Integer, enum and floating-point keys use a radix sort on large arrays.
+	template <class K>
+	void sort_custom(const K &p_key) {
+		if (count == 0) {
+			return;
+		}
+		sort_by_key(data, count, p_key);
+	}
+
+	void sort() {
+		if constexpr (RadixSort<T>::KEY_SUPPORTED) {
+			sort_custom(_IdentityKey<T>());
+		} else {
+			sort_custom<_DefaultComparator<T>>();
+		}
+	}
+
+	operator Vector<T>() const {
+		Vector<T> ret;
+		ret.resize(count);
+		T *w = ret.ptrw();
+		for (U i = 0; i < count; i++) {
+			w[i] = data[i];
+		}
+		return ret;
+	}
+
+	_FORCE_INLINE_ SmallVector() {}
+	SmallVector(std::initializer_list<T> p_init) {
+		reserve(p_init.size());
+		for (const T &element : p_init) {
+			memnew_placement(&data[count++], T(element));
+		}
+	}
+	explicit SmallVector(Span<T> p_from) {
+		append_array(p_from);
+	}
+	SmallVector(const SmallVector &p_from) {
+		append_array(p_from.span());
+	}
+	SmallVector(SmallVector &&p_from) {
+		_move_from(p_from);
+	}
+	void operator=(const SmallVector &p_from) {
+		if (this != &p_from) {
+			clear();
+			append_array(p_from.span());
+		}
+	}
+	void operator=(SmallVector &&p_from) {
+		if (this != &p_from) {
+			reset();
+			_move_from(p_from);
+		}
+	}
+
+	~SmallVector() {
+		reset();
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_SMALL_VECTOR_HPP
@@ -0,0 +1,207 @@
+/**************************************************************************/
+/*  timing_wheel.hpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_TIMING_WHEEL_HPP
+#define GODOT_TIMING_WHEEL_HPP
+
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/templates/self_list.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+
+namespace godot {
+
+// Hashed timing wheel: a timer due at tick t is kept in bucket t % BUCKETS, so
+// scheduling and cancelling are O(1) and advancing by one tick only looks at
+// one bucket. Timers more than BUCKETS ticks away are looked at (and skipped)
+// once per turn of the wheel, so BUCKETS should cover most delays.
+//
+// Timers are members of the objects they belong to, so nothing is allocated.
+// Any thread can schedule and cancel timers, one thread advances the wheel.
+// A Timer cancels itself when destroyed.
+template <class T, uint32_t BUCKETS = 256>
+class TimingWheel {
+	static_assert(BUCKETS > 0 && (BUCKETS & (BUCKETS - 1)) == 0, "The number of buckets must be a power of 2.");
+
+public:
+	class Timer {
+		friend class TimingWheel;
+
+		SelfList<Timer> link;
+		T *owner = nullptr;
+		TimingWheel *wheel = nullptr;
+		uint64_t deadline = 0;
+
+	public:
+		_FORCE_INLINE_ T *get_owner() const { return owner; }
+
+		Timer(T *p_owner) :
+				link(this), owner(p_owner) {}
+		~Timer() {
+			if (wheel) {
+				wheel->cancel(this);
+			}
+		}
+	};
+
+private:
+	mutable SpinLock lock;
+	typename SelfList<Timer>::List buckets[BUCKETS];
+	// Expired timers waiting for their callback during advance().
+	typename SelfList<Timer>::List expired;
+	uint64_t current_tick = 0;
+	uint32_t count = 0;
+
+	void _unlink(Timer *p_timer) {
+		p_timer->link.remove_from_list();
+		p_timer->wheel = nullptr;
+		count--;
+	}
+
+public:
+	_FORCE_INLINE_ uint64_t get_current_tick() const {
+		lock.lock();
+		const uint64_t ret = current_tick;
+		lock.unlock();
+		return ret;
+	}
+
+	// Fires p_timer once p_delay ticks have passed (at least 1). Reschedules it
+	// if it's already scheduled.
+	void schedule(Timer *p_timer, uint64_t p_delay) {
+		lock.lock();
+		if (p_timer->wheel == this) {
+			_unlink(p_timer);
+		}
+		const TimingWheel *other = p_timer->wheel;
+		if (!other) {
+			p_timer->deadline = current_tick + MAX(p_delay, (uint64_t)1);
+			p_timer->wheel = this;
+			buckets[p_timer->deadline & (BUCKETS - 1)].add_last(&p_timer->link);
+			count++;
+		}
+		lock.unlock();
+		ERR_FAIL_COND_MSG(other, "The timer is scheduled on another wheel.");
+	}
+
+	// Returns false if the timer wasn't scheduled on this wheel.
+	bool cancel(Timer *p_timer) {
+		lock.lock();
+		const bool scheduled = p_timer->wheel == this;
+		if (scheduled) {
+			_unlink(p_timer);
+		}
+		lock.unlock();
+		return scheduled;
+	}
+
+	bool is_scheduled(const Timer *p_timer) const {
+		lock.lock();
+		const bool scheduled = p_timer->wheel == this;
+		lock.unlock();
+		return scheduled;
+	}
+
+	// Ticks left before p_timer fires, or 0 if it isn't scheduled.
+	uint64_t get_time_left(const Timer *p_timer) const {
+		lock.lock();
+		const uint64_t ret = p_timer->wheel == this ? p_timer->deadline - current_tick : 0;
+		lock.unlock();
+		return ret;
+	}
+
+	// Moves time forward by p_ticks and calls p_callback with the owner of
+	// each timer that expires, in the order they're due. The callback may
+	// schedule timers again, including the one that fired. Returns how many
+	// fired.
+	template <class F>
+	uint32_t advance(uint64_t p_ticks, F p_callback) {
+		lock.lock();
+		const uint64_t target = current_tick + p_ticks;
+		// When going around more than once, every bucket is looked at once and
+		// timers fire in bucket order instead.
+		const uint64_t steps = MIN(p_ticks, (uint64_t)BUCKETS);
+		for (uint64_t i = 1; i <= steps; i++) {
+			typename SelfList<Timer>::List &bucket = buckets[(current_tick + i) & (BUCKETS - 1)];
+			SelfList<Timer> *elem = bucket.first();
+			while (elem) {
+				SelfList<Timer> *next = elem->next();
+				if (elem->self()->deadline <= target) {
+					bucket.remove(elem);
+					expired.add_last(elem);
+				}
+				elem = next;
+			}
+		}
+		current_tick = target;
+
+		// Run the callbacks without holding the lock. Timers can still be
+		// cancelled until their callback runs.
+		uint32_t fired = 0;
+		while (SelfList<Timer> *elem = expired.first()) {
+			Timer *timer = elem->self();
+			_unlink(timer);
+			lock.unlock();
+			p_callback(timer->owner);
+			fired++;
+			lock.lock();
+		}
+		lock.unlock();
+		return fired;
+	}
+
+	uint32_t size() const {
+		lock.lock();
+		const uint32_t ret = count;
+		lock.unlock();
+		return ret;
+	}
+
+	void clear() {
+		lock.lock();
+		for (uint32_t i = 0; i < BUCKETS; i++) {
+			while (SelfList<Timer> *elem = buckets[i].first()) {
+				_unlink(elem->self());
+			}
+		}
+		// Also cancels the timers that expired in a running advance() but
+		// whose callbacks haven't run yet.
+		while (SelfList<Timer> *elem = expired.first()) {
+			_unlink(elem->self());
+		}
+		lock.unlock();
+	}
+
+	TimingWheel() {}
+	~TimingWheel() { clear(); }
+};
+
+} // namespace godot
+
+#endif // GODOT_TIMING_WHEEL_HPP
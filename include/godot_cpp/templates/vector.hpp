@@ -39,8 +39,10 @@
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/templates/cowdata.hpp>
+#include <godot_cpp/templates/radix_sort.hpp>
 #include <godot_cpp/templates/search_array.hpp>
 #include <godot_cpp/templates/sort_array.hpp>
+#include <godot_cpp/templates/span.hpp>
 
 #include <climits>
 #include <initializer_list>
@@ -83,6 +85,8 @@ public:
 
 	_FORCE_INLINE_ T *ptrw() { return _cowdata.ptrw(); }
 	_FORCE_INLINE_ const T *ptr() const { return _cowdata.ptr(); }
+	_FORCE_INLINE_ Span<T> span() const { return Span<T>(ptr(), size()); }
+	_FORCE_INLINE_ operator Span<T>() const { return span(); }
 	_FORCE_INLINE_ void clear() { resize(0); }
 	_FORCE_INLINE_ bool is_empty() const { return _cowdata.is_empty(); }
 
@@ -91,6 +95,8 @@ public:
 	_FORCE_INLINE_ void set(int p_index, const T &p_elem) { _cowdata.set(p_index, p_elem); }
 	_FORCE_INLINE_ int size() const { return _cowdata.size(); }
 	Error resize(int p_size) { return _cowdata.resize(p_size); }
+	Error reserve(int p_capacity) { return _cowdata.reserve(p_capacity); }
+	_FORCE_INLINE_ int get_capacity() const { return _cowdata.get_capacity(); }
 	_FORCE_INLINE_ const T &operator[](int p_index) const { return _cowdata.get(p_index); }
 	Error insert(int p_pos, T p_val) { return _cowdata.insert(p_pos, p_val); }
 	int find(const T &p_val, int p_from = 0) const { return _cowdata.find(p_val, p_from); }
@@ -111,8 +117,25 @@ public:
 		sorter.sort(data, len);
 	}
 
+	// Sorts by the key p_key returns for each element, compared with operator<,
+	// e.g. `sort_custom([](const Entry &p_entry) { return p_entry.score; })`.
+	// Integer, enum and floating-point keys use a radix sort on large arrays.
+	template <class K>
+	void sort_custom(const K &p_key) {
+		int len = _cowdata.size();
+		if (len == 0) {
+			return;
+		}
+
+		sort_by_key(ptrw(), len, p_key);
+	}
+
 	void sort() {
-		sort_custom<_DefaultComparator<T>>();
+		if constexpr (RadixSort<T>::KEY_SUPPORTED) {
+			sort_custom(_IdentityKey<T>());
+		} else {
+			sort_custom<_DefaultComparator<T>>();
+		}
 	}
 
 	int bsearch(const T &p_value, bool p_before) {
@@ -137,6 +160,9 @@ public:
 	inline void operator=(const Vector &p_from) {
 		_cowdata._ref(p_from._cowdata);
 	}
+	inline void operator=(Vector &&p_from) {
+		_cowdata = std::move(p_from._cowdata);
+	}
 
 	Vector<uint8_t> to_byte_array() const {
 		Vector<uint8_t> ret;
@@ -274,6 +300,8 @@ public:
 		}
 	}
 	_FORCE_INLINE_ Vector(const Vector &p_from) { _cowdata._ref(p_from._cowdata); }
+	_FORCE_INLINE_ Vector(Vector &&p_from) :
+			_cowdata(std::move(p_from._cowdata)) {}
 
 	_FORCE_INLINE_ ~Vector() {}
 };
@@ -293,9 +321,16 @@ void Vector<T>::append_array(Vector<T> p_other) {
 		return;
 	}
 	const int bs = size();
-	resize(bs + ds);
-	for (int i = 0; i < ds; ++i) {
-		ptrw()[bs + i] = p_other[i];
+	Error err = resize(bs + ds);
+	ERR_FAIL_COND(err);
+	T *dst = ptrw() + bs;
+	const T *src = p_other.ptr();
+	if constexpr (std::is_trivially_copyable<T>::value) {
+		memcpy((void *)dst, (const void *)src, ds * sizeof(T));
+	} else {
+		for (int i = 0; i < ds; ++i) {
+			dst[i] = src[i];
+		}
 	}
 }
 
@@ -303,7 +338,8 @@ template <class T>
 bool Vector<T>::push_back(T p_elem) {
 	Error err = resize(size() + 1);
 	ERR_FAIL_COND_V(err, true);
-	set(size() - 1, p_elem);
+	// resize() left the buffer unshared, no need to go through set().
+	_cowdata._get_data()[size() - 1] = std::move(p_elem);
 
 	return false;
 }
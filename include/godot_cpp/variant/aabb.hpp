@@ -31,7 +31,7 @@
 #ifndef GODOT_AABB_HPP
 #define GODOT_AABB_HPP
 
-#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/properties_fwd.hpp>
 #include <godot_cpp/variant/plane.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
@@ -134,31 +134,7 @@ struct _NO_DISCARD_ AABB {
 };
 
 inline bool AABB::intersects(const AABB &p_aabb) const {
-#ifdef MATH_CHECKS
-	if (unlikely(size.x < 0 || size.y < 0 || size.z < 0 || p_aabb.size.x < 0 || p_aabb.size.y < 0 || p_aabb.size.z < 0)) {
-		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
-	}
-#endif
-	if (position.x >= (p_aabb.position.x + p_aabb.size.x)) {
-		return false;
-	}
-	if ((position.x + size.x) <= p_aabb.position.x) {
-		return false;
-	}
-	if (position.y >= (p_aabb.position.y + p_aabb.size.y)) {
-		return false;
-	}
-	if ((position.y + size.y) <= p_aabb.position.y) {
-		return false;
-	}
-	if (position.z >= (p_aabb.position.z + p_aabb.size.z)) {
-		return false;
-	}
-	if ((position.z + size.z) <= p_aabb.position.z) {
-		return false;
-	}
-
-	return true;
+	return SpatialMath::aabb_intersects(*this, p_aabb);
 }
 
 inline bool AABB::intersects_inclusive(const AABB &p_aabb) const {
@@ -286,83 +262,15 @@ bool AABB::intersects_convex_shape(const Plane *p_planes, int p_plane_count, con
 }
 
 bool AABB::inside_convex_shape(const Plane *p_planes, int p_plane_count) const {
-	Vector3 half_extents = size * 0.5f;
-	Vector3 ofs = position + half_extents;
-
-	for (int i = 0; i < p_plane_count; i++) {
-		const Plane &p = p_planes[i];
-		Vector3 point(
-				(p.normal.x < 0) ? -half_extents.x : half_extents.x,
-				(p.normal.y < 0) ? -half_extents.y : half_extents.y,
-				(p.normal.z < 0) ? -half_extents.z : half_extents.z);
-		point += ofs;
-		if (p.is_point_over(point)) {
-			return false;
-		}
-	}
-
-	return true;
+	return SpatialMath::aabb_inside_convex_shape(*this, p_planes, p_plane_count);
 }
 
 bool AABB::has_point(const Vector3 &p_point) const {
-#ifdef MATH_CHECKS
-	if (unlikely(size.x < 0 || size.y < 0 || size.z < 0)) {
-		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
-	}
-#endif
-	if (p_point.x < position.x) {
-		return false;
-	}
-	if (p_point.y < position.y) {
-		return false;
-	}
-	if (p_point.z < position.z) {
-		return false;
-	}
-	if (p_point.x > position.x + size.x) {
-		return false;
-	}
-	if (p_point.y > position.y + size.y) {
-		return false;
-	}
-	if (p_point.z > position.z + size.z) {
-		return false;
-	}
-
-	return true;
+	return SpatialMath::aabb_has_point(*this, p_point);
 }
 
 inline void AABB::expand_to(const Vector3 &p_vector) {
-#ifdef MATH_CHECKS
-	if (unlikely(size.x < 0 || size.y < 0 || size.z < 0)) {
-		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
-	}
-#endif
-	Vector3 begin = position;
-	Vector3 end = position + size;
-
-	if (p_vector.x < begin.x) {
-		begin.x = p_vector.x;
-	}
-	if (p_vector.y < begin.y) {
-		begin.y = p_vector.y;
-	}
-	if (p_vector.z < begin.z) {
-		begin.z = p_vector.z;
-	}
-
-	if (p_vector.x > end.x) {
-		end.x = p_vector.x;
-	}
-	if (p_vector.y > end.y) {
-		end.y = p_vector.y;
-	}
-	if (p_vector.z > end.z) {
-		end.z = p_vector.z;
-	}
-
-	position = begin;
-	size = end - begin;
+	SpatialMath::aabb_expand_to(*this, p_vector);
 }
 
 void AABB::project_range_in_plane(const Plane &p_plane, real_t &r_min, real_t &r_max) const {
@@ -490,59 +398,9 @@ AABB AABB::quantized(real_t p_unit) const {
 	return ret;
 }
 
-
-
-template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
-class Property<AABB, Getter, Setter> : public PropertyOperations<Property<AABB, Getter, Setter>> {
-    using T = AABB;
-    using Self = Property<AABB, Getter, Setter>;
-public:
-	PROPERTY_CORE(Getter, Setter)
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY(Vector3, position, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(Vector3, size, Self)
-
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_volume, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(has_volume, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(has_surface, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_inclusive, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(encloses, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(merge, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(merge_with, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersection, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_ray, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(smits_intersect_ray, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_convex_shape, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(inside_convex_shape, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_plane, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(has_point, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_support, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_longest_axis, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_longest_axis_index, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_longest_axis_size, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_shortest_axis, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_shortest_axis_index, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_shortest_axis_size, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(grow, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(grow_by, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_edge, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_endpoint, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(expand, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(project_range_in_plane, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(expand_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(abs, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment_bind, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_ray_bind, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(quantize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(quantized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_end, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_end, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, end, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_center, Self)
-};
+// Defined in <godot_cpp/variant/properties/aabb.hpp>.
+template <auto Getter, auto Setter>
+class Property<AABB, Getter, Setter>;
 
 } // namespace godot
 
@@ -32,7 +32,7 @@
 #define GODOT_BASIS_HPP
 
 #include <godot_cpp/classes/global_constants.hpp>
-#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/properties_fwd.hpp>
 #include <godot_cpp/variant/quaternion.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
@@ -54,15 +54,18 @@ struct _NO_DISCARD_ Basis {
 
 	Vector3 get_x() const { return rows[0]; }
 	Vector3 set_x(Vector3 value) { return rows[0] = value; }
-	godot::Property<Vector3, &Basis::get_x, &Basis::set_x> x() { return this; }
+	template <typename P = godot::Property<Vector3, &Basis::get_x, &Basis::set_x>>
+	P x() { return this; }
 
 	Vector3 get_y() const { return rows[1]; }
 	Vector3 set_y(Vector3 value) { return rows[1] = value; }
-	godot::Property<Vector3, &Basis::get_y, &Basis::set_y> y() { return this; }
+	template <typename P = godot::Property<Vector3, &Basis::get_y, &Basis::set_y>>
+	P y() { return this; }
 
 	Vector3 get_z() const { return rows[2]; }
 	Vector3 set_z(Vector3 value) { return rows[2] = value; }
-	godot::Property<Vector3, &Basis::get_z, &Basis::set_z> z() { return this; }
+	template <typename P = godot::Property<Vector3, &Basis::get_z, &Basis::set_z>>
+	P z() { return this; }
 
 
 	void invert();
@@ -258,17 +261,11 @@ private:
 };
 
 _FORCE_INLINE_ void Basis::operator*=(const Basis &p_matrix) {
-	set(
-			p_matrix.tdotx(rows[0]), p_matrix.tdoty(rows[0]), p_matrix.tdotz(rows[0]),
-			p_matrix.tdotx(rows[1]), p_matrix.tdoty(rows[1]), p_matrix.tdotz(rows[1]),
-			p_matrix.tdotx(rows[2]), p_matrix.tdoty(rows[2]), p_matrix.tdotz(rows[2]));
+	*this = SpatialMath::basis_mul(*this, p_matrix);
 }
 
 _FORCE_INLINE_ Basis Basis::operator*(const Basis &p_matrix) const {
-	return Basis(
-			p_matrix.tdotx(rows[0]), p_matrix.tdoty(rows[0]), p_matrix.tdotz(rows[0]),
-			p_matrix.tdotx(rows[1]), p_matrix.tdoty(rows[1]), p_matrix.tdotz(rows[1]),
-			p_matrix.tdotx(rows[2]), p_matrix.tdoty(rows[2]), p_matrix.tdotz(rows[2]));
+	return SpatialMath::basis_mul(*this, p_matrix);
 }
 
 _FORCE_INLINE_ void Basis::operator+=(const Basis &p_matrix) {
@@ -308,139 +305,20 @@ _FORCE_INLINE_ Basis Basis::operator*(const real_t p_val) const {
 }
 
 Vector3 Basis::xform(const Vector3 &p_vector) const {
-	return Vector3(
-			rows[0].dot(p_vector),
-			rows[1].dot(p_vector),
-			rows[2].dot(p_vector));
+	return SpatialMath::basis_xform(*this, p_vector);
 }
 
 Vector3 Basis::xform_inv(const Vector3 &p_vector) const {
-	return Vector3(
-			(rows[0][0] * p_vector.x) + (rows[1][0] * p_vector.y) + (rows[2][0] * p_vector.z),
-			(rows[0][1] * p_vector.x) + (rows[1][1] * p_vector.y) + (rows[2][1] * p_vector.z),
-			(rows[0][2] * p_vector.x) + (rows[1][2] * p_vector.y) + (rows[2][2] * p_vector.z));
+	return SpatialMath::basis_xform_inv(*this, p_vector);
 }
 
 real_t Basis::determinant() const {
-	return rows[0][0] * (rows[1][1] * rows[2][2] - rows[2][1] * rows[1][2]) -
-			rows[1][0] * (rows[0][1] * rows[2][2] - rows[2][1] * rows[0][2]) +
-			rows[2][0] * (rows[0][1] * rows[1][2] - rows[1][1] * rows[0][2]);
+	return SpatialMath::basis_determinant(*this);
 }
 
-template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
-class Property<Basis, Getter, Setter> : public PropertyOperations<Property<Basis, Getter, Setter>> {
-    using T = Basis;
-    using Self = Property<Basis, Getter, Setter>;
-public:
-	PROPERTY_CORE(Getter, Setter)
-
-	Vector3* get_rows() const { return get().rows; }
-	Vector3* set_rows(Vector3* value) {
-		auto temp = get();
-		memcpy(value, temp.rows, 3);
-		set(temp);
-		return temp.rows;
-	}
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3*, rows, Self);
-
-	Vector3 get_x() const { return get_rows()[0]; }
-	Vector3 get_y() const { return get_rows()[1]; }
-	Vector3 get_z() const { return get_rows()[2]; }
-
-	Vector3 set_x(Vector3 value) {
-		auto temp = get_rows();
-		temp[0] = value;
-		set_rows(temp);
-		return temp[0];
-	}
-	Vector3 set_y(Vector3 value) {
-		auto temp = get_rows();
-		temp[1] = value;
-		set_rows(temp);
-		return temp[1];
-	}
-	Vector3 set_z(Vector3 value) {
-		auto temp = get_rows();
-		temp[2] = value;
-		set_rows(temp);
-		return temp[2];
-	}
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, x, Self);
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, y, Self);
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, z, Self);
-
-	GODOT_PROPERTY_WRAPPED_FUNCTION(invert, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(transpose, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(transposed, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(determinant, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(from_z, Self)
-	// Have to be specified manually because overload sets don't go through the template mechanisms properly...
-	template<typename... Args> requires (getsetable<Self>) void rotate(Args... args) { auto temp = get(); temp.rotate(std::forward<Args>(args)...); set(temp); }
-	template<typename... Args> requires (!getsetable<Self> && getable<Self>) void rotate(Args... args) const { const auto temp = get(); temp.rotate(std::forward<Args>(args)...); }
-	template<typename... Args> requires (getsetable<Self>) auto rotated(Args... args) { auto temp = get(); auto ret = temp.rotated(std::forward<Args>(args)...); set(temp); return ret; }
-	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto rotated(Args... args) const { const auto temp = get(); auto ret = temp.rotated(std::forward<Args>(args)...); return ret; }
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler_normalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_rotation_axis_angle, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_rotation_axis_angle_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_rotation_quaternion, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_to_align, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotref_posscale_decomposition, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_euler, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(from_euler, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_quaternion, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_quaternion, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Quaternion, quaternion, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_axis_angle, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_axis_angle, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_orthogonal, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled_orthogonal, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(make_scale_uniform, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_uniform_scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_scale_abs, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_scale_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_axis_angle_scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_euler_scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_quaternion_scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(tdotx, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(tdoty, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(tdotz, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(xform, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_orthogonal, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_diagonal, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_rotation, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(lerp, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(slerp, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_sh, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_columns, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_column, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_column, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, column, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_main_diagonal, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_zero, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(transpose_xform, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalized, Self)
-#ifdef MATH_CHECKS
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_symmetric, Self)
-#endif
-	GODOT_PROPERTY_WRAPPED_FUNCTION(diagonalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(looking_at, Self)
-};
+// Defined in <godot_cpp/variant/properties/basis.hpp>.
+template <auto Getter, auto Setter>
+class Property<Basis, Getter, Setter>;
 
 } // namespace godot
 
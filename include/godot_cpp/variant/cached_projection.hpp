@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*  cached_projection.hpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_CACHED_PROJECTION_HPP
+#define GODOT_CACHED_PROJECTION_HPP
+
+#include <godot_cpp/variant/plane.hpp>
+#include <godot_cpp/variant/projection.hpp>
+
+namespace godot {
+
+struct Transform3D;
+
+// A Projection along with its inverse, frustum planes and frustum corners, which
+// are computed on first use and kept until the projection is changed. Useful for
+// cameras and lights, which query them many times per frame for culling.
+//
+// The cache is filled from const methods, so a CachedProjection must not be
+// used from several threads at once, even read-only.
+class CachedProjection {
+	enum {
+		CACHED_INVERSE = 1 << 0,
+		CACHED_PLANES = 1 << 1,
+		CACHED_ENDPOINTS = 1 << 2,
+	};
+
+	Projection projection;
+
+	mutable uint32_t cached = 0;
+	mutable bool endpoints_valid = false;
+	mutable Projection inverse;
+	mutable Plane planes[6];
+	mutable Vector3 endpoints[8];
+
+	void _update_planes() const;
+	void _update_endpoints() const;
+
+public:
+	_FORCE_INLINE_ const Projection &get_projection() const { return projection; }
+	void set_projection(const Projection &p_projection);
+	// Direct access to the projection. Invalidates the cache, so don't keep the reference.
+	Projection &edit_projection();
+
+	// Unlike Projection::inverse(), returns an identity matrix if the projection is singular.
+	const Projection &get_inverse() const;
+
+	// The planes of Projection::get_projection_planes() in view space, in the order
+	// of Projection::Planes.
+	const Plane *get_view_planes() const;
+	void get_projection_planes(const Transform3D &p_transform, Plane *r_planes) const;
+
+	// Same as Projection::get_endpoints().
+	bool get_endpoints(const Transform3D &p_transform, Vector3 *r_8points) const;
+
+	CachedProjection() {}
+	CachedProjection(const Projection &p_projection);
+};
+
+} // namespace godot
+
+#endif // GODOT_CACHED_PROJECTION_HPP
@@ -32,6 +32,7 @@
 #define GODOT_CHAR_STRING_HPP
 
 #include <godot_cpp/templates/cowdata.hpp>
+#include <godot_cpp/templates/span.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -92,6 +93,9 @@ public:
 	_FORCE_INLINE_ const T *ptr() const { return _cowdata.ptr(); }
 	_FORCE_INLINE_ int size() const { return _cowdata.size(); }
 	Error resize(int p_size) { return _cowdata.resize(p_size); }
+	// Capacity includes the null terminator, like size().
+	Error reserve(int p_capacity) { return _cowdata.reserve(p_capacity); }
+	_FORCE_INLINE_ int get_capacity() const { return _cowdata.get_capacity(); }
 
 	_FORCE_INLINE_ T get(int p_index) const { return _cowdata.get(p_index); }
 	_FORCE_INLINE_ void set(int p_index, const T &p_elem) { _cowdata.set(p_index, p_elem); }
@@ -106,15 +110,49 @@ public:
 
 	_FORCE_INLINE_ CharStringT() {}
 	_FORCE_INLINE_ CharStringT(const CharStringT<T> &p_str) { _cowdata._ref(p_str._cowdata); }
+	_FORCE_INLINE_ CharStringT(CharStringT<T> &&p_str) :
+			_cowdata(std::move(p_str._cowdata)) {}
 	_FORCE_INLINE_ void operator=(const CharStringT<T> &p_str) { _cowdata._ref(p_str._cowdata); }
+	_FORCE_INLINE_ void operator=(CharStringT<T> &&p_str) { _cowdata = std::move(p_str._cowdata); }
 	_FORCE_INLINE_ CharStringT(const T *p_cstr) { copy_from(p_cstr); }
 
 	void operator=(const T *p_cstr);
 	bool operator<(const CharStringT<T> &p_right) const;
+	bool operator==(const CharStringT<T> &p_right) const;
+	bool operator==(const T *p_cstr) const;
+	_FORCE_INLINE_ bool operator!=(const CharStringT<T> &p_right) const { return !operator==(p_right); }
+	_FORCE_INLINE_ bool operator!=(const T *p_cstr) const { return !operator==(p_cstr); }
 	CharStringT<T> &operator+=(T p_char);
 	int length() const { return size() ? size() - 1 : 0; }
 	const T *get_data() const;
 	operator const T *() const { return get_data(); };
+	// Characters without the null terminator.
+	_FORCE_INLINE_ Span<T> span() const { return Span<T>(ptr(), length()); }
+
+	// Comparisons and searches use the stored length rather than looking for
+	// the null terminator. Characters are compared as unsigned values. Case
+	// folding only applies to ASCII letters.
+	int compare(const CharStringT<T> &p_right) const { return compare(span(), p_right.span()); }
+	int nocasecmp_to(const CharStringT<T> &p_right) const { return nocasecmp(span(), p_right.span()); }
+	int find(const CharStringT<T> &p_str, int p_from = 0) const { return (int)find(span(), p_str.span(), p_from); }
+	int find(const T *p_str, int p_from = 0) const;
+	int find_char(T p_char, int p_from = 0) const { return (int)find_char(span(), p_char, p_from); }
+	bool begins_with(const CharStringT<T> &p_str) const { return begins_with(span(), p_str.span()); }
+	bool begins_with(const T *p_str) const;
+	bool ends_with(const CharStringT<T> &p_str) const { return ends_with(span(), p_str.span()); }
+	bool ends_with(const T *p_str) const;
+	CharStringT<T> to_lower() const;
+	CharStringT<T> to_upper() const;
+	uint32_t hash() const;
+
+	// The same on any range of characters, such as a token in a larger buffer,
+	// without copying it into a CharString first.
+	static int compare(Span<T> p_a, Span<T> p_b);
+	static int nocasecmp(Span<T> p_a, Span<T> p_b);
+	static int64_t find(Span<T> p_src, Span<T> p_str, int64_t p_from = 0);
+	static int64_t find_char(Span<T> p_src, T p_char, int64_t p_from = 0);
+	static bool begins_with(Span<T> p_src, Span<T> p_str);
+	static bool ends_with(Span<T> p_src, Span<T> p_str);
 
 protected:
 	void copy_from(const T *p_cstr);
@@ -0,0 +1,316 @@
+/**************************************************************************/
+/*  mixed_precision.hpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_MIXED_PRECISION_HPP
+#define GODOT_MIXED_PRECISION_HPP
+
+#include <godot_cpp/variant/aabb.hpp>
+#include <godot_cpp/variant/plane.hpp>
+#include <godot_cpp/variant/spatial_math.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+namespace godot {
+
+// Vector3, Basis, Transform3D, Plane and AABB with an explicit component type,
+// so one build can mix precisions regardless of REAL_T_IS_DOUBLE: typically
+// world positions in double and everything relative to them in float (see
+// Transform3DT::relative_to()).
+//
+// These carry the hot subset of the real_t types' operations, computed by the
+// same SpatialMath templates. The real_t types remain the ones exchanged with the
+// engine, and conversions to and from them are explicit, so precision never
+// changes silently.
+
+template <typename T>
+struct _NO_DISCARD_ Vector3T {
+	union {
+		struct {
+			T x;
+			T y;
+			T z;
+		};
+
+		T coord[3] = { 0 };
+	};
+
+	_FORCE_INLINE_ const T &operator[](const int p_axis) const {
+		DEV_ASSERT((unsigned int)p_axis < 3);
+		return coord[p_axis];
+	}
+
+	_FORCE_INLINE_ T &operator[](const int p_axis) {
+		DEV_ASSERT((unsigned int)p_axis < 3);
+		return coord[p_axis];
+	}
+
+	_FORCE_INLINE_ T dot(const Vector3T &p_with) const { return SpatialMath::dot(*this, p_with); }
+	_FORCE_INLINE_ Vector3T cross(const Vector3T &p_with) const { return SpatialMath::cross(*this, p_with); }
+
+	_FORCE_INLINE_ T length_squared() const { return SpatialMath::length_squared(*this); }
+	_FORCE_INLINE_ T length() const { return Math::sqrt(length_squared()); }
+	_FORCE_INLINE_ T distance_squared_to(const Vector3T &p_to) const { return (p_to - *this).length_squared(); }
+	_FORCE_INLINE_ T distance_to(const Vector3T &p_to) const { return (p_to - *this).length(); }
+
+	_FORCE_INLINE_ void normalize() { SpatialMath::normalize(*this); }
+
+	_FORCE_INLINE_ Vector3T normalized() const {
+		Vector3T v = *this;
+		v.normalize();
+		return v;
+	}
+
+	_FORCE_INLINE_ Vector3T lerp(const Vector3T &p_to, const T p_weight) const { return SpatialMath::lerp(*this, p_to, p_weight); }
+
+	_FORCE_INLINE_ Vector3T min(const Vector3T &p_v) const { return Vector3T(MIN(x, p_v.x), MIN(y, p_v.y), MIN(z, p_v.z)); }
+	_FORCE_INLINE_ Vector3T max(const Vector3T &p_v) const { return Vector3T(MAX(x, p_v.x), MAX(y, p_v.y), MAX(z, p_v.z)); }
+	_FORCE_INLINE_ Vector3T abs() const { return Vector3T(Math::abs(x), Math::abs(y), Math::abs(z)); }
+
+	_FORCE_INLINE_ Vector3T operator+(const Vector3T &p_v) const { return Vector3T(x + p_v.x, y + p_v.y, z + p_v.z); }
+	_FORCE_INLINE_ Vector3T operator-(const Vector3T &p_v) const { return Vector3T(x - p_v.x, y - p_v.y, z - p_v.z); }
+	_FORCE_INLINE_ Vector3T operator*(const Vector3T &p_v) const { return Vector3T(x * p_v.x, y * p_v.y, z * p_v.z); }
+	_FORCE_INLINE_ Vector3T operator/(const Vector3T &p_v) const { return Vector3T(x / p_v.x, y / p_v.y, z / p_v.z); }
+	_FORCE_INLINE_ Vector3T operator*(const T p_scalar) const { return Vector3T(x * p_scalar, y * p_scalar, z * p_scalar); }
+	_FORCE_INLINE_ Vector3T operator/(const T p_scalar) const { return Vector3T(x / p_scalar, y / p_scalar, z / p_scalar); }
+	_FORCE_INLINE_ Vector3T operator-() const { return Vector3T(-x, -y, -z); }
+
+	_FORCE_INLINE_ Vector3T &operator+=(const Vector3T &p_v) { return *this = *this + p_v; }
+	_FORCE_INLINE_ Vector3T &operator-=(const Vector3T &p_v) { return *this = *this - p_v; }
+	_FORCE_INLINE_ Vector3T &operator*=(const Vector3T &p_v) { return *this = *this * p_v; }
+	_FORCE_INLINE_ Vector3T &operator/=(const Vector3T &p_v) { return *this = *this / p_v; }
+	_FORCE_INLINE_ Vector3T &operator*=(const T p_scalar) { return *this = *this * p_scalar; }
+	_FORCE_INLINE_ Vector3T &operator/=(const T p_scalar) { return *this = *this / p_scalar; }
+
+	_FORCE_INLINE_ bool operator==(const Vector3T &p_v) const { return x == p_v.x && y == p_v.y && z == p_v.z; }
+	_FORCE_INLINE_ bool operator!=(const Vector3T &p_v) const { return x != p_v.x || y != p_v.y || z != p_v.z; }
+
+	explicit operator Vector3() const { return Vector3((real_t)x, (real_t)y, (real_t)z); }
+
+	_FORCE_INLINE_ Vector3T() {}
+	_FORCE_INLINE_ Vector3T(const T p_x, const T p_y, const T p_z) {
+		x = p_x;
+		y = p_y;
+		z = p_z;
+	}
+	_FORCE_INLINE_ explicit Vector3T(const Vector3 &p_v) {
+		x = (T)p_v.x;
+		y = (T)p_v.y;
+		z = (T)p_v.z;
+	}
+	template <typename U>
+	_FORCE_INLINE_ explicit Vector3T(const Vector3T<U> &p_v) {
+		x = (T)p_v.x;
+		y = (T)p_v.y;
+		z = (T)p_v.z;
+	}
+};
+
+template <typename T>
+_FORCE_INLINE_ Vector3T<T> operator*(const T p_scalar, const Vector3T<T> &p_vec) {
+	return p_vec * p_scalar;
+}
+
+template <typename T>
+struct _NO_DISCARD_ BasisT {
+	Vector3T<T> rows[3] = {
+		Vector3T<T>(1, 0, 0),
+		Vector3T<T>(0, 1, 0),
+		Vector3T<T>(0, 0, 1)
+	};
+
+	_FORCE_INLINE_ const Vector3T<T> &operator[](int p_row) const { return rows[p_row]; }
+	_FORCE_INLINE_ Vector3T<T> &operator[](int p_row) { return rows[p_row]; }
+
+	_FORCE_INLINE_ Vector3T<T> xform(const Vector3T<T> &p_vector) const { return SpatialMath::basis_xform(*this, p_vector); }
+	_FORCE_INLINE_ Vector3T<T> xform_inv(const Vector3T<T> &p_vector) const { return SpatialMath::basis_xform_inv(*this, p_vector); }
+	_FORCE_INLINE_ T determinant() const { return SpatialMath::basis_determinant(*this); }
+
+	BasisT transposed() const {
+		BasisT tr = *this;
+		SpatialMath::basis_transpose(tr);
+		return tr;
+	}
+
+	BasisT inverse() const {
+		BasisT inv = *this;
+		SpatialMath::basis_invert(inv);
+		return inv;
+	}
+
+	_FORCE_INLINE_ BasisT operator*(const BasisT &p_matrix) const { return SpatialMath::basis_mul(*this, p_matrix); }
+	_FORCE_INLINE_ void operator*=(const BasisT &p_matrix) { *this = *this * p_matrix; }
+
+	explicit operator Basis() const {
+		return Basis(
+				(real_t)rows[0][0], (real_t)rows[0][1], (real_t)rows[0][2],
+				(real_t)rows[1][0], (real_t)rows[1][1], (real_t)rows[1][2],
+				(real_t)rows[2][0], (real_t)rows[2][1], (real_t)rows[2][2]);
+	}
+
+	_FORCE_INLINE_ BasisT() {}
+	_FORCE_INLINE_ BasisT(const Vector3T<T> &p_x, const Vector3T<T> &p_y, const Vector3T<T> &p_z) {
+		rows[0] = p_x;
+		rows[1] = p_y;
+		rows[2] = p_z;
+	}
+	_FORCE_INLINE_ BasisT(T p_xx, T p_xy, T p_xz, T p_yx, T p_yy, T p_yz, T p_zx, T p_zy, T p_zz) {
+		rows[0] = Vector3T<T>(p_xx, p_xy, p_xz);
+		rows[1] = Vector3T<T>(p_yx, p_yy, p_yz);
+		rows[2] = Vector3T<T>(p_zx, p_zy, p_zz);
+	}
+	_FORCE_INLINE_ explicit BasisT(const Basis &p_basis) {
+		for (int i = 0; i < 3; i++) {
+			rows[i] = Vector3T<T>(p_basis.rows[i]);
+		}
+	}
+	template <typename U>
+	_FORCE_INLINE_ explicit BasisT(const BasisT<U> &p_basis) {
+		for (int i = 0; i < 3; i++) {
+			rows[i] = Vector3T<T>(p_basis.rows[i]);
+		}
+	}
+};
+
+template <typename T>
+struct _NO_DISCARD_ PlaneT {
+	Vector3T<T> normal;
+	T d = 0;
+
+	_FORCE_INLINE_ T distance_to(const Vector3T<T> &p_point) const { return SpatialMath::plane_distance_to(*this, p_point); }
+	_FORCE_INLINE_ bool is_point_over(const Vector3T<T> &p_point) const { return SpatialMath::plane_is_point_over(*this, p_point); }
+
+	explicit operator Plane() const { return Plane(Vector3(normal), (real_t)d); }
+
+	_FORCE_INLINE_ PlaneT() {}
+	_FORCE_INLINE_ PlaneT(const Vector3T<T> &p_normal, T p_d) :
+			normal(p_normal),
+			d(p_d) {}
+	_FORCE_INLINE_ explicit PlaneT(const Plane &p_plane) :
+			normal(p_plane.normal),
+			d((T)p_plane.d) {}
+	template <typename U>
+	_FORCE_INLINE_ explicit PlaneT(const PlaneT<U> &p_plane) :
+			normal(p_plane.normal),
+			d((T)p_plane.d) {}
+};
+
+template <typename T>
+struct _NO_DISCARD_ AABBT {
+	Vector3T<T> position;
+	Vector3T<T> size;
+
+	_FORCE_INLINE_ Vector3T<T> get_end() const { return position + size; }
+	_FORCE_INLINE_ Vector3T<T> get_center() const { return position + (size * (T)0.5); }
+
+	_FORCE_INLINE_ bool intersects(const AABBT &p_aabb) const { return SpatialMath::aabb_intersects(*this, p_aabb); }
+	_FORCE_INLINE_ bool has_point(const Vector3T<T> &p_point) const { return SpatialMath::aabb_has_point(*this, p_point); }
+	_FORCE_INLINE_ bool inside_convex_shape(const PlaneT<T> *p_planes, int p_plane_count) const { return SpatialMath::aabb_inside_convex_shape(*this, p_planes, p_plane_count); }
+	_FORCE_INLINE_ void expand_to(const Vector3T<T> &p_vector) { SpatialMath::aabb_expand_to(*this, p_vector); }
+
+	_FORCE_INLINE_ AABBT merge(const AABBT &p_with) const {
+		AABBT aabb = *this;
+		SpatialMath::aabb_merge_with(aabb, p_with);
+		return aabb;
+	}
+
+	explicit operator AABB() const { return AABB(Vector3(position), Vector3(size)); }
+
+	_FORCE_INLINE_ AABBT() {}
+	_FORCE_INLINE_ AABBT(const Vector3T<T> &p_pos, const Vector3T<T> &p_size) :
+			position(p_pos),
+			size(p_size) {}
+	_FORCE_INLINE_ explicit AABBT(const AABB &p_aabb) :
+			position(p_aabb.position),
+			size(p_aabb.size) {}
+	template <typename U>
+	_FORCE_INLINE_ explicit AABBT(const AABBT<U> &p_aabb) :
+			position(p_aabb.position),
+			size(p_aabb.size) {}
+};
+
+template <typename T>
+struct _NO_DISCARD_ Transform3DT {
+	BasisT<T> basis;
+	Vector3T<T> origin;
+
+	_FORCE_INLINE_ Vector3T<T> xform(const Vector3T<T> &p_vector) const { return SpatialMath::transform_xform(*this, p_vector); }
+	_FORCE_INLINE_ Vector3T<T> xform_inv(const Vector3T<T> &p_vector) const { return SpatialMath::transform_xform_inv(*this, p_vector); }
+	_FORCE_INLINE_ AABBT<T> xform(const AABBT<T> &p_aabb) const { return SpatialMath::transform_xform_aabb(*this, p_aabb); }
+
+	Transform3DT affine_inverse() const {
+		Transform3DT inv = *this;
+		SpatialMath::transform_affine_invert(inv);
+		return inv;
+	}
+
+	_FORCE_INLINE_ Transform3DT operator*(const Transform3DT &p_transform) const {
+		Transform3DT t = *this;
+		SpatialMath::transform_mul(t, p_transform);
+		return t;
+	}
+
+	_FORCE_INLINE_ void operator*=(const Transform3DT &p_transform) { SpatialMath::transform_mul(*this, p_transform); }
+
+	// This transform with the origin moved by -p_origin, in precision U. The
+	// subtraction happens in T, so a double world transform can become an exact
+	// enough float transform relative to a camera or a floating origin.
+	template <typename U>
+	_FORCE_INLINE_ Transform3DT<U> relative_to(const Vector3T<T> &p_origin) const {
+		return Transform3DT<U>(BasisT<U>(basis), Vector3T<U>(origin - p_origin));
+	}
+
+	explicit operator Transform3D() const { return Transform3D(Basis(basis), Vector3(origin)); }
+
+	_FORCE_INLINE_ Transform3DT() {}
+	_FORCE_INLINE_ Transform3DT(const BasisT<T> &p_basis, const Vector3T<T> &p_origin) :
+			basis(p_basis),
+			origin(p_origin) {}
+	_FORCE_INLINE_ explicit Transform3DT(const Transform3D &p_transform) :
+			basis(p_transform.basis),
+			origin(p_transform.origin) {}
+	template <typename U>
+	_FORCE_INLINE_ explicit Transform3DT(const Transform3DT<U> &p_transform) :
+			basis(p_transform.basis),
+			origin(p_transform.origin) {}
+};
+
+typedef Vector3T<float> Vector3f;
+typedef Vector3T<double> Vector3d;
+typedef BasisT<float> Basisf;
+typedef BasisT<double> Basisd;
+typedef PlaneT<float> Planef;
+typedef PlaneT<double> Planed;
+typedef AABBT<float> AABBf;
+typedef AABBT<double> AABBd;
+typedef Transform3DT<float> Transform3Df;
+typedef Transform3DT<double> Transform3Dd;
+
+} // namespace godot
+
+#endif // GODOT_MIXED_PRECISION_HPP
@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*  packed_array_math.hpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PACKED_ARRAY_MATH_HPP
+#define GODOT_PACKED_ARRAY_MATH_HPP
+
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_float32_array.hpp>
+#include <godot_cpp/variant/packed_float64_array.hpp>
+
+namespace godot {
+
+// Vectorized math over the buffers of packed arrays (see MathKernels), instead of
+// one operator[] call through the engine per element.
+//
+// Functions that write take the destination first. It's resized to the size of
+// the sources, and can be one of them to work in place. Writing goes through
+// ptrw(), so if the destination shares its buffer with any other array, the
+// engine gives it a private copy first (copy-on-write): other arrays, including
+// sources that aren't the destination itself, are never modified. To avoid that
+// copy, pass an array that isn't shared, or a new empty one as destination.
+//
+// With p_threaded, arrays of at least THREADED_MIN_ELEMENTS elements are split
+// across WorkerThreadPool tasks. Don't use it from a WorkerThreadPool task.
+class PackedArrayMath {
+public:
+	static constexpr int64_t THREADED_MIN_ELEMENTS = 1 << 16;
+
+	static float sum(const PackedFloat32Array &p_array, bool p_threaded = false);
+	static double sum(const PackedFloat64Array &p_array, bool p_threaded = false);
+	// min() and max() of an empty array are errors, and return 0.
+	static float min(const PackedFloat32Array &p_array, bool p_threaded = false);
+	static double min(const PackedFloat64Array &p_array, bool p_threaded = false);
+	static float max(const PackedFloat32Array &p_array, bool p_threaded = false);
+	static double max(const PackedFloat64Array &p_array, bool p_threaded = false);
+	static float dot(const PackedFloat32Array &p_a, const PackedFloat32Array &p_b, bool p_threaded = false);
+	static double dot(const PackedFloat64Array &p_a, const PackedFloat64Array &p_b, bool p_threaded = false);
+
+	static void scale(PackedFloat32Array &r_dst, const PackedFloat32Array &p_src, float p_scale, bool p_threaded = false);
+	static void scale(PackedFloat64Array &r_dst, const PackedFloat64Array &p_src, double p_scale, bool p_threaded = false);
+	static void add(PackedFloat32Array &r_dst, const PackedFloat32Array &p_a, const PackedFloat32Array &p_b, bool p_threaded = false);
+	static void add(PackedFloat64Array &r_dst, const PackedFloat64Array &p_a, const PackedFloat64Array &p_b, bool p_threaded = false);
+	// r_dst = p_alpha * p_x + p_y
+	static void axpy(PackedFloat32Array &r_dst, float p_alpha, const PackedFloat32Array &p_x, const PackedFloat32Array &p_y, bool p_threaded = false);
+	static void axpy(PackedFloat64Array &r_dst, double p_alpha, const PackedFloat64Array &p_x, const PackedFloat64Array &p_y, bool p_threaded = false);
+	static void clamp(PackedFloat32Array &r_dst, const PackedFloat32Array &p_src, float p_min, float p_max, bool p_threaded = false);
+	static void clamp(PackedFloat64Array &r_dst, const PackedFloat64Array &p_src, double p_min, double p_max, bool p_threaded = false);
+	static void lerp(PackedFloat32Array &r_dst, const PackedFloat32Array &p_from, const PackedFloat32Array &p_to, float p_weight, bool p_threaded = false);
+	static void lerp(PackedFloat64Array &r_dst, const PackedFloat64Array &p_from, const PackedFloat64Array &p_to, double p_weight, bool p_threaded = false);
+
+	static void srgb_to_linear(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded = false);
+	static void linear_to_srgb(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded = false);
+	static void premultiply_alpha(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded = false);
+	// HSV colors are stored as (h, s, v, a).
+	static void rgb_to_hsv(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded = false);
+	static void hsv_to_rgb(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded = false);
+};
+
+} // namespace godot
+
+#endif // GODOT_PACKED_ARRAY_MATH_HPP
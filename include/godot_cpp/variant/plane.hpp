@@ -31,7 +31,7 @@
 #ifndef GODOT_PLANE_HPP
 #define GODOT_PLANE_HPP
 
-#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/properties_fwd.hpp>
 #include <godot_cpp/classes/global_constants.hpp>
 #include <godot_cpp/variant/vector3.hpp>
 
@@ -48,15 +48,18 @@ struct _NO_DISCARD_ Plane {
 
 	float get_x() const { return normal.x; }
 	float set_x(float value) { return normal.x = value; }
-	godot::Property<float, &Plane::get_x, &Plane::set_x> x() { return this; }
+	template <typename P = godot::Property<float, &Plane::get_x, &Plane::set_x>>
+	P x() { return this; }
 
 	float get_y() const { return normal.y; }
 	float set_y(float value) { return normal.y = value; }
-	godot::Property<float, &Plane::get_y, &Plane::set_y> y() { return this; }
+	template <typename P = godot::Property<float, &Plane::get_y, &Plane::set_y>>
+	P y() { return this; }
 
 	float get_z() const { return normal.z; }
 	float set_z(float value) { return normal.z = value; }
-	godot::Property<float, &Plane::get_z, &Plane::set_z> z() { return this; }
+	template <typename P = godot::Property<float, &Plane::get_z, &Plane::set_z>>
+	P z() { return this; }
 
 
 	void normalize();
@@ -107,11 +110,11 @@ struct _NO_DISCARD_ Plane {
 };
 
 bool Plane::is_point_over(const Vector3 &p_point) const {
-	return (normal.dot(p_point) > d);
+	return SpatialMath::plane_is_point_over(*this, p_point);
 }
 
 real_t Plane::distance_to(const Vector3 &p_point) const {
-	return (normal.dot(p_point) - d);
+	return SpatialMath::plane_distance_to(*this, p_point);
 }
 
 bool Plane::has_point(const Vector3 &p_point, real_t p_tolerance) const {
@@ -149,61 +152,9 @@ bool Plane::operator!=(const Plane &p_plane) const {
 	return normal != p_plane.normal || d != p_plane.d;
 }
 
-template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
-class Property<Plane, Getter, Setter> : public PropertyOperations<Property<Plane, Getter, Setter>> {
-    using T = Plane;
-    using Self = Property<Plane, Getter, Setter>;
-public:
-	PROPERTY_CORE(Getter, Setter)
-
-	float get_x() const { return get_normal().x; }
-	float get_y() const { return get_normal().y; }
-	float get_z() const { return get_normal().z; }
-
-	float set_x(float value) {
-		auto temp = get_normal();
-		temp.x = value;
-		set_normal(temp);
-		return temp.x;
-	}
-	float set_y(float value) {
-		auto temp = get_normal();
-		temp.y = value;
-		set_normal(temp);
-		return temp.y;
-	}
-	float set_z(float value) {
-		auto temp = get_normal();
-		temp.z = value;
-		set_normal(temp);
-		return temp.z;
-	}
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, x, Self);
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, y, Self);
-	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, z, Self);
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY(Vector3, normal, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, d, Self)
-
-	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(center, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(get_any_perpendicular_normal, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_point_over, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(has_point, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersect_3, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_ray, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersect_3_bind, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_ray_bind, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment_bind, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(project, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx_any_side, Self)
-
-};
+// Defined in <godot_cpp/variant/properties/plane.hpp>.
+template <auto Getter, auto Setter>
+class Property<Plane, Getter, Setter>;
 
 } // namespace godot
 
@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*  basis.hpp                                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_BASIS_HPP
+#define GODOT_PROPERTIES_BASIS_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/properties/quaternion.hpp>
+#include <godot_cpp/variant/properties/vector3.hpp>
+#include <godot_cpp/variant/basis.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Basis, Getter, Setter> : public PropertyOperations<Property<Basis, Getter, Setter>> {
+    using T = Basis;
+    using Self = Property<Basis, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	Vector3* get_rows() const { return get().rows; }
+	Vector3* set_rows(Vector3* value) {
+		auto temp = get();
+		memcpy(value, temp.rows, 3);
+		set(temp);
+		return temp.rows;
+	}
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3*, rows, Self);
+
+	Vector3 get_x() const { return get_rows()[0]; }
+	Vector3 get_y() const { return get_rows()[1]; }
+	Vector3 get_z() const { return get_rows()[2]; }
+
+	Vector3 set_x(Vector3 value) {
+		auto temp = get_rows();
+		temp[0] = value;
+		set_rows(temp);
+		return temp[0];
+	}
+	Vector3 set_y(Vector3 value) {
+		auto temp = get_rows();
+		temp[1] = value;
+		set_rows(temp);
+		return temp[1];
+	}
+	Vector3 set_z(Vector3 value) {
+		auto temp = get_rows();
+		temp[2] = value;
+		set_rows(temp);
+		return temp[2];
+	}
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, x, Self);
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, y, Self);
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, z, Self);
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(invert, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(transpose, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(transposed, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(determinant, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(from_z, Self)
+	// Have to be specified manually because overload sets don't go through the template mechanisms properly...
+	template<typename... Args> requires (getsetable<Self>) void rotate(Args... args) { auto temp = get(); temp.rotate(std::forward<Args>(args)...); set(temp); }
+	template<typename... Args> requires (!getsetable<Self> && getable<Self>) void rotate(Args... args) const { const auto temp = get(); temp.rotate(std::forward<Args>(args)...); }
+	template<typename... Args> requires (getsetable<Self>) auto rotated(Args... args) { auto temp = get(); auto ret = temp.rotated(std::forward<Args>(args)...); set(temp); return ret; }
+	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto rotated(Args... args) const { const auto temp = get(); auto ret = temp.rotated(std::forward<Args>(args)...); return ret; }
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler_normalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_rotation_axis_angle, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_rotation_axis_angle_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_rotation_quaternion, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_to_align, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotref_posscale_decomposition, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_euler, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(from_euler, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_quaternion, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_quaternion, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Quaternion, quaternion, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_axis_angle, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_axis_angle, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_orthogonal, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled_orthogonal, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(make_scale_uniform, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_uniform_scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_scale_abs, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_scale_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_axis_angle_scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_euler_scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_quaternion_scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(tdotx, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(tdoty, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(tdotz, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_orthogonal, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_diagonal, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_rotation, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(lerp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(slerp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_sh, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_columns, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_column, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_column, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector3, column, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_main_diagonal, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_zero, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(transpose_xform, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalized, Self)
+#ifdef MATH_CHECKS
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_symmetric, Self)
+#endif
+	GODOT_PROPERTY_WRAPPED_FUNCTION(diagonalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(looking_at, Self)
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_BASIS_HPP
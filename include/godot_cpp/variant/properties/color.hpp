@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  color.hpp                                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_COLOR_HPP
+#define GODOT_PROPERTIES_COLOR_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/color.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Color, Getter, Setter> : public PropertyOperations<Property<Color, Getter, Setter>> {
+    using T = Color;
+    using Self = Property<Color, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, r, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, g, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, b, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, a, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(int32_t, a8, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(int32_t, b8, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(int32_t, g8, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(int32_t, r8, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, h, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, s, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, v, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_rgba32, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_argb32, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_abgr32, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_rgba64, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_argb64, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_abgr64, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_html, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_h, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_s, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_v, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_hsv, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(clamp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(invert, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(inverted, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_luminance, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(lerp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(darkened, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(lightened, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(to_rgbe9995, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(blend, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(srgb_to_linear, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(linear_to_srgb, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_r8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_r8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_g8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_g8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_b8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_b8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_a8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_a8, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_h, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_s, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_v, Self)
+
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_COLOR_HPP
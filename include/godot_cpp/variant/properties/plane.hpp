@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  plane.hpp                                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_PLANE_HPP
+#define GODOT_PROPERTIES_PLANE_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/properties/vector3.hpp>
+#include <godot_cpp/variant/plane.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Plane, Getter, Setter> : public PropertyOperations<Property<Plane, Getter, Setter>> {
+    using T = Plane;
+    using Self = Property<Plane, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	float get_x() const { return get_normal().x; }
+	float get_y() const { return get_normal().y; }
+	float get_z() const { return get_normal().z; }
+
+	float set_x(float value) {
+		auto temp = get_normal();
+		temp.x = value;
+		set_normal(temp);
+		return temp.x;
+	}
+	float set_y(float value) {
+		auto temp = get_normal();
+		temp.y = value;
+		set_normal(temp);
+		return temp.y;
+	}
+	float set_z(float value) {
+		auto temp = get_normal();
+		temp.z = value;
+		set_normal(temp);
+		return temp.z;
+	}
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, x, Self);
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, y, Self);
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(float, z, Self);
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(Vector3, normal, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, d, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(center, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_any_perpendicular_normal, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_point_over, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(has_point, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersect_3, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_ray, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersect_3_bind, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_ray_bind, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment_bind, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(project, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx_any_side, Self)
+
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_PLANE_HPP
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  quaternion.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_QUATERNION_HPP
+#define GODOT_PROPERTIES_QUATERNION_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/quaternion.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Quaternion, Getter, Setter> : public PropertyOperations<Property<Quaternion, Getter, Setter>> {
+    using T = Quaternion;
+    using Self = Property<Quaternion, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, x, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, y, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, z, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(float, w, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(log, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(exp, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(dot, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(angle_to, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler_xyz, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler_yxz, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_euler, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(slerp, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(slerpni, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(spherical_cubic_interpolate, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(spherical_cubic_interpolate_in_time, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_axis, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_angle, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_axis_angle, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv, Self);
+
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_QUATERNION_HPP
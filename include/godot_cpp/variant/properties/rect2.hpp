@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*  rect2.hpp                                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_RECT2_HPP
+#define GODOT_PROPERTIES_RECT2_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/properties/vector2.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Rect2, Getter, Setter> : public PropertyOperations<Property<Rect2, Getter, Setter>> {
+    using T = Rect2;
+    using Self = Property<Rect2, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(Point2, position, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(Size2, size, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_area, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_center, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_transformed, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_segment, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(encloses, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(has_area, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersection, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(merge, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(has_point, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(grow, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(grow_by, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(grow_side, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(grow_side_bind, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(grow_individual, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(expand, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(expand_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(abs, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_support, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(intersects_filled_polygon, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_end, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_end, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY_NO_GET_SET(Vector2, end, Self)
+
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_RECT2_HPP
@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*  transform3d.hpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_TRANSFORM3D_HPP
+#define GODOT_PROPERTIES_TRANSFORM3D_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/properties/basis.hpp>
+#include <godot_cpp/variant/properties/vector3.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Transform3D, Getter, Setter> : public PropertyOperations<Property<Transform3D, Getter, Setter>> {
+    using T = Transform3D;
+    using Self = Property<Transform3D, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(Basis, basis, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(Vector3, origin, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(invert, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(affine_invert, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(affine_inverse, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_basis, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_look_at, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(looking_at, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scale, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_basis, Self)
+	template<typename... Args> requires (getsetable<Self>) void translate_local(Args... args) { auto temp = get(); temp.translate_local(std::forward<Args>(args)...); set(temp); }
+	template<typename... Args> requires (!getsetable<Self> && getable<Self>) void translate_local(Args... args) const { const auto temp = get(); temp.translate_local(std::forward<Args>(args)...); }
+	GODOT_PROPERTY_WRAPPED_FUNCTION(translated, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(translated_local, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
+	template<typename... Args> requires (getsetable<Self> ) auto xform(Args... args) { auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); set(temp); return ret; }
+	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform(Args... args) const { const auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); return ret; }
+	template<typename... Args> requires (getsetable<Self> ) auto xform_inv(Args... args) { auto temp = get(); auto ret = temp.xform_inv(std::forward<Args>(args)...); set(temp); return ret; }
+	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform_inv(Args... args) const { const auto temp = get(); auto ret = temp.xform_inv(std::forward<Args>(args)...); return ret; }
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_fast, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv_fast, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(interpolate_with, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse_xform, Self)
+	
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_TRANSFORM3D_HPP
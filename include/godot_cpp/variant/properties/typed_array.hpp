@@ -0,0 +1,50 @@
+/**************************************************************************/
+/*  typed_array.hpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef GODOT_PROPERTIES_TYPED_ARRAY_HPP
+#define GODOT_PROPERTIES_TYPED_ARRAY_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/properties/array.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+namespace godot {
+
+// Covers every element type, including objects. The Array methods are forwarded by the base.
+template <class T0, auto Getter, auto Setter>
+class Property<TypedArray<T0>, Getter, Setter> : public Property<Array, Getter, Setter>, public PropertyOperations<Property<TypedArray<T0>, Getter, Setter>> {
+	using T = TypedArray<T0>;
+	using Self = Property<TypedArray<T0>, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_TYPED_ARRAY_HPP
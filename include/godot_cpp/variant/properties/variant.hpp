@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  variant.hpp                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_VARIANT_HPP
+#define GODOT_PROPERTIES_VARIANT_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Variant, Getter, Setter> : public PropertyOperations<Property<Variant, Getter, Setter>> {
+    using T = Variant;
+    using Self = Property<Variant, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	// GODOT_PROPERTY_WRAPPED_FUNCTION(call, Self)
+	// GODOT_PROPERTY_WRAPPED_FUNCTION(call_static, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(evaluate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_named, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_indexed, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(set_keyed, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_named, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_indexed, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_keyed, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(in, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(iter_init, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(iter_next, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(iter_get, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_type, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(has_method, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(has_key, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(has_member, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(hash, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(recursive_hash, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(hash_compare, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(booleanize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(stringify, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(duplicate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(blend, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(interpolate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(get_type_name, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(can_convert, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(can_convert_strict, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(clear, Self)
+
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_VARIANT_HPP
@@ -0,0 +1,66 @@
+/**************************************************************************/
+/*  vector2i.hpp                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_VECTOR2I_HPP
+#define GODOT_PROPERTIES_VECTOR2I_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/vector2i.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Vector2i, Getter, Setter> : public PropertyOperations<Property<Vector2i, Getter, Setter>> {
+    using T = Vector2i;
+    using Self = Property<Vector2i, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, x, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, y, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, width, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, height, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(min_axis_index, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(max_axis_index, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(min, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(max, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(aspect, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(sign, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(abs, Self)	
+	GODOT_PROPERTY_WRAPPED_FUNCTION(clamp, Self)	
+
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_VECTOR2I_HPP
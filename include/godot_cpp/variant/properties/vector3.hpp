@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  vector3.hpp                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_PROPERTIES_VECTOR3_HPP
+#define GODOT_PROPERTIES_VECTOR3_HPP
+
+#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+
+namespace godot {
+
+template <auto Getter, auto Setter>
+class Property<Vector3, Getter, Setter> : public PropertyOperations<Property<Vector3, Getter, Setter>> {
+    using T = Vector3;
+    using Self = Property<Vector3, Getter, Setter>;
+public:
+	PROPERTY_CORE(Getter, Setter)
+
+	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, x, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, y, Self)
+	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, z, Self)
+
+	GODOT_PROPERTY_WRAPPED_FUNCTION(min_axis_index, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(max_axis_index, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(limit_length, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(zero, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(snap, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(snapped, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(lerp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(slerp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(cubic_interpolate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(cubic_interpolate_in_time, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(bezier_interpolate, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(move_toward, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_encode, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_decode, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_tangent_encode, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_tangent_decode, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(cross, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(dot, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(outer, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(abs, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(floor, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(sign, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(ceil, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(round, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(clamp, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_squared_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(posmod, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(posmodv, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(project, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(angle_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(signed_angle_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(direction_to, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(slide, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(bounce, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(reflect, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
+	GODOT_PROPERTY_WRAPPED_FUNCTION(is_zero_approx, Self)
+};
+
+} // namespace godot
+
+#endif // GODOT_PROPERTIES_VECTOR3_HPP
@@ -0,0 +1,343 @@
+/**************************************************************************/
+/*  spatial_math.hpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_SPATIAL_MATH_HPP
+#define GODOT_SPATIAL_MATH_HPP
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+
+namespace godot {
+
+// The 3D math shared by Vector3, Basis, Plane, AABB and Transform3D and by their
+// counterparts with an explicit component type in mixed_precision.hpp, written
+// once for any component type. The types forward to these, so both precisions
+// always compute the same thing.
+//
+// Vectors need x, y, z, operator[] and a constructor from three components, bases
+// need rows[3] and a constructor from nine components, planes need normal and d,
+// boxes need position and size, and transforms need basis and origin.
+
+namespace SpatialMath {
+
+/* Vectors */
+
+template <typename V>
+_FORCE_INLINE_ auto dot(const V &p_a, const V &p_b) {
+	return p_a.x * p_b.x + p_a.y * p_b.y + p_a.z * p_b.z;
+}
+
+template <typename V>
+_FORCE_INLINE_ V cross(const V &p_a, const V &p_b) {
+	return V(
+			(p_a.y * p_b.z) - (p_a.z * p_b.y),
+			(p_a.z * p_b.x) - (p_a.x * p_b.z),
+			(p_a.x * p_b.y) - (p_a.y * p_b.x));
+}
+
+template <typename V>
+_FORCE_INLINE_ auto length_squared(const V &p_v) {
+	auto x2 = p_v.x * p_v.x;
+	auto y2 = p_v.y * p_v.y;
+	auto z2 = p_v.z * p_v.z;
+
+	return x2 + y2 + z2;
+}
+
+template <typename V>
+_FORCE_INLINE_ void normalize(V &p_v) {
+	auto lengthsq = length_squared(p_v);
+	if (lengthsq == 0) {
+		p_v.x = p_v.y = p_v.z = 0;
+	} else {
+		auto length = Math::sqrt(lengthsq);
+		p_v.x /= length;
+		p_v.y /= length;
+		p_v.z /= length;
+	}
+}
+
+template <typename V, typename T>
+_FORCE_INLINE_ V lerp(const V &p_from, const V &p_to, const T p_weight) {
+	return V(
+			p_from.x + (p_weight * (p_to.x - p_from.x)),
+			p_from.y + (p_weight * (p_to.y - p_from.y)),
+			p_from.z + (p_weight * (p_to.z - p_from.z)));
+}
+
+/* Bases */
+
+template <typename B, typename V>
+_FORCE_INLINE_ V basis_xform(const B &p_basis, const V &p_vector) {
+	return V(
+			dot(p_basis.rows[0], p_vector),
+			dot(p_basis.rows[1], p_vector),
+			dot(p_basis.rows[2], p_vector));
+}
+
+template <typename B, typename V>
+_FORCE_INLINE_ V basis_xform_inv(const B &p_basis, const V &p_vector) {
+	const auto &rows = p_basis.rows;
+	return V(
+			(rows[0][0] * p_vector.x) + (rows[1][0] * p_vector.y) + (rows[2][0] * p_vector.z),
+			(rows[0][1] * p_vector.x) + (rows[1][1] * p_vector.y) + (rows[2][1] * p_vector.z),
+			(rows[0][2] * p_vector.x) + (rows[1][2] * p_vector.y) + (rows[2][2] * p_vector.z));
+}
+
+template <typename B>
+_FORCE_INLINE_ auto basis_determinant(const B &p_basis) {
+	const auto &rows = p_basis.rows;
+	return rows[0][0] * (rows[1][1] * rows[2][2] - rows[2][1] * rows[1][2]) -
+			rows[1][0] * (rows[0][1] * rows[2][2] - rows[2][1] * rows[0][2]) +
+			rows[2][0] * (rows[0][1] * rows[1][2] - rows[1][1] * rows[0][2]);
+}
+
+// Basis multiplication, each row of p_a transformed by the transpose of p_b.
+template <typename B>
+_FORCE_INLINE_ B basis_mul(const B &p_a, const B &p_b) {
+	B ret;
+	for (int i = 0; i < 3; i++) {
+		ret.rows[i] = basis_xform_inv(p_b, p_a.rows[i]);
+	}
+	return ret;
+}
+
+template <typename B>
+_FORCE_INLINE_ void basis_transpose(B &p_basis) {
+	SWAP(p_basis.rows[0][1], p_basis.rows[1][0]);
+	SWAP(p_basis.rows[0][2], p_basis.rows[2][0]);
+	SWAP(p_basis.rows[1][2], p_basis.rows[2][1]);
+}
+
+template <typename B>
+_FORCE_INLINE_ auto basis_cofac(const B &p_basis, int p_row1, int p_col1, int p_row2, int p_col2) {
+	const auto &rows = p_basis.rows;
+	return rows[p_row1][p_col1] * rows[p_row2][p_col2] - rows[p_row1][p_col2] * rows[p_row2][p_col1];
+}
+
+// Singular bases are an error with MATH_CHECKS, and produce non-finite values otherwise.
+template <typename B>
+void basis_invert(B &p_basis) {
+	const auto &rows = p_basis.rows;
+	decltype(basis_determinant(p_basis)) co[3] = {
+		basis_cofac(p_basis, 1, 1, 2, 2), basis_cofac(p_basis, 1, 2, 2, 0), basis_cofac(p_basis, 1, 0, 2, 1)
+	};
+	auto det = rows[0][0] * co[0] +
+			rows[0][1] * co[1] +
+			rows[0][2] * co[2];
+#ifdef MATH_CHECKS
+	ERR_FAIL_COND(det == 0);
+#endif
+	auto s = 1 / det;
+
+	p_basis = B(co[0] * s, basis_cofac(p_basis, 0, 2, 2, 1) * s, basis_cofac(p_basis, 0, 1, 1, 2) * s,
+			co[1] * s, basis_cofac(p_basis, 0, 0, 2, 2) * s, basis_cofac(p_basis, 0, 2, 1, 0) * s,
+			co[2] * s, basis_cofac(p_basis, 0, 1, 2, 0) * s, basis_cofac(p_basis, 0, 0, 1, 1) * s);
+}
+
+/* Planes */
+
+template <typename P, typename V>
+_FORCE_INLINE_ auto plane_distance_to(const P &p_plane, const V &p_point) {
+	return dot(p_plane.normal, p_point) - p_plane.d;
+}
+
+template <typename P, typename V>
+_FORCE_INLINE_ bool plane_is_point_over(const P &p_plane, const V &p_point) {
+	return dot(p_plane.normal, p_point) > p_plane.d;
+}
+
+/* Boxes */
+
+template <typename A>
+_FORCE_INLINE_ void aabb_check_size(const A &p_aabb) {
+#ifdef MATH_CHECKS
+	if (unlikely(p_aabb.size.x < 0 || p_aabb.size.y < 0 || p_aabb.size.z < 0)) {
+		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
+	}
+#endif
+}
+
+template <typename A>
+_FORCE_INLINE_ bool aabb_intersects(const A &p_a, const A &p_b) {
+#ifdef MATH_CHECKS
+	if (unlikely(p_a.size.x < 0 || p_a.size.y < 0 || p_a.size.z < 0 || p_b.size.x < 0 || p_b.size.y < 0 || p_b.size.z < 0)) {
+		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
+	}
+#endif
+	for (int i = 0; i < 3; i++) {
+		if (p_a.position[i] >= (p_b.position[i] + p_b.size[i])) {
+			return false;
+		}
+		if ((p_a.position[i] + p_a.size[i]) <= p_b.position[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename A, typename V>
+_FORCE_INLINE_ bool aabb_has_point(const A &p_aabb, const V &p_point) {
+	aabb_check_size(p_aabb);
+	for (int i = 0; i < 3; i++) {
+		if (p_point[i] < p_aabb.position[i]) {
+			return false;
+		}
+	}
+	for (int i = 0; i < 3; i++) {
+		if (p_point[i] > p_aabb.position[i] + p_aabb.size[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// False if the box is fully over any of the planes.
+template <typename A, typename P>
+_FORCE_INLINE_ bool aabb_inside_convex_shape(const A &p_aabb, const P *p_planes, int p_plane_count) {
+	auto half_extents = p_aabb.size * 0.5f;
+	auto ofs = p_aabb.position + half_extents;
+
+	for (int i = 0; i < p_plane_count; i++) {
+		const P &p = p_planes[i];
+		auto point = half_extents;
+		for (int j = 0; j < 3; j++) {
+			if (p.normal[j] < 0) {
+				point[j] = -point[j];
+			}
+		}
+		point += ofs;
+		if (plane_is_point_over(p, point)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename A, typename V>
+_FORCE_INLINE_ void aabb_expand_to(A &p_aabb, const V &p_vector) {
+	aabb_check_size(p_aabb);
+	V begin = p_aabb.position;
+	V end = p_aabb.position + p_aabb.size;
+
+	for (int i = 0; i < 3; i++) {
+		if (p_vector[i] < begin[i]) {
+			begin[i] = p_vector[i];
+		}
+		if (p_vector[i] > end[i]) {
+			end[i] = p_vector[i];
+		}
+	}
+
+	p_aabb.position = begin;
+	p_aabb.size = end - begin;
+}
+
+template <typename A>
+_FORCE_INLINE_ void aabb_merge_with(A &p_aabb, const A &p_with) {
+#ifdef MATH_CHECKS
+	if (unlikely(p_aabb.size.x < 0 || p_aabb.size.y < 0 || p_aabb.size.z < 0 || p_with.size.x < 0 || p_with.size.y < 0 || p_with.size.z < 0)) {
+		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
+	}
+#endif
+	auto min = p_aabb.position;
+	auto max = p_aabb.size + p_aabb.position;
+	auto end = p_with.size + p_with.position;
+
+	for (int i = 0; i < 3; i++) {
+		min[i] = (min[i] < p_with.position[i]) ? min[i] : p_with.position[i];
+		max[i] = (max[i] > end[i]) ? max[i] : end[i];
+	}
+
+	p_aabb.position = min;
+	p_aabb.size = max - min;
+}
+
+/* Transforms */
+
+template <typename X, typename V>
+_FORCE_INLINE_ V transform_xform(const X &p_transform, const V &p_vector) {
+	return V(
+			dot(p_transform.basis.rows[0], p_vector) + p_transform.origin.x,
+			dot(p_transform.basis.rows[1], p_vector) + p_transform.origin.y,
+			dot(p_transform.basis.rows[2], p_vector) + p_transform.origin.z);
+}
+
+template <typename X, typename V>
+_FORCE_INLINE_ V transform_xform_inv(const X &p_transform, const V &p_vector) {
+	return basis_xform_inv(p_transform.basis, p_vector - p_transform.origin);
+}
+
+template <typename X, typename A>
+_FORCE_INLINE_ A transform_xform_aabb(const X &p_transform, const A &p_aabb) {
+	/* https://dev.theomader.com/transform-bounding-boxes/ */
+	auto min = p_aabb.position;
+	auto max = p_aabb.position + p_aabb.size;
+	auto tmin = p_transform.origin;
+	auto tmax = p_transform.origin;
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			auto e = p_transform.basis.rows[i][j] * min[j];
+			auto f = p_transform.basis.rows[i][j] * max[j];
+			if (e < f) {
+				tmin[i] += e;
+				tmax[i] += f;
+			} else {
+				tmin[i] += f;
+				tmax[i] += e;
+			}
+		}
+	}
+	A r_aabb;
+	r_aabb.position = tmin;
+	r_aabb.size = tmax - tmin;
+	return r_aabb;
+}
+
+template <typename X>
+_FORCE_INLINE_ void transform_affine_invert(X &p_transform) {
+	basis_invert(p_transform.basis);
+	p_transform.origin = basis_xform(p_transform.basis, -p_transform.origin);
+}
+
+template <typename X>
+_FORCE_INLINE_ void transform_mul(X &p_transform, const X &p_with) {
+	p_transform.origin = transform_xform(p_transform, p_with.origin);
+	p_transform.basis = basis_mul(p_transform.basis, p_with.basis);
+}
+
+} // namespace SpatialMath
+
+} // namespace godot
+
+#endif // GODOT_SPATIAL_MATH_HPP
@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  string_builder.hpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_STRING_BUILDER_HPP
+#define GODOT_STRING_BUILDER_HPP
+
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/char_string.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+namespace godot {
+
+// Collects fragments in a local UTF-32 buffer and creates the String with a
+// single call once done, where each String::operator+ would create a new
+// engine string. Clearing keeps the memory, so a builder kept around builds
+// later strings without allocating.
+class StringBuilder {
+	LocalVector<char32_t> buffer;
+
+public:
+	StringBuilder &append(const String &p_string);
+	// Latin-1, like String(const char *).
+	StringBuilder &append(const char *p_cstring);
+	StringBuilder &append(const char32_t *p_cstring);
+	StringBuilder &append(char32_t p_char);
+	StringBuilder &append_utf8(const char *p_utf8, int p_length = -1);
+	StringBuilder &append_int(int64_t p_value);
+
+	_FORCE_INLINE_ StringBuilder &operator+(const String &p_string) { return append(p_string); }
+	_FORCE_INLINE_ StringBuilder &operator+(const char *p_cstring) { return append(p_cstring); }
+	_FORCE_INLINE_ StringBuilder &operator+(char32_t p_char) { return append(p_char); }
+	_FORCE_INLINE_ StringBuilder &operator+=(const String &p_string) { return append(p_string); }
+	_FORCE_INLINE_ StringBuilder &operator+=(const char *p_cstring) { return append(p_cstring); }
+	_FORCE_INLINE_ StringBuilder &operator+=(char32_t p_char) { return append(p_char); }
+
+	_FORCE_INLINE_ int get_string_length() const { return buffer.size(); }
+	_FORCE_INLINE_ bool is_empty() const { return buffer.is_empty(); }
+	_FORCE_INLINE_ void reserve(int p_length) { buffer.reserve(p_length); }
+	_FORCE_INLINE_ void clear() { buffer.clear(); }
+
+	String as_string() const;
+	_FORCE_INLINE_ operator String() const { return as_string(); }
+	// Encodes locally, without going through a String.
+	void utf8_into(CharString &r_reuse) const;
+	CharString utf8() const;
+};
+
+} // namespace godot
+
+#endif // GODOT_STRING_BUILDER_HPP
@@ -31,7 +31,7 @@
 #ifndef GODOT_TRANSFORM3D_HPP
 #define GODOT_TRANSFORM3D_HPP
 
-#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/properties_fwd.hpp>
 #include <godot_cpp/core/math.hpp>
 #include <godot_cpp/variant/aabb.hpp>
 #include <godot_cpp/variant/basis.hpp>
@@ -132,19 +132,11 @@ struct _NO_DISCARD_ Transform3D {
 };
 
 _FORCE_INLINE_ Vector3 Transform3D::xform(const Vector3 &p_vector) const {
-	return Vector3(
-			basis[0].dot(p_vector) + origin.x,
-			basis[1].dot(p_vector) + origin.y,
-			basis[2].dot(p_vector) + origin.z);
+	return SpatialMath::transform_xform(*this, p_vector);
 }
 
 _FORCE_INLINE_ Vector3 Transform3D::xform_inv(const Vector3 &p_vector) const {
-	Vector3 v = p_vector - origin;
-
-	return Vector3(
-			(basis.rows[0][0] * v.x) + (basis.rows[1][0] * v.y) + (basis.rows[2][0] * v.z),
-			(basis.rows[0][1] * v.x) + (basis.rows[1][1] * v.y) + (basis.rows[2][1] * v.z),
-			(basis.rows[0][2] * v.x) + (basis.rows[1][2] * v.y) + (basis.rows[2][2] * v.z));
+	return SpatialMath::transform_xform_inv(*this, p_vector);
 }
 
 // Neither the plane regular xform or xform_inv are particularly efficient,
@@ -164,28 +156,7 @@ _FORCE_INLINE_ Plane Transform3D::xform_inv(const Plane &p_plane) const {
 }
 
 _FORCE_INLINE_ AABB Transform3D::xform(const AABB &p_aabb) const {
-	/* https://dev.theomader.com/transform-bounding-boxes/ */
-	Vector3 min = p_aabb.position;
-	Vector3 max = p_aabb.position + p_aabb.size;
-	Vector3 tmin, tmax;
-	for (int i = 0; i < 3; i++) {
-		tmin[i] = tmax[i] = origin[i];
-		for (int j = 0; j < 3; j++) {
-			real_t e = basis[i][j] * min[j];
-			real_t f = basis[i][j] * max[j];
-			if (e < f) {
-				tmin[i] += e;
-				tmax[i] += f;
-			} else {
-				tmin[i] += f;
-				tmax[i] += e;
-			}
-		}
-	}
-	AABB r_aabb;
-	r_aabb.position = tmin;
-	r_aabb.size = tmax - tmin;
-	return r_aabb;
+	return SpatialMath::transform_xform_aabb(*this, p_aabb);
 }
 
 _FORCE_INLINE_ AABB Transform3D::xform_inv(const AABB &p_aabb) const {
@@ -271,49 +242,9 @@ _FORCE_INLINE_ Plane Transform3D::xform_inv_fast(const Plane &p_plane, const Tra
 	return Plane(normal, d);
 }
 
-template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
-class Property<Transform3D, Getter, Setter> : public PropertyOperations<Property<Transform3D, Getter, Setter>> {
-    using T = Transform3D;
-    using Self = Property<Transform3D, Getter, Setter>;
-public:
-	PROPERTY_CORE(Getter, Setter)
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY(Basis, basis, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(Vector3, origin, Self)
-
-	GODOT_PROPERTY_WRAPPED_FUNCTION(invert, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(affine_invert, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(affine_inverse, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate_basis, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(set_look_at, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(looking_at, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scale, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scaled_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_basis, Self)
-	template<typename... Args> requires (getsetable<Self>) void translate_local(Args... args) { auto temp = get(); temp.translate_local(std::forward<Args>(args)...); set(temp); }
-	template<typename... Args> requires (!getsetable<Self> && getable<Self>) void translate_local(Args... args) const { const auto temp = get(); temp.translate_local(std::forward<Args>(args)...); }
-	GODOT_PROPERTY_WRAPPED_FUNCTION(translated, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(translated_local, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthonormalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(orthogonalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
-	template<typename... Args> requires (getsetable<Self> ) auto xform(Args... args) { auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); set(temp); return ret; }
-	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform(Args... args) const { const auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); return ret; }
-	template<typename... Args> requires (getsetable<Self> ) auto xform_inv(Args... args) { auto temp = get(); auto ret = temp.xform_inv(std::forward<Args>(args)...); set(temp); return ret; }
-	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform_inv(Args... args) const { const auto temp = get(); auto ret = temp.xform_inv(std::forward<Args>(args)...); return ret; }
-	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_fast, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv_fast, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(interpolate_with, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse_xform, Self)
-	
-};
+// Defined in <godot_cpp/variant/properties/transform3d.hpp>.
+template <auto Getter, auto Setter>
+class Property<Transform3D, Getter, Setter>;
 
 } // namespace godot
 
@@ -73,16 +73,8 @@ public:
 		_FORCE_INLINE_ TypedArray() {                                                                            \
 			set_typed(m_variant_type, StringName(), Variant());                                                  \
 		}                                                                                                        \
-	};                                                                                                           \
-\
-	template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)                             \
-	class Property<TypedArray<m_type>, Getter, Setter> : public Property<Array, Getter, Setter>, public PropertyOperations<Property<TypedArray<m_type>, Getter, Setter>> {\
-		using T = TypedArray<m_type>;                                                                              \
-		using Self = Property<TypedArray<m_type>, Getter, Setter>;                                                 \
-	public:                                                                                                      \
-		PROPERTY_CORE(Getter, Setter)                                                                            \
-	};	
-	
+	};
+
 MAKE_TYPED_ARRAY(bool, Variant::BOOL)   
 MAKE_TYPED_ARRAY(uint8_t, Variant::INT)
 MAKE_TYPED_ARRAY(int8_t, Variant::INT)
@@ -143,6 +135,10 @@ public:
 	}                                                                                                        
 };
 
+// Defined in <godot_cpp/variant/properties/typed_array.hpp>.
+template <class T0, auto Getter, auto Setter>
+class Property<TypedArray<T0>, Getter, Setter>;
+
 } // namespace godot
 
 #endif // GODOT_TYPED_ARRAY_HPP
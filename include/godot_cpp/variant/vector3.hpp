@@ -31,9 +31,10 @@
 #ifndef GODOT_VECTOR3_HPP
 #define GODOT_VECTOR3_HPP
 
-#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/properties_fwd.hpp>
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/math.hpp>
+#include <godot_cpp/variant/spatial_math.hpp>
 
 namespace godot {
 
@@ -185,16 +186,11 @@ struct _NO_DISCARD_ Vector3 {
 };
 
 Vector3 Vector3::cross(const Vector3 &p_with) const {
-	Vector3 ret(
-			(y * p_with.z) - (z * p_with.y),
-			(z * p_with.x) - (x * p_with.z),
-			(x * p_with.y) - (y * p_with.x));
-
-	return ret;
+	return SpatialMath::cross(*this, p_with);
 }
 
 real_t Vector3::dot(const Vector3 &p_with) const {
-	return x * p_with.x + y * p_with.y + z * p_with.z;
+	return SpatialMath::dot(*this, p_with);
 }
 
 Vector3 Vector3::abs() const {
@@ -218,10 +214,7 @@ Vector3 Vector3::round() const {
 }
 
 Vector3 Vector3::lerp(const Vector3 &p_to, const real_t p_weight) const {
-	return Vector3(
-			x + (p_weight * (p_to.x - x)),
-			y + (p_weight * (p_to.y - y)),
-			z + (p_weight * (p_to.z - z)));
+	return SpatialMath::lerp(*this, p_to, p_weight);
 }
 
 Vector3 Vector3::slerp(const Vector3 &p_to, const real_t p_weight) const {
@@ -460,31 +453,15 @@ _FORCE_INLINE_ real_t vec3_dot(const Vector3 &p_a, const Vector3 &p_b) {
 }
 
 real_t Vector3::length() const {
-	real_t x2 = x * x;
-	real_t y2 = y * y;
-	real_t z2 = z * z;
-
-	return Math::sqrt(x2 + y2 + z2);
+	return Math::sqrt(SpatialMath::length_squared(*this));
 }
 
 real_t Vector3::length_squared() const {
-	real_t x2 = x * x;
-	real_t y2 = y * y;
-	real_t z2 = z * z;
-
-	return x2 + y2 + z2;
+	return SpatialMath::length_squared(*this);
 }
 
 void Vector3::normalize() {
-	real_t lengthsq = length_squared();
-	if (lengthsq == 0) {
-		x = y = z = 0;
-	} else {
-		real_t length = Math::sqrt(lengthsq);
-		x /= length;
-		y /= length;
-		z /= length;
-	}
+	SpatialMath::normalize(*this);
 }
 
 Vector3 Vector3::normalized() const {
@@ -525,66 +502,9 @@ Vector3 Vector3::reflect(const Vector3 &p_normal) const {
 	return 2.0f * p_normal * this->dot(p_normal) - *this;
 }
 
-
-
-template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
-class Property<Vector3, Getter, Setter> : public PropertyOperations<Property<Vector3, Getter, Setter>> {
-    using T = Vector3;
-    using Self = Property<Vector3, Getter, Setter>;
-public:
-	PROPERTY_CORE(Getter, Setter)
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, x, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, y, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(real_t, z, Self)
-
-	GODOT_PROPERTY_WRAPPED_FUNCTION(min_axis_index, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(max_axis_index, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(limit_length, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(zero, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(snap, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(snapped, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotate, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(rotated, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(lerp, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(slerp, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(cubic_interpolate, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(cubic_interpolate_in_time, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(bezier_interpolate, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(move_toward, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_encode, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_decode, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_tangent_encode, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(octahedron_tangent_decode, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(cross, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(dot, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(outer, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(abs, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(floor, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(sign, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(ceil, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(round, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(clamp, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_squared_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(posmod, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(posmodv, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(project, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(angle_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(signed_angle_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(direction_to, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(slide, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(bounce, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(reflect, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_equal_approx, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(is_zero_approx, Self)
-};
+// Defined in <godot_cpp/variant/properties/vector3.hpp>.
+template <auto Getter, auto Setter>
+class Property<Vector3, Getter, Setter>;
 
 } // namespace godot
 
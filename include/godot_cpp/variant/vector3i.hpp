@@ -31,7 +31,7 @@
 #ifndef GODOT_VECTOR3I_HPP
 #define GODOT_VECTOR3I_HPP
 
-#include <godot_cpp/classes/property_wrappers.hpp>
+#include <godot_cpp/classes/properties_fwd.hpp>
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/math.hpp>
 
@@ -328,27 +328,9 @@ void Vector3i::zero() {
 	x = y = z = 0;
 }
 
-template <auto Getter, auto Setter> PROPERTY_TEMPLATE_CONSTRAINT(Getter, Setter)
-class Property<Vector3i, Getter, Setter> : public PropertyOperations<Property<Vector3i, Getter, Setter>> {
-    using T = Vector3i;
-    using Self = Property<Vector3i, Getter, Setter>;
-public:
-	PROPERTY_CORE(Getter, Setter)
-
-	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, x, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, y, Self)
-	GODOT_PROPERTY_WRAPPED_PROPERTY(int32_t, z, Self)
-
-	GODOT_PROPERTY_WRAPPED_FUNCTION(min_axis_index, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(max_axis_index, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(zero, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(abs, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(sign, Self)
-	GODOT_PROPERTY_WRAPPED_FUNCTION(clamp, Self)
-
-};
+// Defined in <godot_cpp/variant/properties/vector3i.hpp>.
+template <auto Getter, auto Setter>
+class Property<Vector3i, Getter, Setter>;
 
 } // namespace godot
 
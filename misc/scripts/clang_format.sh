@@ -18,6 +18,8 @@ while read -r f; do
         continue
     elif [[ "$f" == "test/"* ]]; then
         continue
+    elif [[ "$f" == "benchmarks/"* ]]; then
+        continue
     fi
 
     python misc/scripts/copyright_headers.py "$f"
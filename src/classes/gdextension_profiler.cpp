@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  gdextension_profiler.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/classes/gdextension_profiler.hpp>
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/method_profiler.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int64_array.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+namespace godot {
+
+static Error save_string(const String &p_path, const String &p_content) {
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), vformat("Cannot open \"%s\" for writing.", p_path));
+	file->store_string(p_content);
+	return OK;
+}
+
+void GDExtensionProfiler::_bind_methods() {
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("is_enabled"), &GDExtensionProfiler::is_enabled);
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("reset"), &GDExtensionProfiler::reset);
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("get_report"), &GDExtensionProfiler::get_report);
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("get_csv"), &GDExtensionProfiler::get_csv);
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("get_json"), &GDExtensionProfiler::get_json);
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("save_csv", "path"), &GDExtensionProfiler::save_csv);
+	ClassDB::bind_static_method("GDExtensionProfiler", D_METHOD("save_json", "path"), &GDExtensionProfiler::save_json);
+}
+
+bool GDExtensionProfiler::is_enabled() {
+	return MethodProfiler::is_enabled();
+}
+
+void GDExtensionProfiler::reset() {
+	MethodProfiler::reset();
+}
+
+TypedArray<Dictionary> GDExtensionProfiler::get_report() {
+	TypedArray<Dictionary> report;
+	for (const MethodProfiler::Entry &entry : MethodProfiler::get_report()) {
+		const MethodProfiler::Counters &c = entry.counters;
+		PackedInt64Array histogram;
+		histogram.resize(MethodProfiler::HISTOGRAM_BUCKETS);
+		for (uint32_t i = 0; i < MethodProfiler::HISTOGRAM_BUCKETS; i++) {
+			histogram.set(i, (int64_t)c.histogram[i]);
+		}
+
+		Dictionary d;
+		d["class"] = entry.class_name;
+		d["method"] = entry.method_name;
+		d["variant_calls"] = (int64_t)c.variant_calls;
+		d["ptrcalls"] = (int64_t)c.ptrcalls;
+		d["total_nsec"] = (int64_t)c.total_nsec;
+		d["mean_nsec"] = (int64_t)c.get_mean_nsec();
+		d["max_nsec"] = (int64_t)c.max_nsec;
+		d["p50_nsec"] = (int64_t)c.get_percentile_nsec(0.5);
+		d["p99_nsec"] = (int64_t)c.get_percentile_nsec(0.99);
+		d["histogram"] = histogram;
+		report.push_back(d);
+	}
+	return report;
+}
+
+String GDExtensionProfiler::get_csv() {
+	return MethodProfiler::get_csv();
+}
+
+String GDExtensionProfiler::get_json() {
+	return MethodProfiler::get_json();
+}
+
+Error GDExtensionProfiler::save_csv(const String &p_path) {
+	return save_string(p_path, MethodProfiler::get_csv());
+}
+
+Error GDExtensionProfiler::save_json(const String &p_path) {
+	return save_string(p_path, MethodProfiler::get_json());
+}
+
+} // namespace godot
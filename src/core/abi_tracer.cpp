@@ -0,0 +1,250 @@
+/**************************************************************************/
+/*  abi_tracer.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/abi_tracer.hpp>
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+#include <godot_cpp/variant/string_builder.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace godot {
+
+std::atomic<bool> ABITracer::recording = false;
+
+namespace {
+
+struct Event {
+	std::atomic<const char *> name;
+	std::atomic<GDExtensionMethodBindPtr> method_bind;
+	std::atomic<uint64_t> begin;
+	std::atomic<uint64_t> end;
+};
+
+// Only the owning thread writes, `head` counts the events written so far.
+// Allocated with the global operator new rather than memnew(), which would go
+// through the traced `mem_alloc`.
+struct ThreadBuffer {
+	uint32_t thread_index = 0;
+	std::atomic<uint64_t> head = 0;
+	Event events[GODOT_ABI_TRACER_BUFFER_SIZE];
+};
+
+struct EventCopy {
+	uint32_t thread_index;
+	const char *name;
+	GDExtensionMethodBindPtr method_bind;
+	uint64_t begin;
+	uint64_t end;
+};
+
+struct MethodName {
+	StringName class_name;
+	StringName method_name;
+};
+
+// Threads keep their buffer until clear(), see MethodProfiler.
+SpinLock registry_lock;
+std::vector<ThreadBuffer *> threads;
+SpinLock method_names_lock;
+std::unordered_map<GDExtensionMethodBindPtr, MethodName> method_names;
+
+std::atomic<uint32_t> generation = 1;
+thread_local ThreadBuffer *thread_buffer = nullptr;
+thread_local uint32_t thread_generation = 0;
+
+std::atomic<uint64_t> start_nsec = 0;
+std::atomic<uint64_t> stop_nsec = 0;
+
+ThreadBuffer *get_thread_buffer() {
+	const uint32_t current = generation.load(std::memory_order_acquire);
+	if (likely(thread_generation == current)) {
+		return thread_buffer;
+	}
+	ThreadBuffer *buffer = new ThreadBuffer;
+	registry_lock.lock();
+	buffer->thread_index = (uint32_t)threads.size();
+	threads.push_back(buffer);
+	registry_lock.unlock();
+	thread_buffer = buffer;
+	thread_generation = current;
+	return buffer;
+}
+
+// Copies the events of one thread while it may still be writing. An event is
+// kept only if the ring buffer didn't wrap around to its slot during the copy.
+void copy_events(const ThreadBuffer *p_buffer, uint64_t p_from_nsec, uint64_t p_to_nsec, std::vector<EventCopy> &r_events) {
+	const uint64_t head = p_buffer->head.load(std::memory_order_acquire);
+	const uint64_t first = head > GODOT_ABI_TRACER_BUFFER_SIZE ? head - GODOT_ABI_TRACER_BUFFER_SIZE : 0;
+	const size_t copied_from = r_events.size();
+	for (uint64_t i = first; i < head; i++) {
+		const Event &event = p_buffer->events[i % GODOT_ABI_TRACER_BUFFER_SIZE];
+		r_events.push_back({
+				p_buffer->thread_index,
+				event.name.load(std::memory_order_relaxed),
+				event.method_bind.load(std::memory_order_relaxed),
+				event.begin.load(std::memory_order_relaxed),
+				event.end.load(std::memory_order_relaxed),
+		});
+	}
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	const uint64_t head_after = p_buffer->head.load(std::memory_order_relaxed);
+	const uint64_t overwritten = head_after >= GODOT_ABI_TRACER_BUFFER_SIZE ? head_after - GODOT_ABI_TRACER_BUFFER_SIZE + 1 : 0;
+	size_t kept = copied_from;
+	for (uint64_t i = first; i < head; i++) {
+		const EventCopy &event = r_events[copied_from + (i - first)];
+		if (i >= overwritten && event.begin >= p_from_nsec && event.end <= p_to_nsec) {
+			r_events[kept++] = event;
+		}
+	}
+	r_events.resize(kept);
+}
+
+// Chrome expects microseconds, keep the nanoseconds as decimals.
+void append_usec(StringBuilder &r_sb, uint64_t p_nsec) {
+	const uint64_t fraction = p_nsec % 1000;
+	r_sb.append_int((int64_t)(p_nsec / 1000)).append(U'.');
+	r_sb.append(char32_t(U'0' + fraction / 100)).append(char32_t(U'0' + fraction / 10 % 10)).append(char32_t(U'0' + fraction % 10));
+}
+
+} // namespace
+
+void ABITracer::start() {
+	start_nsec.store(get_ticks_nsec(), std::memory_order_relaxed);
+	stop_nsec.store(UINT64_MAX, std::memory_order_relaxed);
+	recording.store(true, std::memory_order_release);
+}
+
+void ABITracer::stop() {
+	recording.store(false, std::memory_order_release);
+	stop_nsec.store(get_ticks_nsec(), std::memory_order_relaxed);
+}
+
+uint64_t ABITracer::get_ticks_nsec() {
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ABITracer::record(const char *p_name, GDExtensionMethodBindPtr p_method_bind, uint64_t p_begin_nsec, uint64_t p_end_nsec) {
+	ThreadBuffer *buffer = get_thread_buffer();
+	const uint64_t index = buffer->head.load(std::memory_order_relaxed);
+	// Readers that see this event also see that `head` reached `index`, see copy_events().
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Event &event = buffer->events[index % GODOT_ABI_TRACER_BUFFER_SIZE];
+	event.name.store(p_name, std::memory_order_relaxed);
+	event.method_bind.store(p_method_bind, std::memory_order_relaxed);
+	event.begin.store(p_begin_nsec, std::memory_order_relaxed);
+	event.end.store(p_end_nsec, std::memory_order_relaxed);
+	buffer->head.store(index + 1, std::memory_order_release);
+}
+
+void ABITracer::register_method_bind(GDExtensionMethodBindPtr p_method_bind, GDExtensionConstStringNamePtr p_class_name, GDExtensionConstStringNamePtr p_method_name, GDExtensionInt p_hash) {
+	if (!p_method_bind) {
+		return;
+	}
+	MethodName name = { *reinterpret_cast<const StringName *>(p_class_name), *reinterpret_cast<const StringName *>(p_method_name) };
+	method_names_lock.lock();
+	method_names[p_method_bind] = name;
+	method_names_lock.unlock();
+}
+
+String ABITracer::get_chrome_trace() {
+	const uint64_t from = start_nsec.load(std::memory_order_relaxed);
+	const uint64_t to = stop_nsec.load(std::memory_order_relaxed);
+
+	std::vector<EventCopy> events;
+	uint32_t thread_count = 0;
+	registry_lock.lock();
+	for (const ThreadBuffer *buffer : threads) {
+		copy_events(buffer, from, to, events);
+	}
+	thread_count = (uint32_t)threads.size();
+	registry_lock.unlock();
+
+	StringBuilder sb;
+	sb.append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	for (uint32_t i = 0; i < thread_count; i++) {
+		sb.append(i == 0 ? "\n" : ",\n");
+		sb.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":").append_int(i);
+		sb.append(",\"args\":{\"name\":\"Thread ").append_int(i).append("\"}}");
+	}
+	for (const EventCopy &event : events) {
+		sb.append(",\n{\"name\":\"");
+		if (event.method_bind) {
+			method_names_lock.lock();
+			auto it = method_names.find(event.method_bind);
+			MethodName name = it != method_names.end() ? it->second : MethodName();
+			method_names_lock.unlock();
+			sb.append(String(name.class_name)).append(U'.').append(String(name.method_name));
+		} else {
+			sb.append(event.name);
+		}
+		sb.append("\",\"cat\":\"abi\",\"ph\":\"X\",\"pid\":1,\"tid\":").append_int(event.thread_index);
+		sb.append(",\"ts\":");
+		append_usec(sb, event.begin - from);
+		sb.append(",\"dur\":");
+		append_usec(sb, event.end - event.begin);
+		sb.append(U'}');
+	}
+	sb.append("\n]}\n");
+	return sb.as_string();
+}
+
+Error ABITracer::save_chrome_trace(const String &p_path) {
+	const String trace = get_chrome_trace();
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), vformat("Cannot open \"%s\" for writing.", p_path));
+	file->store_string(trace);
+	return OK;
+}
+
+void ABITracer::clear() {
+	recording.store(false, std::memory_order_release);
+	registry_lock.lock();
+	for (ThreadBuffer *buffer : threads) {
+		delete buffer;
+	}
+	threads.clear();
+	generation.fetch_add(1, std::memory_order_release);
+	registry_lock.unlock();
+
+	method_names_lock.lock();
+	method_names.clear();
+	method_names_lock.unlock();
+}
+
+} // namespace godot
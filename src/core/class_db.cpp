@@ -34,6 +34,7 @@
 #include <godot_cpp/godot.hpp>
 
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/core/method_profiler.hpp>
 
 #include <algorithm>
 
@@ -183,6 +184,10 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const M
 }
 
 void ClassDB::bind_method_godot(const StringName &p_class_name, MethodBind *p_method) {
+#ifdef GODOT_METHOD_PROFILER_ENABLED
+	MethodProfiler::register_method(p_class_name, p_method);
+#endif
+
 	std::vector<GDExtensionVariantPtr> def_args;
 	const std::vector<Variant> &def_args_val = p_method->get_default_arguments();
 	def_args.resize(def_args_val.size());
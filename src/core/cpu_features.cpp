@@ -0,0 +1,264 @@
+/**************************************************************************/
+/*  cpu_features.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/cpu_features.hpp>
+
+#include <godot_cpp/core/error_macros.hpp>
+
+#if defined(GODOT_CPU_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace godot {
+
+uint32_t CPUFeatures::features = 0;
+CPUFeatures::SIMDLevel CPUFeatures::simd_level = CPUFeatures::SIMD_LEVEL_SCALAR;
+bool CPUFeatures::initialized = false;
+
+CPUDispatch::SelectFunc CPUDispatch::selectors[CPUDispatch::MAX_SELECTORS] = {};
+int CPUDispatch::selector_count = 0;
+
+// Selectors are registered from static initializers, before any engine function can be used
+// to report errors, so overflows are only counted here and reported on initialization.
+static int dropped_selectors = 0;
+
+#if defined(GODOT_CPU_X86)
+
+static void _cpuid(uint32_t p_leaf, uint32_t p_subleaf, uint32_t r_regs[4]) {
+#if defined(_MSC_VER)
+	int regs[4];
+	__cpuidex(regs, (int)p_leaf, (int)p_subleaf);
+	for (int i = 0; i < 4; i++) {
+		r_regs[i] = (uint32_t)regs[i];
+	}
+#else
+	__cpuid_count(p_leaf, p_subleaf, r_regs[0], r_regs[1], r_regs[2], r_regs[3]);
+#endif
+}
+
+// Only valid when CPUID reports OSXSAVE.
+static uint64_t _xgetbv0() {
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32_t eax, edx;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+#endif // GODOT_CPU_X86
+
+void CPUFeatures::_detect() {
+	features = 0;
+
+#if defined(GODOT_CPU_X86)
+	uint32_t regs[4] = { 0, 0, 0, 0 };
+	_cpuid(0, 0, regs);
+	const uint32_t max_leaf = regs[0];
+	if (max_leaf < 1) {
+		return;
+	}
+
+	_cpuid(1, 0, regs);
+	const uint32_t ecx1 = regs[2];
+	const uint32_t edx1 = regs[3];
+
+	if (edx1 & (1u << 26)) {
+		features |= FEATURE_SSE2;
+	}
+	if (ecx1 & (1u << 0)) {
+		features |= FEATURE_SSE3;
+	}
+	if (ecx1 & (1u << 9)) {
+		features |= FEATURE_SSSE3;
+	}
+	if (ecx1 & (1u << 19)) {
+		features |= FEATURE_SSE4_1;
+	}
+	if (ecx1 & (1u << 20)) {
+		features |= FEATURE_SSE4_2;
+	}
+	if (ecx1 & (1u << 23)) {
+		features |= FEATURE_POPCNT;
+	}
+
+	// AVX and AVX-512 registers must also be saved by the OS on context switches,
+	// which is reported in XCR0.
+	bool os_avx = false;
+	bool os_avx512 = false;
+	if (ecx1 & (1u << 27)) { // OSXSAVE
+		const uint64_t xcr0 = _xgetbv0();
+		os_avx = (xcr0 & 0x6) == 0x6; // XMM and YMM state.
+		os_avx512 = os_avx && (xcr0 & 0xe0) == 0xe0; // Opmask, ZMM_Hi256 and Hi16_ZMM state.
+	}
+
+	if (os_avx) {
+		if (ecx1 & (1u << 28)) {
+			features |= FEATURE_AVX;
+		}
+		if (ecx1 & (1u << 12)) {
+			features |= FEATURE_FMA;
+		}
+		if (ecx1 & (1u << 29)) {
+			features |= FEATURE_F16C;
+		}
+	}
+
+	if (max_leaf >= 7) {
+		_cpuid(7, 0, regs);
+		const uint32_t ebx7 = regs[1];
+
+		if (ebx7 & (1u << 3)) {
+			features |= FEATURE_BMI1;
+		}
+		if (ebx7 & (1u << 8)) {
+			features |= FEATURE_BMI2;
+		}
+		if (os_avx && (ebx7 & (1u << 5))) {
+			features |= FEATURE_AVX2;
+		}
+		if (os_avx512) {
+			if (ebx7 & (1u << 16)) {
+				features |= FEATURE_AVX512F;
+			}
+			if (ebx7 & (1u << 17)) {
+				features |= FEATURE_AVX512DQ;
+			}
+			if (ebx7 & (1u << 30)) {
+				features |= FEATURE_AVX512BW;
+			}
+			if (ebx7 & (1u << 31)) {
+				features |= FEATURE_AVX512VL;
+			}
+		}
+	}
+#elif defined(GODOT_CPU_ARM_NEON)
+	features |= FEATURE_NEON;
+#endif
+}
+
+void CPUFeatures::initialize() {
+	if (!initialized) {
+		_detect();
+		initialized = true;
+	}
+
+	if (dropped_selectors > 0) {
+		ERR_PRINT("Too many CPU dispatch selectors registered, some kernels will stay on their scalar implementation.");
+		dropped_selectors = 0;
+	}
+
+	simd_level = get_supported_simd_level();
+	if (simd_level > get_compiled_simd_level()) {
+		simd_level = get_compiled_simd_level();
+	}
+	CPUDispatch::select_all(simd_level);
+}
+
+CPUFeatures::SIMDLevel CPUFeatures::get_supported_simd_level() {
+	if (has_feature(Feature(FEATURE_AVX512F | FEATURE_AVX512DQ | FEATURE_AVX512BW | FEATURE_AVX512VL | FEATURE_AVX2 | FEATURE_FMA))) {
+		return SIMD_LEVEL_AVX512;
+	}
+	if (has_feature(Feature(FEATURE_AVX | FEATURE_AVX2 | FEATURE_FMA))) {
+		return SIMD_LEVEL_AVX2;
+	}
+	if (has_feature(Feature(FEATURE_SSSE3 | FEATURE_SSE4_1))) {
+		return SIMD_LEVEL_SSE4_1;
+	}
+	return SIMD_LEVEL_SCALAR;
+}
+
+CPUFeatures::SIMDLevel CPUFeatures::get_compiled_simd_level() {
+#if defined(GODOT_SIMD_DISPATCH_ENABLED)
+	return SIMD_LEVEL_AVX512;
+#else
+	return SIMD_LEVEL_SCALAR;
+#endif
+}
+
+void CPUFeatures::set_max_simd_level(SIMDLevel p_level) {
+	ERR_FAIL_INDEX(p_level, SIMD_LEVEL_MAX);
+	ERR_FAIL_COND_MSG(!initialized, "CPU features must be initialized before selecting a SIMD level.");
+
+	SIMDLevel level = get_supported_simd_level();
+	if (level > get_compiled_simd_level()) {
+		level = get_compiled_simd_level();
+	}
+	if (level > p_level) {
+		level = p_level;
+	}
+	if (level == simd_level) {
+		return;
+	}
+	simd_level = level;
+	CPUDispatch::select_all(simd_level);
+}
+
+const char *CPUFeatures::get_simd_level_name(SIMDLevel p_level) {
+	switch (p_level) {
+		case SIMD_LEVEL_SCALAR:
+			return "scalar";
+		case SIMD_LEVEL_SSE4_1:
+			return "sse4_1";
+		case SIMD_LEVEL_AVX2:
+			return "avx2";
+		case SIMD_LEVEL_AVX512:
+			return "avx512";
+		default:
+			return "unknown";
+	}
+}
+
+void CPUDispatch::register_selector(SelectFunc p_func) {
+	if (selector_count == MAX_SELECTORS) {
+		dropped_selectors++;
+		return;
+	}
+	selectors[selector_count++] = p_func;
+
+	// Kernel groups registered after initialization (e.g. from a lazily loaded module)
+	// are selected immediately.
+	if (CPUFeatures::is_initialized()) {
+		p_func(CPUFeatures::get_simd_level());
+	}
+}
+
+void CPUDispatch::select_all(CPUFeatures::SIMDLevel p_level) {
+	for (int i = 0; i < selector_count; i++) {
+		selectors[i](p_level);
+	}
+}
+
+} // namespace godot
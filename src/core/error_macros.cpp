@@ -33,50 +33,202 @@
 #include <godot_cpp/godot.hpp>
 #include <godot_cpp/variant/string.hpp>
 
+#include <cinttypes>
 #include <cstdio>
 
 namespace godot {
 
-void _err_print_error(const char *p_function, const char *p_file, int p_line, const char *p_error, bool p_editor_notify, bool p_is_warning) {
-	if (p_is_warning) {
-		internal::gdextension_interface_print_warning(p_error, p_function, p_file, p_line, p_editor_notify);
+namespace {
+
+// How many errors each call site printed, by file and line. The file is keyed
+// on the address of its __FILE__ string. Identical literals are merged within a
+// translation unit, and usually across the binary, but a call site in a header
+// can get a slot for each translation unit that includes it where they aren't,
+// and is then rate limited separately in each of them.
+struct ErrorCallSite {
+	std::atomic<uint64_t> key;
+	std::atomic<uint64_t> count;
+};
+
+static_assert(GODOT_ERROR_RATE_LIMIT_EVERY > 0, "GODOT_ERROR_RATE_LIMIT_EVERY must be at least 1.");
+
+constexpr uint32_t ERROR_CALL_SITE_COUNT = 1024;
+constexpr uint32_t ERROR_CALL_SITE_PROBES = 16;
+
+ErrorCallSite error_call_sites[ERROR_CALL_SITE_COUNT];
+// Shared by the call sites that find no free slot once the table is crowded, so
+// they're still rate limited, together.
+std::atomic<uint64_t> error_overflow_count;
+
+// p_message may be null. The number of suppressed errors is appended to the
+// message, or to the error if the message is empty.
+void _err_print(const char *p_function, const char *p_file, int p_line, const char *p_error, const char *p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed) {
+	char buffer[1024];
+	if (p_suppressed > 0) {
+		const bool to_message = p_message && p_message[0] != '\0';
+		snprintf(buffer, sizeof(buffer), "%s (%" PRIu64 " similar %s suppressed)", to_message ? p_message : p_error, p_suppressed, p_is_warning ? "warnings" : "errors");
+		if (to_message) {
+			p_message = buffer;
+		} else {
+			p_error = buffer;
+		}
+	}
+
+	if (p_message) {
+		if (p_is_warning) {
+			internal::gdextension_interface_print_warning_with_message(p_error, p_message, p_function, p_file, p_line, p_editor_notify);
+		} else {
+			internal::gdextension_interface_print_error_with_message(p_error, p_message, p_function, p_file, p_line, p_editor_notify);
+		}
+	} else {
+		if (p_is_warning) {
+			internal::gdextension_interface_print_warning(p_error, p_function, p_file, p_line, p_editor_notify);
+		} else {
+			internal::gdextension_interface_print_error(p_error, p_function, p_file, p_line, p_editor_notify);
+		}
+	}
+}
+
+// Formats into a buffer on the stack, so printing the error doesn't allocate.
+void _err_format_index_error(char *r_buffer, size_t p_size, int64_t p_index, int64_t p_count, const char *p_index_str, const char *p_count_str, bool p_fatal) {
+	const char *prefix = p_fatal ? "FATAL: " : "";
+	if (p_index_str[0] == '\0') {
+		// Stripped by GODOT_STRIP_ERROR_MESSAGES.
+		snprintf(r_buffer, p_size, "%sIndex %" PRId64 " is out of bounds (size %" PRId64 ").", prefix, p_index, p_count);
 	} else {
-		internal::gdextension_interface_print_error(p_error, p_function, p_file, p_line, p_editor_notify);
+		snprintf(r_buffer, p_size, "%sIndex %s = %" PRId64 " is out of bounds (%s = %" PRId64 ").", prefix, p_index_str, p_index, p_count_str, p_count);
 	}
 }
 
+} // namespace
+
+bool _err_rate_limit(uint64_t p_count, uint64_t &r_suppressed) {
+	r_suppressed = 0;
+	if (p_count <= GODOT_ERROR_RATE_LIMIT_FIRST) {
+		return true;
+	}
+	if ((p_count - GODOT_ERROR_RATE_LIMIT_FIRST) % GODOT_ERROR_RATE_LIMIT_EVERY != 0) {
+		return false;
+	}
+	r_suppressed = GODOT_ERROR_RATE_LIMIT_EVERY - 1;
+	return true;
+}
+
+bool _err_rate_check(const char *p_file, int p_line, uint64_t &r_suppressed) {
+	uint64_t key = uint64_t(uintptr_t(p_file)) * 0x9e3779b97f4a7c15 + uint64_t(p_line);
+	if (key == 0) {
+		key = 1;
+	}
+
+	const uint32_t slot = uint32_t(key >> 32);
+	for (uint32_t i = 0; i < ERROR_CALL_SITE_PROBES; i++) {
+		ErrorCallSite &site = error_call_sites[(slot + i) % ERROR_CALL_SITE_COUNT];
+
+		uint64_t site_key = site.key.load(std::memory_order_relaxed);
+		if (site_key == 0) {
+			// On failure, another thread took the slot and site_key is its key.
+			if (site.key.compare_exchange_strong(site_key, key, std::memory_order_relaxed)) {
+				site_key = key;
+			}
+		}
+		if (site_key == key) {
+			return _err_rate_limit(site.count.fetch_add(1, std::memory_order_relaxed) + 1, r_suppressed);
+		}
+	}
+
+	return _err_rate_limit(error_overflow_count.fetch_add(1, std::memory_order_relaxed) + 1, r_suppressed);
+}
+
+void _err_print_error(const char *p_function, const char *p_file, int p_line, const char *p_error, bool p_editor_notify, bool p_is_warning) {
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+	_err_print(p_function, p_file, p_line, p_error, nullptr, p_editor_notify, p_is_warning, suppressed);
+}
+
 void _err_print_error(const char *p_function, const char *p_file, int p_line, const String &p_error, bool p_editor_notify, bool p_is_warning) {
-	_err_print_error(p_function, p_file, p_line, p_error.utf8().get_data(), p_editor_notify, p_is_warning);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+	_err_print(p_function, p_file, p_line, p_error.utf8().get_data(), nullptr, p_editor_notify, p_is_warning, suppressed);
 }
 
 void _err_print_error(const char *p_function, const char *p_file, int p_line, const char *p_error, const char *p_message, bool p_editor_notify, bool p_is_warning) {
-	if (p_is_warning) {
-		internal::gdextension_interface_print_warning_with_message(p_error, p_message, p_function, p_file, p_line, p_editor_notify);
-	} else {
-		internal::gdextension_interface_print_error_with_message(p_error, p_message, p_function, p_file, p_line, p_editor_notify);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
 	}
+	_err_print(p_function, p_file, p_line, p_error, p_message, p_editor_notify, p_is_warning, suppressed);
 }
 
 void _err_print_error(const char *p_function, const char *p_file, int p_line, const String &p_error, const char *p_message, bool p_editor_notify, bool p_is_warning) {
-	_err_print_error(p_function, p_file, p_line, p_error.utf8().get_data(), p_message, p_editor_notify, p_is_warning);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+	_err_print(p_function, p_file, p_line, p_error.utf8().get_data(), p_message, p_editor_notify, p_is_warning, suppressed);
 }
 
 void _err_print_error(const char *p_function, const char *p_file, int p_line, const char *p_error, const String &p_message, bool p_editor_notify, bool p_is_warning) {
-	_err_print_error(p_function, p_file, p_line, p_error, p_message.utf8().get_data(), p_editor_notify, p_is_warning);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+	_err_print(p_function, p_file, p_line, p_error, p_message.utf8().get_data(), p_editor_notify, p_is_warning, suppressed);
 }
 
 void _err_print_error(const char *p_function, const char *p_file, int p_line, const String &p_error, const String &p_message, bool p_editor_notify, bool p_is_warning) {
-	_err_print_error(p_function, p_file, p_line, p_error.utf8().get_data(), p_message.utf8().get_data(), p_editor_notify, p_is_warning);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+	_err_print(p_function, p_file, p_line, p_error.utf8().get_data(), p_message.utf8().get_data(), p_editor_notify, p_is_warning, suppressed);
 }
 
 void _err_print_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const char *p_message, bool p_editor_notify, bool p_fatal) {
-	String fstr(p_fatal ? "FATAL: " : "");
-	String err(fstr + "Index " + p_index_str + " = " + itos(p_index) + " is out of bounds (" + p_size_str + " = " + itos(p_size) + ").");
-	_err_print_error(p_function, p_file, p_line, err.utf8().get_data(), p_message, p_editor_notify, false);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+
+	char error[256];
+	_err_format_index_error(error, sizeof(error), p_index, p_size, p_index_str, p_size_str, p_fatal);
+	_err_print(p_function, p_file, p_line, error, p_message, p_editor_notify, false, suppressed);
 }
 
 void _err_print_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const String &p_message, bool p_editor_notify, bool p_fatal) {
-	_err_print_index_error(p_function, p_file, p_line, p_index, p_size, p_index_str, p_size_str, p_message.utf8().get_data(), p_editor_notify, p_fatal);
+	uint64_t suppressed;
+	if (!_err_rate_check(p_file, p_line, suppressed)) {
+		return;
+	}
+
+	char error[256];
+	_err_format_index_error(error, sizeof(error), p_index, p_size, p_index_str, p_size_str, p_fatal);
+	_err_print(p_function, p_file, p_line, error, p_message.utf8().get_data(), p_editor_notify, false, suppressed);
+}
+
+void _err_print_checked_error(const char *p_function, const char *p_file, int p_line, const char *p_error, const char *p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed) {
+	_err_print(p_function, p_file, p_line, p_error, p_message, p_editor_notify, p_is_warning, p_suppressed);
+}
+
+void _err_print_checked_error(const char *p_function, const char *p_file, int p_line, const char *p_error, const String &p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed) {
+	_err_print(p_function, p_file, p_line, p_error, p_message.utf8().get_data(), p_editor_notify, p_is_warning, p_suppressed);
+}
+
+void _err_print_checked_error(const char *p_function, const char *p_file, int p_line, const String &p_error, const char *p_message, bool p_editor_notify, bool p_is_warning, uint64_t p_suppressed) {
+	_err_print(p_function, p_file, p_line, p_error.utf8().get_data(), p_message, p_editor_notify, p_is_warning, p_suppressed);
+}
+
+void _err_print_checked_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const char *p_message, bool p_editor_notify, bool p_fatal, uint64_t p_suppressed) {
+	char error[256];
+	_err_format_index_error(error, sizeof(error), p_index, p_size, p_index_str, p_size_str, p_fatal);
+	_err_print(p_function, p_file, p_line, error, p_message, p_editor_notify, false, p_suppressed);
+}
+
+void _err_print_checked_index_error(const char *p_function, const char *p_file, int p_line, int64_t p_index, int64_t p_size, const char *p_index_str, const char *p_size_str, const String &p_message, bool p_editor_notify, bool p_fatal, uint64_t p_suppressed) {
+	_err_print_checked_index_error(p_function, p_file, p_line, p_index, p_size, p_index_str, p_size_str, p_message.utf8().get_data(), p_editor_notify, p_fatal, p_suppressed);
 }
 
 void _err_flush_stdout() {
@@ -0,0 +1,494 @@
+/**************************************************************************/
+/*  math_kernels.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/math_kernels.hpp>
+
+#include <godot_cpp/core/cpu_features.hpp>
+#include <godot_cpp/core/math.hpp>
+
+#include <cstring>
+
+namespace godot {
+
+namespace MathKernels {
+
+template <typename T>
+static T _sum(const T *p_src, int64_t p_count) {
+	T result = 0;
+	for (int64_t i = 0; i < p_count; i++) {
+		result += p_src[i];
+	}
+	return result;
+}
+
+template <typename T>
+static T _min(const T *p_src, int64_t p_count) {
+	T result = p_src[0];
+	for (int64_t i = 1; i < p_count; i++) {
+		result = p_src[i] < result ? p_src[i] : result;
+	}
+	return result;
+}
+
+template <typename T>
+static T _max(const T *p_src, int64_t p_count) {
+	T result = p_src[0];
+	for (int64_t i = 1; i < p_count; i++) {
+		result = p_src[i] > result ? p_src[i] : result;
+	}
+	return result;
+}
+
+template <typename T>
+static T _dot(const T *p_a, const T *p_b, int64_t p_count) {
+	T result = 0;
+	for (int64_t i = 0; i < p_count; i++) {
+		result += p_a[i] * p_b[i];
+	}
+	return result;
+}
+
+template <typename T>
+static void _scale(T *p_dst, const T *p_src, T p_scale, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_src[i] * p_scale;
+	}
+}
+
+template <typename T>
+static void _add(T *p_dst, const T *p_a, const T *p_b, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_a[i] + p_b[i];
+	}
+}
+
+template <typename T>
+static void _axpy(T *p_dst, T p_alpha, const T *p_x, const T *p_y, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_alpha * p_x[i] + p_y[i];
+	}
+}
+
+template <typename T>
+static void _clamp(T *p_dst, const T *p_src, T p_min, T p_max, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = CLAMP(p_src[i], p_min, p_max);
+	}
+}
+
+template <typename T>
+static void _lerp(T *p_dst, const T *p_from, const T *p_to, T p_weight, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i] = p_from[i] + (p_to[i] - p_from[i]) * p_weight;
+	}
+}
+
+template <typename T>
+static void _mat4_mul(T *p_dst, const T *p_a, const T *p_b) {
+	T result[16];
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			T ab = 0;
+			for (int k = 0; k < 4; k++) {
+				ab += p_a[k * 4 + j] * p_b[i * 4 + k];
+			}
+			result[i * 4 + j] = ab;
+		}
+	}
+	for (int i = 0; i < 16; i++) {
+		p_dst[i] = result[i];
+	}
+}
+
+// Adjugate from the 2x2 sub-determinants of the upper and lower halves. Works on
+// either layout, since inverse(transpose(M)) == transpose(inverse(M)).
+template <typename T>
+static bool _mat4_inverse(T *p_dst, const T *p_src) {
+	const T *m = p_src;
+	const T s0 = m[0] * m[5] - m[4] * m[1];
+	const T s1 = m[0] * m[6] - m[4] * m[2];
+	const T s2 = m[0] * m[7] - m[4] * m[3];
+	const T s3 = m[1] * m[6] - m[5] * m[2];
+	const T s4 = m[1] * m[7] - m[5] * m[3];
+	const T s5 = m[2] * m[7] - m[6] * m[3];
+
+	const T c5 = m[10] * m[15] - m[14] * m[11];
+	const T c4 = m[9] * m[15] - m[13] * m[11];
+	const T c3 = m[9] * m[14] - m[13] * m[10];
+	const T c2 = m[8] * m[15] - m[12] * m[11];
+	const T c1 = m[8] * m[14] - m[12] * m[10];
+	const T c0 = m[8] * m[13] - m[12] * m[9];
+
+	const T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (Math::is_zero_approx(det)) {
+		return false;
+	}
+	const T r_det = 1 / det;
+
+	T result[16];
+	result[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * r_det;
+	result[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * r_det;
+	result[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * r_det;
+	result[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * r_det;
+	result[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * r_det;
+	result[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * r_det;
+	result[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * r_det;
+	result[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * r_det;
+	result[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * r_det;
+	result[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * r_det;
+	result[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * r_det;
+	result[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * r_det;
+	result[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * r_det;
+	result[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * r_det;
+	result[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * r_det;
+	result[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * r_det;
+	for (int i = 0; i < 16; i++) {
+		p_dst[i] = result[i];
+	}
+	return true;
+}
+
+template <typename T>
+static void _mat4_xform4(T *p_dst, const T *p_matrix, const T *p_src, int64_t p_count) {
+	const T *m = p_matrix;
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		const T x = p_src[i + 0];
+		const T y = p_src[i + 1];
+		const T z = p_src[i + 2];
+		const T w = p_src[i + 3];
+		p_dst[i + 0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+		p_dst[i + 1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+		p_dst[i + 2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+		p_dst[i + 3] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
+	}
+}
+
+template <typename T>
+static void _mat4_xform3(T *p_dst, const T *p_matrix, const T *p_src, int64_t p_count) {
+	const T *m = p_matrix;
+	for (int64_t i = 0; i < p_count * 3; i += 3) {
+		const T x = p_src[i + 0];
+		const T y = p_src[i + 1];
+		const T z = p_src[i + 2];
+		const T w = m[3] * x + m[7] * y + m[11] * z + m[15];
+		p_dst[i + 0] = (m[0] * x + m[4] * y + m[8] * z + m[12]) / w;
+		p_dst[i + 1] = (m[1] * x + m[5] * y + m[9] * z + m[13]) / w;
+		p_dst[i + 2] = (m[2] * x + m[6] * y + m[10] * z + m[14]) / w;
+	}
+}
+
+// Same formulas as Color::srgb_to_linear() and Color::linear_to_srgb().
+static void _srgb_to_linear_rgba(float *p_dst, const float *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		for (int64_t j = i; j < i + 3; j++) {
+			const float c = p_src[j];
+			p_dst[j] = c < 0.04045f ? c * (1.0f / 12.92f) : Math::pow((c + 0.055f) * (float)(1.0 / (1.0 + 0.055)), 2.4f);
+		}
+		p_dst[i + 3] = p_src[i + 3];
+	}
+}
+
+static void _linear_to_srgb_rgba(float *p_dst, const float *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		for (int64_t j = i; j < i + 3; j++) {
+			const float c = p_src[j];
+			p_dst[j] = c < 0.0031308f ? 12.92f * c : (1.0f + 0.055f) * Math::pow(c, 1.0f / 2.4f) - 0.055f;
+		}
+		p_dst[i + 3] = p_src[i + 3];
+	}
+}
+
+static void _premultiply_alpha_rgba(float *p_dst, const float *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		const float a = p_src[i + 3];
+		p_dst[i + 0] = p_src[i + 0] * a;
+		p_dst[i + 1] = p_src[i + 1] * a;
+		p_dst[i + 2] = p_src[i + 2] * a;
+		p_dst[i + 3] = a;
+	}
+}
+
+// Same formulas as Color::get_h(), get_s(), get_v() and set_hsv().
+static void _rgb_to_hsv_rgba(float *p_dst, const float *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		const float r = p_src[i + 0];
+		const float g = p_src[i + 1];
+		const float b = p_src[i + 2];
+		const float min = Math::min(Math::min(r, g), b);
+		const float max = Math::max(Math::max(r, g), b);
+		const float delta = max - min;
+
+		float h = 0.0f;
+		if (delta != 0.0f) {
+			if (r == max) {
+				h = (g - b) / delta;
+			} else if (g == max) {
+				h = 2 + (b - r) / delta;
+			} else {
+				h = 4 + (r - g) / delta;
+			}
+			h /= 6.0f;
+			if (h < 0.0f) {
+				h += 1.0f;
+			}
+		}
+
+		p_dst[i + 0] = h;
+		p_dst[i + 1] = (max != 0.0f) ? (delta / max) : 0.0f;
+		p_dst[i + 2] = max;
+		p_dst[i + 3] = p_src[i + 3];
+	}
+}
+
+static void _hsv_to_rgb_rgba(float *p_dst, const float *p_src, int64_t p_count) {
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		const float h = Math::fmod(p_src[i + 0] * 6.0f, 6.0f);
+		const float s = p_src[i + 1];
+		const float v = p_src[i + 2];
+		p_dst[i + 3] = p_src[i + 3];
+
+		if (s == 0.0f) {
+			p_dst[i + 0] = p_dst[i + 1] = p_dst[i + 2] = v;
+			continue;
+		}
+
+		const int sector = Math::floor(h);
+		const float f = h - sector;
+		const float p = v * (1.0f - s);
+		const float q = v * (1.0f - s * f);
+		const float t = v * (1.0f - s * (1.0f - f));
+		float r, g, b;
+		switch (sector) {
+			case 0:
+				r = v;
+				g = t;
+				b = p;
+				break;
+			case 1:
+				r = q;
+				g = v;
+				b = p;
+				break;
+			case 2:
+				r = p;
+				g = v;
+				b = t;
+				break;
+			case 3:
+				r = p;
+				g = q;
+				b = v;
+				break;
+			case 4:
+				r = t;
+				g = p;
+				b = v;
+				break;
+			default:
+				r = v;
+				g = p;
+				b = q;
+				break;
+		}
+		p_dst[i + 0] = r;
+		p_dst[i + 1] = g;
+		p_dst[i + 2] = b;
+	}
+}
+
+static void _hash64_stripes(uint64_t *r_acc, const uint8_t *p_data, const uint64_t *p_secret, int64_t p_count) {
+	for (int64_t s = 0; s < p_count; s++) {
+		const uint8_t *stripe = p_data + s * 64;
+		for (int i = 0; i < 8; i++) {
+			uint64_t value;
+			memcpy(&value, stripe + i * 8, 8);
+			const uint64_t keyed = value ^ p_secret[s + i];
+			r_acc[i ^ 1] += value;
+			r_acc[i] += (keyed & 0xffffffff) * (keyed >> 32);
+		}
+	}
+}
+
+static int64_t _mismatch_u8(const uint8_t *p_a, const uint8_t *p_b, int64_t p_count) {
+	// Skip equal words, then find the byte.
+	int64_t i = 0;
+	for (; i + 8 <= p_count; i += 8) {
+		uint64_t a;
+		uint64_t b;
+		memcpy(&a, p_a + i, 8);
+		memcpy(&b, p_b + i, 8);
+		if (a != b) {
+			break;
+		}
+	}
+	for (; i < p_count; i++) {
+		if (p_a[i] != p_b[i]) {
+			return i;
+		}
+	}
+	return p_count;
+}
+
+template <class T>
+static int64_t _find(const T *p_src, int64_t p_count, T p_value) {
+	for (int64_t i = 0; i < p_count; i++) {
+		if (p_src[i] == p_value) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void _ascii_case_u8(uint8_t *p_dst, const uint8_t *p_src, int64_t p_count, bool p_upper) {
+	const uint8_t first = p_upper ? 'a' : 'A';
+	for (int64_t i = 0; i < p_count; i++) {
+		const uint8_t c = p_src[i];
+		p_dst[i] = uint8_t(c - first) < 26 ? c ^ 0x20 : c;
+	}
+}
+
+// Constant-initialized, so kernels can be called before the binding is initialized.
+Table table = {
+	_sum<float>,
+	_min<float>,
+	_max<float>,
+	_dot<float>,
+	_scale<float>,
+	_add<float>,
+	_axpy<float>,
+	_clamp<float>,
+	_lerp<float>,
+
+	_sum<double>,
+	_min<double>,
+	_max<double>,
+	_dot<double>,
+	_scale<double>,
+	_add<double>,
+	_axpy<double>,
+	_clamp<double>,
+	_lerp<double>,
+
+	_srgb_to_linear_rgba,
+	_linear_to_srgb_rgba,
+	_premultiply_alpha_rgba,
+	_rgb_to_hsv_rgba,
+	_hsv_to_rgb_rgba,
+
+	_mat4_mul<float>,
+	_mat4_inverse<float>,
+	_mat4_xform4<float>,
+	_mat4_xform3<float>,
+
+	_mat4_mul<double>,
+	_mat4_inverse<double>,
+	_mat4_xform4<double>,
+	_mat4_xform3<double>,
+
+	_hash64_stripes,
+
+	_mismatch_u8,
+	_find<uint16_t>,
+	_find<uint32_t>,
+	_ascii_case_u8,
+};
+
+void fill_scalar(Table &r_table) {
+	r_table.sum_f32 = _sum<float>;
+	r_table.min_f32 = _min<float>;
+	r_table.max_f32 = _max<float>;
+	r_table.dot_f32 = _dot<float>;
+	r_table.scale_f32 = _scale<float>;
+	r_table.add_f32 = _add<float>;
+	r_table.axpy_f32 = _axpy<float>;
+	r_table.clamp_f32 = _clamp<float>;
+	r_table.lerp_f32 = _lerp<float>;
+
+	r_table.sum_f64 = _sum<double>;
+	r_table.min_f64 = _min<double>;
+	r_table.max_f64 = _max<double>;
+	r_table.dot_f64 = _dot<double>;
+	r_table.scale_f64 = _scale<double>;
+	r_table.add_f64 = _add<double>;
+	r_table.axpy_f64 = _axpy<double>;
+	r_table.clamp_f64 = _clamp<double>;
+	r_table.lerp_f64 = _lerp<double>;
+
+	r_table.srgb_to_linear_rgba = _srgb_to_linear_rgba;
+	r_table.linear_to_srgb_rgba = _linear_to_srgb_rgba;
+	r_table.premultiply_alpha_rgba = _premultiply_alpha_rgba;
+	r_table.rgb_to_hsv_rgba = _rgb_to_hsv_rgba;
+	r_table.hsv_to_rgb_rgba = _hsv_to_rgb_rgba;
+
+	r_table.mat4_mul_f32 = _mat4_mul<float>;
+	r_table.mat4_inverse_f32 = _mat4_inverse<float>;
+	r_table.mat4_xform4_f32 = _mat4_xform4<float>;
+	r_table.mat4_xform3_f32 = _mat4_xform3<float>;
+
+	r_table.mat4_mul_f64 = _mat4_mul<double>;
+	r_table.mat4_inverse_f64 = _mat4_inverse<double>;
+	r_table.mat4_xform4_f64 = _mat4_xform4<double>;
+	r_table.mat4_xform3_f64 = _mat4_xform3<double>;
+
+	r_table.hash64_stripes = _hash64_stripes;
+
+	r_table.mismatch_u8 = _mismatch_u8;
+	r_table.find_u16 = _find<uint16_t>;
+	r_table.find_u32 = _find<uint32_t>;
+	r_table.ascii_case_u8 = _ascii_case_u8;
+}
+
+static void _select(CPUFeatures::SIMDLevel p_level) {
+	// Vector fillers only override the kernels they have a variant for.
+	fill_scalar(table);
+	switch (p_level) {
+#ifdef GODOT_SIMD_DISPATCH_ENABLED
+		case CPUFeatures::SIMD_LEVEL_AVX512:
+			// The 4x4 matrix kernels only come in 128/256-bit variants.
+			fill_avx2(table);
+			fill_avx512(table);
+			break;
+		case CPUFeatures::SIMD_LEVEL_AVX2:
+			fill_avx2(table);
+			break;
+		case CPUFeatures::SIMD_LEVEL_SSE4_1:
+			fill_sse4_1(table);
+			break;
+#endif
+		default:
+			break;
+	}
+}
+
+GDCPU_DISPATCH_REGISTER(_select);
+
+} // namespace MathKernels
+
+} // namespace godot
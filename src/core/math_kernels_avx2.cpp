@@ -0,0 +1,273 @@
+/**************************************************************************/
+/*  math_kernels_avx2.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/math_kernels.hpp>
+
+#ifdef GODOT_SIMD_BUILD_AVX2
+
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+struct F32 {
+	typedef float T;
+	typedef __m256 Reg;
+	static constexpr int WIDTH = 8;
+
+	static _ALWAYS_INLINE_ Reg load(const float *p_src) { return _mm256_loadu_ps(p_src); }
+	static _ALWAYS_INLINE_ void store(float *p_dst, Reg p_v) { _mm256_storeu_ps(p_dst, p_v); }
+	static _ALWAYS_INLINE_ Reg set1(float p_v) { return _mm256_set1_ps(p_v); }
+	static _ALWAYS_INLINE_ Reg zero() { return _mm256_setzero_ps(); }
+	static _ALWAYS_INLINE_ Reg add(Reg p_a, Reg p_b) { return _mm256_add_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg sub(Reg p_a, Reg p_b) { return _mm256_sub_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg mul(Reg p_a, Reg p_b) { return _mm256_mul_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg div(Reg p_a, Reg p_b) { return _mm256_div_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg fmadd(Reg p_a, Reg p_b, Reg p_c) { return _mm256_fmadd_ps(p_a, p_b, p_c); }
+	static _ALWAYS_INLINE_ Reg min(Reg p_a, Reg p_b) { return _mm256_min_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg max(Reg p_a, Reg p_b) { return _mm256_max_ps(p_a, p_b); }
+
+	static _ALWAYS_INLINE_ float reduce_add(Reg p_v) {
+		__m128 v = _mm_add_ps(_mm256_castps256_ps128(p_v), _mm256_extractf128_ps(p_v, 1));
+		__m128 shuf = _mm_movehdup_ps(v);
+		__m128 sums = _mm_add_ps(v, shuf);
+		shuf = _mm_movehl_ps(shuf, sums);
+		return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+	}
+	static _ALWAYS_INLINE_ float reduce_min(Reg p_v) {
+		__m128 v = _mm_min_ps(_mm256_castps256_ps128(p_v), _mm256_extractf128_ps(p_v, 1));
+		v = _mm_min_ps(v, _mm_movehl_ps(v, v));
+		return _mm_cvtss_f32(_mm_min_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+	static _ALWAYS_INLINE_ float reduce_max(Reg p_v) {
+		__m128 v = _mm_max_ps(_mm256_castps256_ps128(p_v), _mm256_extractf128_ps(p_v, 1));
+		v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+		return _mm_cvtss_f32(_mm_max_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	static _ALWAYS_INLINE_ Reg select_lt(Reg p_a, Reg p_b, Reg p_x, Reg p_y) { return _mm256_blendv_ps(p_y, p_x, _mm256_cmp_ps(p_a, p_b, _CMP_LT_OQ)); }
+	static _ALWAYS_INLINE_ Reg select_gt(Reg p_a, Reg p_b, Reg p_x, Reg p_y) { return _mm256_blendv_ps(p_y, p_x, _mm256_cmp_ps(p_a, p_b, _CMP_GT_OQ)); }
+	static _ALWAYS_INLINE_ Reg round(Reg p_v) { return _mm256_round_ps(p_v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	static _ALWAYS_INLINE_ Reg exponent(Reg p_v) {
+		const __m256i bits = _mm256_srli_epi32(_mm256_castps_si256(p_v), 23);
+		return _mm256_cvtepi32_ps(_mm256_sub_epi32(bits, _mm256_set1_epi32(127)));
+	}
+	static _ALWAYS_INLINE_ Reg mantissa(Reg p_v) {
+		const __m256i bits = _mm256_and_si256(_mm256_castps_si256(p_v), _mm256_set1_epi32(0x007fffff));
+		return _mm256_castsi256_ps(_mm256_or_si256(bits, _mm256_set1_epi32(0x3f800000)));
+	}
+	static _ALWAYS_INLINE_ Reg ldexp(Reg p_v, Reg p_exp) {
+		const __m256i bits = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(p_exp), _mm256_set1_epi32(127)), 23);
+		return _mm256_mul_ps(p_v, _mm256_castsi256_ps(bits));
+	}
+	static _ALWAYS_INLINE_ Reg splat_alpha(Reg p_v) { return _mm256_permute_ps(p_v, _MM_SHUFFLE(3, 3, 3, 3)); }
+	static _ALWAYS_INLINE_ Reg blend_alpha(Reg p_rgb, Reg p_alpha) { return _mm256_blend_ps(p_rgb, p_alpha, 0x88); }
+};
+
+struct F64 {
+	typedef double T;
+	typedef __m256d Reg;
+	static constexpr int WIDTH = 4;
+
+	static _ALWAYS_INLINE_ Reg load(const double *p_src) { return _mm256_loadu_pd(p_src); }
+	static _ALWAYS_INLINE_ void store(double *p_dst, Reg p_v) { _mm256_storeu_pd(p_dst, p_v); }
+	static _ALWAYS_INLINE_ Reg set1(double p_v) { return _mm256_set1_pd(p_v); }
+	static _ALWAYS_INLINE_ Reg zero() { return _mm256_setzero_pd(); }
+	static _ALWAYS_INLINE_ Reg add(Reg p_a, Reg p_b) { return _mm256_add_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg sub(Reg p_a, Reg p_b) { return _mm256_sub_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg mul(Reg p_a, Reg p_b) { return _mm256_mul_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg div(Reg p_a, Reg p_b) { return _mm256_div_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg fmadd(Reg p_a, Reg p_b, Reg p_c) { return _mm256_fmadd_pd(p_a, p_b, p_c); }
+	static _ALWAYS_INLINE_ Reg min(Reg p_a, Reg p_b) { return _mm256_min_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg max(Reg p_a, Reg p_b) { return _mm256_max_pd(p_a, p_b); }
+
+	static _ALWAYS_INLINE_ double reduce_add(Reg p_v) {
+		__m128d v = _mm_add_pd(_mm256_castpd256_pd128(p_v), _mm256_extractf128_pd(p_v, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+	static _ALWAYS_INLINE_ double reduce_min(Reg p_v) {
+		__m128d v = _mm_min_pd(_mm256_castpd256_pd128(p_v), _mm256_extractf128_pd(p_v, 1));
+		return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+	static _ALWAYS_INLINE_ double reduce_max(Reg p_v) {
+		__m128d v = _mm_max_pd(_mm256_castpd256_pd128(p_v), _mm256_extractf128_pd(p_v, 1));
+		return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+
+	template <int I0, int I1, int I2, int I3>
+	static _ALWAYS_INLINE_ Reg shuffle(Reg p_a, Reg p_b) {
+		return _mm256_blend_pd(_mm256_permute4x64_pd(p_a, _MM_SHUFFLE(I1, I0, I1, I0)), _mm256_permute4x64_pd(p_b, _MM_SHUFFLE(I3, I2, I3, I2)), 0xc);
+	}
+};
+
+// One column of a 4x4 float matrix.
+struct F32x4 {
+	typedef float T;
+	typedef __m128 Reg;
+	static constexpr int WIDTH = 4;
+
+	static _ALWAYS_INLINE_ Reg load(const float *p_src) { return _mm_loadu_ps(p_src); }
+	static _ALWAYS_INLINE_ void store(float *p_dst, Reg p_v) { _mm_storeu_ps(p_dst, p_v); }
+	static _ALWAYS_INLINE_ Reg set1(float p_v) { return _mm_set1_ps(p_v); }
+	static _ALWAYS_INLINE_ Reg add(Reg p_a, Reg p_b) { return _mm_add_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg sub(Reg p_a, Reg p_b) { return _mm_sub_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg mul(Reg p_a, Reg p_b) { return _mm_mul_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg div(Reg p_a, Reg p_b) { return _mm_div_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg fmadd(Reg p_a, Reg p_b, Reg p_c) { return _mm_fmadd_ps(p_a, p_b, p_c); }
+
+	static _ALWAYS_INLINE_ float reduce_add(Reg p_v) {
+		Reg shuf = _mm_movehdup_ps(p_v);
+		Reg sums = _mm_add_ps(p_v, shuf);
+		shuf = _mm_movehl_ps(shuf, sums);
+		return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+	}
+
+	template <int I0, int I1, int I2, int I3>
+	static _ALWAYS_INLINE_ Reg shuffle(Reg p_a, Reg p_b) { return _mm_shuffle_ps(p_a, p_b, _MM_SHUFFLE(I3, I2, I1, I0)); }
+};
+
+// Four lanes per register: acc[i ^ 1] += value[i] swaps the 64-bit halves of
+// each 128-bit lane.
+void _hash64_stripes(uint64_t *r_acc, const uint8_t *p_data, const uint64_t *p_secret, int64_t p_count) {
+	__m256i acc0 = _mm256_loadu_si256((const __m256i *)r_acc);
+	__m256i acc1 = _mm256_loadu_si256((const __m256i *)(r_acc + 4));
+	for (int64_t s = 0; s < p_count; s++) {
+		const uint8_t *stripe = p_data + s * 64;
+		const __m256i value0 = _mm256_loadu_si256((const __m256i *)stripe);
+		const __m256i value1 = _mm256_loadu_si256((const __m256i *)(stripe + 32));
+		const __m256i keyed0 = _mm256_xor_si256(value0, _mm256_loadu_si256((const __m256i *)(p_secret + s)));
+		const __m256i keyed1 = _mm256_xor_si256(value1, _mm256_loadu_si256((const __m256i *)(p_secret + s + 4)));
+		const __m256i product0 = _mm256_mul_epu32(keyed0, _mm256_srli_epi64(keyed0, 32));
+		const __m256i product1 = _mm256_mul_epu32(keyed1, _mm256_srli_epi64(keyed1, 32));
+		acc0 = _mm256_add_epi64(acc0, _mm256_add_epi64(product0, _mm256_shuffle_epi32(value0, _MM_SHUFFLE(1, 0, 3, 2))));
+		acc1 = _mm256_add_epi64(acc1, _mm256_add_epi64(product1, _mm256_shuffle_epi32(value1, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+	_mm256_storeu_si256((__m256i *)r_acc, acc0);
+	_mm256_storeu_si256((__m256i *)(r_acc + 4), acc1);
+}
+
+_ALWAYS_INLINE_ int _first_bit(uint32_t p_mask) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, p_mask);
+	return int(index);
+#else
+	return __builtin_ctz(p_mask);
+#endif
+}
+
+int64_t _mismatch_u8(const uint8_t *p_a, const uint8_t *p_b, int64_t p_count) {
+	int64_t i = 0;
+	for (; i + 32 <= p_count; i += 32) {
+		const __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p_a + i)), _mm256_loadu_si256((const __m256i *)(p_b + i)));
+		const uint32_t mask = ~uint32_t(_mm256_movemask_epi8(equal));
+		if (mask) {
+			return i + _first_bit(mask);
+		}
+	}
+	for (; i < p_count; i++) {
+		if (p_a[i] != p_b[i]) {
+			return i;
+		}
+	}
+	return p_count;
+}
+
+int64_t _find_u16(const uint16_t *p_src, int64_t p_count, uint16_t p_value) {
+	const __m256i value = _mm256_set1_epi16(short(p_value));
+	int64_t i = 0;
+	for (; i + 16 <= p_count; i += 16) {
+		const uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i *)(p_src + i)), value));
+		if (mask) {
+			return i + _first_bit(mask) / 2;
+		}
+	}
+	for (; i < p_count; i++) {
+		if (p_src[i] == p_value) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+int64_t _find_u32(const uint32_t *p_src, int64_t p_count, uint32_t p_value) {
+	const __m256i value = _mm256_set1_epi32(int(p_value));
+	int64_t i = 0;
+	for (; i + 8 <= p_count; i += 8) {
+		const uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(p_src + i)), value));
+		if (mask) {
+			return i + _first_bit(mask) / 4;
+		}
+	}
+	for (; i < p_count; i++) {
+		if (p_src[i] == p_value) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+// There's no unsigned byte comparison: c - first < 26 is done signed, with
+// both sides offset by 0x80.
+void _ascii_case_u8(uint8_t *p_dst, const uint8_t *p_src, int64_t p_count, bool p_upper) {
+	const uint8_t first = p_upper ? 'a' : 'A';
+	const __m256i first_v = _mm256_set1_epi8(char(first));
+	const __m256i flip = _mm256_set1_epi8(0x20);
+	int64_t i = 0;
+	for (; i + 32 <= p_count; i += 32) {
+		const __m256i c = _mm256_loadu_si256((const __m256i *)(p_src + i));
+		const __m256i offset = _mm256_sub_epi8(c, first_v);
+		const __m256i in_range = _mm256_cmpgt_epi8(_mm256_set1_epi8(char(26 ^ 0x80)), _mm256_xor_si256(offset, _mm256_set1_epi8(char(0x80))));
+		_mm256_storeu_si256((__m256i *)(p_dst + i), _mm256_xor_si256(c, _mm256_and_si256(in_range, flip)));
+	}
+	for (; i < p_count; i++) {
+		const uint8_t c = p_src[i];
+		p_dst[i] = uint8_t(c - first) < 26 ? c ^ 0x20 : c;
+	}
+}
+
+} // namespace
+
+#include "math_kernels_simd.inc.hpp"
+
+void godot::MathKernels::fill_avx2(Table &r_table) {
+	simd_fill_table<F32, F64>(r_table);
+	simd_fill_mat4_f32<F32x4>(r_table);
+	simd_fill_mat4_f64<F64>(r_table);
+	r_table.hash64_stripes = _hash64_stripes;
+	r_table.mismatch_u8 = _mismatch_u8;
+	r_table.find_u16 = _find_u16;
+	r_table.find_u32 = _find_u32;
+	r_table.ascii_case_u8 = _ascii_case_u8;
+}
+
+#endif // GODOT_SIMD_BUILD_AVX2
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  math_kernels_avx512.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/math_kernels.hpp>
+
+#ifdef GODOT_SIMD_BUILD_AVX512
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC 12 reports false positives in its own AVX-512 headers (GCC bug 105593).
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <immintrin.h>
+
+namespace {
+
+struct F32 {
+	typedef float T;
+	typedef __m512 Reg;
+	static constexpr int WIDTH = 16;
+
+	static _ALWAYS_INLINE_ Reg load(const float *p_src) { return _mm512_loadu_ps(p_src); }
+	static _ALWAYS_INLINE_ void store(float *p_dst, Reg p_v) { _mm512_storeu_ps(p_dst, p_v); }
+	static _ALWAYS_INLINE_ Reg set1(float p_v) { return _mm512_set1_ps(p_v); }
+	static _ALWAYS_INLINE_ Reg zero() { return _mm512_setzero_ps(); }
+	static _ALWAYS_INLINE_ Reg add(Reg p_a, Reg p_b) { return _mm512_add_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg sub(Reg p_a, Reg p_b) { return _mm512_sub_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg mul(Reg p_a, Reg p_b) { return _mm512_mul_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg div(Reg p_a, Reg p_b) { return _mm512_div_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg fmadd(Reg p_a, Reg p_b, Reg p_c) { return _mm512_fmadd_ps(p_a, p_b, p_c); }
+	static _ALWAYS_INLINE_ Reg min(Reg p_a, Reg p_b) { return _mm512_min_ps(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg max(Reg p_a, Reg p_b) { return _mm512_max_ps(p_a, p_b); }
+
+	static _ALWAYS_INLINE_ float reduce_add(Reg p_v) { return _mm512_reduce_add_ps(p_v); }
+	static _ALWAYS_INLINE_ float reduce_min(Reg p_v) { return _mm512_reduce_min_ps(p_v); }
+	static _ALWAYS_INLINE_ float reduce_max(Reg p_v) { return _mm512_reduce_max_ps(p_v); }
+
+	static _ALWAYS_INLINE_ Reg select_lt(Reg p_a, Reg p_b, Reg p_x, Reg p_y) { return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(p_a, p_b, _CMP_LT_OQ), p_y, p_x); }
+	static _ALWAYS_INLINE_ Reg select_gt(Reg p_a, Reg p_b, Reg p_x, Reg p_y) { return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(p_a, p_b, _CMP_GT_OQ), p_y, p_x); }
+	static _ALWAYS_INLINE_ Reg round(Reg p_v) { return _mm512_roundscale_ps(p_v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	static _ALWAYS_INLINE_ Reg exponent(Reg p_v) { return _mm512_getexp_ps(p_v); }
+	static _ALWAYS_INLINE_ Reg mantissa(Reg p_v) { return _mm512_getmant_ps(p_v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+	static _ALWAYS_INLINE_ Reg ldexp(Reg p_v, Reg p_exp) { return _mm512_scalef_ps(p_v, p_exp); }
+	static _ALWAYS_INLINE_ Reg splat_alpha(Reg p_v) { return _mm512_shuffle_ps(p_v, p_v, _MM_SHUFFLE(3, 3, 3, 3)); }
+	static _ALWAYS_INLINE_ Reg blend_alpha(Reg p_rgb, Reg p_alpha) { return _mm512_mask_blend_ps(0x8888, p_rgb, p_alpha); }
+};
+
+struct F64 {
+	typedef double T;
+	typedef __m512d Reg;
+	static constexpr int WIDTH = 8;
+
+	static _ALWAYS_INLINE_ Reg load(const double *p_src) { return _mm512_loadu_pd(p_src); }
+	static _ALWAYS_INLINE_ void store(double *p_dst, Reg p_v) { _mm512_storeu_pd(p_dst, p_v); }
+	static _ALWAYS_INLINE_ Reg set1(double p_v) { return _mm512_set1_pd(p_v); }
+	static _ALWAYS_INLINE_ Reg zero() { return _mm512_setzero_pd(); }
+	static _ALWAYS_INLINE_ Reg add(Reg p_a, Reg p_b) { return _mm512_add_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg sub(Reg p_a, Reg p_b) { return _mm512_sub_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg mul(Reg p_a, Reg p_b) { return _mm512_mul_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg div(Reg p_a, Reg p_b) { return _mm512_div_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg fmadd(Reg p_a, Reg p_b, Reg p_c) { return _mm512_fmadd_pd(p_a, p_b, p_c); }
+	static _ALWAYS_INLINE_ Reg min(Reg p_a, Reg p_b) { return _mm512_min_pd(p_a, p_b); }
+	static _ALWAYS_INLINE_ Reg max(Reg p_a, Reg p_b) { return _mm512_max_pd(p_a, p_b); }
+
+	static _ALWAYS_INLINE_ double reduce_add(Reg p_v) { return _mm512_reduce_add_pd(p_v); }
+	static _ALWAYS_INLINE_ double reduce_min(Reg p_v) { return _mm512_reduce_min_pd(p_v); }
+	static _ALWAYS_INLINE_ double reduce_max(Reg p_v) { return _mm512_reduce_max_pd(p_v); }
+};
+
+} // namespace
+
+#include "math_kernels_simd.inc.hpp"
+
+void godot::MathKernels::fill_avx512(Table &r_table) {
+	simd_fill_table<F32, F64>(r_table);
+}
+
+#endif // GODOT_SIMD_BUILD_AVX512
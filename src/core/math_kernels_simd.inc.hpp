@@ -0,0 +1,485 @@
+/**************************************************************************/
+/*  math_kernels_simd.inc.hpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Generic implementation of the MathKernels table, included by the per-ISA
+// translation units after they define the `F32` and `F64` register traits.
+//
+// Traits expose the scalar type `T`, the register type `Reg`, the lane count
+// `WIDTH`, and `load`, `store`, `set1`, `zero`, `add`, `sub`, `mul`, `div`,
+// `fmadd` (a * b + c), `min`, `max`, `reduce_add`, `reduce_min` and `reduce_max`.
+// `F32` also provides `select_lt` (a < b ? x : y), `select_gt`, `round`,
+// `exponent`/`mantissa` (split a positive float into floor(log2(x)) and [1, 2)),
+// `ldexp`, `splat_alpha` and `blend_alpha` for the RGBA kernels.
+//
+// The 4x4 matrix kernels take traits with a WIDTH of 4, so that one register
+// holds one column, and `shuffle<I0, I1, I2, I3>(a, b)` returning
+// (a[I0], a[I1], b[I2], b[I3]) like _mm_shuffle_ps().
+//
+// Everything lives in an anonymous namespace on purpose: these functions are
+// compiled with a different instruction set in each including file.
+
+namespace {
+
+template <typename V>
+typename V::T simd_sum(const typename V::T *p_src, int64_t p_count) {
+	typedef typename V::T T;
+	typedef typename V::Reg Reg;
+
+	Reg acc0 = V::zero();
+	Reg acc1 = V::zero();
+	Reg acc2 = V::zero();
+	Reg acc3 = V::zero();
+	int64_t i = 0;
+	for (; i + 4 * V::WIDTH <= p_count; i += 4 * V::WIDTH) {
+		acc0 = V::add(acc0, V::load(p_src + i));
+		acc1 = V::add(acc1, V::load(p_src + i + V::WIDTH));
+		acc2 = V::add(acc2, V::load(p_src + i + 2 * V::WIDTH));
+		acc3 = V::add(acc3, V::load(p_src + i + 3 * V::WIDTH));
+	}
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		acc0 = V::add(acc0, V::load(p_src + i));
+	}
+	T result = V::reduce_add(V::add(V::add(acc0, acc1), V::add(acc2, acc3)));
+	for (; i < p_count; i++) {
+		result += p_src[i];
+	}
+	return result;
+}
+
+template <typename V>
+typename V::T simd_dot(const typename V::T *p_a, const typename V::T *p_b, int64_t p_count) {
+	typedef typename V::T T;
+	typedef typename V::Reg Reg;
+
+	Reg acc0 = V::zero();
+	Reg acc1 = V::zero();
+	int64_t i = 0;
+	for (; i + 2 * V::WIDTH <= p_count; i += 2 * V::WIDTH) {
+		acc0 = V::fmadd(V::load(p_a + i), V::load(p_b + i), acc0);
+		acc1 = V::fmadd(V::load(p_a + i + V::WIDTH), V::load(p_b + i + V::WIDTH), acc1);
+	}
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		acc0 = V::fmadd(V::load(p_a + i), V::load(p_b + i), acc0);
+	}
+	T result = V::reduce_add(V::add(acc0, acc1));
+	for (; i < p_count; i++) {
+		result += p_a[i] * p_b[i];
+	}
+	return result;
+}
+
+template <typename V>
+typename V::T simd_min(const typename V::T *p_src, int64_t p_count) {
+	typedef typename V::T T;
+
+	if (p_count < V::WIDTH) {
+		T result = p_src[0];
+		for (int64_t i = 1; i < p_count; i++) {
+			result = p_src[i] < result ? p_src[i] : result;
+		}
+		return result;
+	}
+
+	typename V::Reg acc = V::load(p_src);
+	int64_t i = V::WIDTH;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		acc = V::min(acc, V::load(p_src + i));
+	}
+	T result = V::reduce_min(acc);
+	for (; i < p_count; i++) {
+		result = p_src[i] < result ? p_src[i] : result;
+	}
+	return result;
+}
+
+template <typename V>
+typename V::T simd_max(const typename V::T *p_src, int64_t p_count) {
+	typedef typename V::T T;
+
+	if (p_count < V::WIDTH) {
+		T result = p_src[0];
+		for (int64_t i = 1; i < p_count; i++) {
+			result = p_src[i] > result ? p_src[i] : result;
+		}
+		return result;
+	}
+
+	typename V::Reg acc = V::load(p_src);
+	int64_t i = V::WIDTH;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		acc = V::max(acc, V::load(p_src + i));
+	}
+	T result = V::reduce_max(acc);
+	for (; i < p_count; i++) {
+		result = p_src[i] > result ? p_src[i] : result;
+	}
+	return result;
+}
+
+template <typename V>
+void simd_scale(typename V::T *p_dst, const typename V::T *p_src, typename V::T p_scale, int64_t p_count) {
+	const typename V::Reg s = V::set1(p_scale);
+	int64_t i = 0;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		V::store(p_dst + i, V::mul(V::load(p_src + i), s));
+	}
+	for (; i < p_count; i++) {
+		p_dst[i] = p_src[i] * p_scale;
+	}
+}
+
+template <typename V>
+void simd_add(typename V::T *p_dst, const typename V::T *p_a, const typename V::T *p_b, int64_t p_count) {
+	int64_t i = 0;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		V::store(p_dst + i, V::add(V::load(p_a + i), V::load(p_b + i)));
+	}
+	for (; i < p_count; i++) {
+		p_dst[i] = p_a[i] + p_b[i];
+	}
+}
+
+template <typename V>
+void simd_axpy(typename V::T *p_dst, typename V::T p_alpha, const typename V::T *p_x, const typename V::T *p_y, int64_t p_count) {
+	const typename V::Reg alpha = V::set1(p_alpha);
+	int64_t i = 0;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		V::store(p_dst + i, V::fmadd(alpha, V::load(p_x + i), V::load(p_y + i)));
+	}
+	for (; i < p_count; i++) {
+		p_dst[i] = p_alpha * p_x[i] + p_y[i];
+	}
+}
+
+template <typename V>
+void simd_clamp(typename V::T *p_dst, const typename V::T *p_src, typename V::T p_min, typename V::T p_max, int64_t p_count) {
+	const typename V::Reg lo = V::set1(p_min);
+	const typename V::Reg hi = V::set1(p_max);
+	int64_t i = 0;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		V::store(p_dst + i, V::min(V::max(V::load(p_src + i), lo), hi));
+	}
+	for (; i < p_count; i++) {
+		typename V::T v = p_src[i];
+		v = v < p_min ? p_min : v;
+		p_dst[i] = v > p_max ? p_max : v;
+	}
+}
+
+template <typename V>
+void simd_lerp(typename V::T *p_dst, const typename V::T *p_from, const typename V::T *p_to, typename V::T p_weight, int64_t p_count) {
+	const typename V::Reg w = V::set1(p_weight);
+	int64_t i = 0;
+	for (; i + V::WIDTH <= p_count; i += V::WIDTH) {
+		const typename V::Reg from = V::load(p_from + i);
+		V::store(p_dst + i, V::fmadd(V::sub(V::load(p_to + i), from), w, from));
+	}
+	for (; i < p_count; i++) {
+		p_dst[i] = p_from[i] + (p_to[i] - p_from[i]) * p_weight;
+	}
+}
+
+// log2() of positive, normal floats. Maximum absolute error is around 1e-7.
+template <typename V>
+_ALWAYS_INLINE_ typename V::Reg simd_log2(typename V::Reg p_x) {
+	typedef typename V::Reg Reg;
+
+	Reg e = V::exponent(p_x);
+	Reg m = V::mantissa(p_x);
+
+	// Center the mantissa around 1 to keep the series short: m in [sqrt(0.5), sqrt(2)).
+	const Reg sqrt2 = V::set1(1.41421356f);
+	e = V::select_gt(m, sqrt2, V::add(e, V::set1(1.0f)), e);
+	m = V::select_gt(m, sqrt2, V::mul(m, V::set1(0.5f)), m);
+
+	// log2(m) = 2 / ln(2) * atanh(t), with t = (m - 1) / (m + 1) in [-0.172, 0.172).
+	const Reg one = V::set1(1.0f);
+	const Reg t = V::div(V::sub(m, one), V::add(m, one));
+	const Reg t2 = V::mul(t, t);
+	Reg p = V::set1(0.32059889f); // 2 / (9 ln 2)
+	p = V::fmadd(p, t2, V::set1(0.41219858f)); // 2 / (7 ln 2)
+	p = V::fmadd(p, t2, V::set1(0.57707802f)); // 2 / (5 ln 2)
+	p = V::fmadd(p, t2, V::set1(0.96179669f)); // 2 / (3 ln 2)
+	p = V::fmadd(p, t2, V::set1(2.88539008f)); // 2 / ln 2
+	return V::fmadd(p, t, e);
+}
+
+// 2^x, with a relative error around 1e-7.
+template <typename V>
+_ALWAYS_INLINE_ typename V::Reg simd_exp2(typename V::Reg p_x) {
+	typedef typename V::Reg Reg;
+
+	p_x = V::min(V::max(p_x, V::set1(-126.0f)), V::set1(126.0f));
+	const Reg n = V::round(p_x);
+	const Reg f = V::sub(p_x, n); // [-0.5, 0.5]
+
+	// Taylor series of e^(f ln 2).
+	Reg p = V::set1(1.5252734e-5f); // ln(2)^7 / 7!
+	p = V::fmadd(p, f, V::set1(1.5403530e-4f)); // ln(2)^6 / 6!
+	p = V::fmadd(p, f, V::set1(1.3333558e-3f)); // ln(2)^5 / 5!
+	p = V::fmadd(p, f, V::set1(9.6181291e-3f)); // ln(2)^4 / 4!
+	p = V::fmadd(p, f, V::set1(5.5504109e-2f)); // ln(2)^3 / 3!
+	p = V::fmadd(p, f, V::set1(2.4022651e-1f)); // ln(2)^2 / 2!
+	p = V::fmadd(p, f, V::set1(6.9314718e-1f)); // ln(2)
+	p = V::fmadd(p, f, V::set1(1.0f));
+	return V::ldexp(p, n);
+}
+
+template <typename V>
+typename V::Reg simd_srgb_to_linear(typename V::Reg p_x) {
+	typedef typename V::Reg Reg;
+
+	const Reg lo = V::mul(p_x, V::set1(1.0f / 12.92f));
+	const Reg base = V::mul(V::add(p_x, V::set1(0.055f)), V::set1((float)(1.0 / (1.0 + 0.055))));
+	const Reg hi = simd_exp2<V>(V::mul(simd_log2<V>(base), V::set1(2.4f)));
+	return V::blend_alpha(V::select_lt(p_x, V::set1(0.04045f), lo, hi), p_x);
+}
+
+template <typename V>
+typename V::Reg simd_linear_to_srgb(typename V::Reg p_x) {
+	typedef typename V::Reg Reg;
+
+	const Reg lo = V::mul(p_x, V::set1(12.92f));
+	const Reg pw = simd_exp2<V>(V::mul(simd_log2<V>(p_x), V::set1(1.0f / 2.4f)));
+	const Reg hi = V::fmadd(pw, V::set1(1.0f + 0.055f), V::set1(-0.055f));
+	return V::blend_alpha(V::select_lt(p_x, V::set1(0.0031308f), lo, hi), p_x);
+}
+
+template <typename V>
+typename V::Reg simd_premultiply_alpha(typename V::Reg p_x) {
+	return V::blend_alpha(V::mul(p_x, V::splat_alpha(p_x)), p_x);
+}
+
+// Runs an RGBA transform over p_count colors. The remainder that doesn't fill a
+// whole register goes through a padded copy, so every color gets the same math.
+template <typename V, typename V::Reg (*OP)(typename V::Reg)>
+void simd_rgba_transform(float *p_dst, const float *p_src, int64_t p_count) {
+	static_assert(V::WIDTH % 4 == 0, "RGBA kernels need a multiple of 4 lanes.");
+
+	const int64_t total = p_count * 4;
+	int64_t i = 0;
+	for (; i + V::WIDTH <= total; i += V::WIDTH) {
+		V::store(p_dst + i, OP(V::load(p_src + i)));
+	}
+	if (i < total) {
+		float buffer[V::WIDTH];
+		const int64_t remaining = total - i;
+		for (int64_t j = 0; j < V::WIDTH; j++) {
+			buffer[j] = j < remaining ? p_src[i + j] : 1.0f;
+		}
+		V::store(buffer, OP(V::load(buffer)));
+		for (int64_t j = 0; j < remaining; j++) {
+			p_dst[i + j] = buffer[j];
+		}
+	}
+}
+
+template <typename V>
+void simd_mat4_mul(typename V::T *p_dst, const typename V::T *p_a, const typename V::T *p_b) {
+	typedef typename V::Reg Reg;
+	static_assert(V::WIDTH == 4);
+
+	const Reg a0 = V::load(p_a);
+	const Reg a1 = V::load(p_a + 4);
+	const Reg a2 = V::load(p_a + 8);
+	const Reg a3 = V::load(p_a + 12);
+	Reg columns[4];
+	for (int i = 0; i < 4; i++) {
+		const typename V::T *b = p_b + i * 4;
+		Reg column = V::mul(a0, V::set1(b[0]));
+		column = V::fmadd(a1, V::set1(b[1]), column);
+		column = V::fmadd(a2, V::set1(b[2]), column);
+		columns[i] = V::fmadd(a3, V::set1(b[3]), column);
+	}
+	for (int i = 0; i < 4; i++) {
+		V::store(p_dst + i * 4, columns[i]);
+	}
+}
+
+// 2x2 matrices stored as (m00, m01, m10, m11) in one register.
+template <typename V>
+_ALWAYS_INLINE_ typename V::Reg simd_mat2_mul(typename V::Reg p_a, typename V::Reg p_b) {
+	return V::add(V::mul(p_a, V::template shuffle<0, 3, 0, 3>(p_b, p_b)),
+			V::mul(V::template shuffle<1, 0, 3, 2>(p_a, p_a), V::template shuffle<2, 1, 2, 1>(p_b, p_b)));
+}
+
+// adj(a) * b
+template <typename V>
+_ALWAYS_INLINE_ typename V::Reg simd_mat2_adj_mul(typename V::Reg p_a, typename V::Reg p_b) {
+	return V::sub(V::mul(V::template shuffle<3, 3, 0, 0>(p_a, p_a), p_b),
+			V::mul(V::template shuffle<1, 1, 2, 2>(p_a, p_a), V::template shuffle<2, 3, 0, 1>(p_b, p_b)));
+}
+
+// a * adj(b)
+template <typename V>
+_ALWAYS_INLINE_ typename V::Reg simd_mat2_mul_adj(typename V::Reg p_a, typename V::Reg p_b) {
+	return V::sub(V::mul(p_a, V::template shuffle<3, 0, 3, 0>(p_b, p_b)),
+			V::mul(V::template shuffle<1, 0, 3, 2>(p_a, p_a), V::template shuffle<2, 1, 2, 1>(p_b, p_b)));
+}
+
+// Blockwise inversion: the matrix is split in four 2x2 blocks, which gives the
+// adjugate with a few 2x2 products. The layout doesn't matter since
+// inverse(transpose(M)) == transpose(inverse(M)).
+template <typename V>
+bool simd_mat4_inverse(typename V::T *p_dst, const typename V::T *p_src) {
+	typedef typename V::T T;
+	typedef typename V::Reg Reg;
+	static_assert(V::WIDTH == 4);
+
+	const Reg c0 = V::load(p_src);
+	const Reg c1 = V::load(p_src + 4);
+	const Reg c2 = V::load(p_src + 8);
+	const Reg c3 = V::load(p_src + 12);
+
+	const Reg a = V::template shuffle<0, 1, 0, 1>(c0, c1);
+	const Reg b = V::template shuffle<2, 3, 2, 3>(c0, c1);
+	const Reg c = V::template shuffle<0, 1, 0, 1>(c2, c3);
+	const Reg d = V::template shuffle<2, 3, 2, 3>(c2, c3);
+
+	// Determinants of a, b, c and d.
+	const Reg det_sub = V::sub(
+			V::mul(V::template shuffle<0, 2, 0, 2>(c0, c2), V::template shuffle<1, 3, 1, 3>(c1, c3)),
+			V::mul(V::template shuffle<1, 3, 1, 3>(c0, c2), V::template shuffle<0, 2, 0, 2>(c1, c3)));
+	const Reg det_a = V::template shuffle<0, 0, 0, 0>(det_sub, det_sub);
+	const Reg det_b = V::template shuffle<1, 1, 1, 1>(det_sub, det_sub);
+	const Reg det_c = V::template shuffle<2, 2, 2, 2>(det_sub, det_sub);
+	const Reg det_d = V::template shuffle<3, 3, 3, 3>(det_sub, det_sub);
+
+	const Reg d_c = simd_mat2_adj_mul<V>(d, c);
+	const Reg a_b = simd_mat2_adj_mul<V>(a, b);
+	Reg x = V::sub(V::mul(det_d, a), simd_mat2_mul<V>(b, d_c));
+	Reg w = V::sub(V::mul(det_a, d), simd_mat2_mul<V>(c, a_b));
+	Reg y = V::sub(V::mul(det_b, c), simd_mat2_mul_adj<V>(d, a_b));
+	Reg z = V::sub(V::mul(det_c, b), simd_mat2_mul_adj<V>(a, d_c));
+
+	T det = V::reduce_add(V::mul(det_sub, V::template shuffle<3, 2, 1, 0>(det_sub, det_sub))) * (T)0.5;
+	det -= V::reduce_add(V::mul(a_b, V::template shuffle<0, 2, 1, 3>(d_c, d_c)));
+	// Math::is_zero_approx(), like the scalar kernel. math.hpp isn't included
+	// here, so that none of its functions are compiled with this instruction set.
+	if (det < (T)0.00001 && det > (T)-0.00001) {
+		return false;
+	}
+
+	alignas(32) const T signs[4] = { 1, -1, -1, 1 };
+	const Reg r_det = V::div(V::load(signs), V::set1(det));
+	x = V::mul(x, r_det);
+	y = V::mul(y, r_det);
+	z = V::mul(z, r_det);
+	w = V::mul(w, r_det);
+
+	V::store(p_dst, V::template shuffle<3, 1, 3, 1>(x, y));
+	V::store(p_dst + 4, V::template shuffle<2, 0, 2, 0>(x, y));
+	V::store(p_dst + 8, V::template shuffle<3, 1, 3, 1>(z, w));
+	V::store(p_dst + 12, V::template shuffle<2, 0, 2, 0>(z, w));
+	return true;
+}
+
+template <typename V>
+void simd_mat4_xform4(typename V::T *p_dst, const typename V::T *p_matrix, const typename V::T *p_src, int64_t p_count) {
+	typedef typename V::Reg Reg;
+	static_assert(V::WIDTH == 4);
+
+	const Reg c0 = V::load(p_matrix);
+	const Reg c1 = V::load(p_matrix + 4);
+	const Reg c2 = V::load(p_matrix + 8);
+	const Reg c3 = V::load(p_matrix + 12);
+	for (int64_t i = 0; i < p_count * 4; i += 4) {
+		Reg v = V::mul(c0, V::set1(p_src[i]));
+		v = V::fmadd(c1, V::set1(p_src[i + 1]), v);
+		v = V::fmadd(c2, V::set1(p_src[i + 2]), v);
+		V::store(p_dst + i, V::fmadd(c3, V::set1(p_src[i + 3]), v));
+	}
+}
+
+template <typename V>
+void simd_mat4_xform3(typename V::T *p_dst, const typename V::T *p_matrix, const typename V::T *p_src, int64_t p_count) {
+	typedef typename V::T T;
+	typedef typename V::Reg Reg;
+	static_assert(V::WIDTH == 4);
+
+	const Reg c0 = V::load(p_matrix);
+	const Reg c1 = V::load(p_matrix + 4);
+	const Reg c2 = V::load(p_matrix + 8);
+	const Reg c3 = V::load(p_matrix + 12);
+	alignas(32) T v[4];
+	for (int64_t i = 0; i < p_count * 3; i += 3) {
+		Reg r = V::fmadd(c0, V::set1(p_src[i]), c3);
+		r = V::fmadd(c1, V::set1(p_src[i + 1]), r);
+		V::store(v, V::fmadd(c2, V::set1(p_src[i + 2]), r));
+		p_dst[i] = v[0] / v[3];
+		p_dst[i + 1] = v[1] / v[3];
+		p_dst[i + 2] = v[2] / v[3];
+	}
+}
+
+template <typename V>
+void simd_fill_mat4_f32(godot::MathKernels::Table &r_table) {
+	r_table.mat4_mul_f32 = simd_mat4_mul<V>;
+	r_table.mat4_inverse_f32 = simd_mat4_inverse<V>;
+	r_table.mat4_xform4_f32 = simd_mat4_xform4<V>;
+	r_table.mat4_xform3_f32 = simd_mat4_xform3<V>;
+}
+
+template <typename V>
+void simd_fill_mat4_f64(godot::MathKernels::Table &r_table) {
+	r_table.mat4_mul_f64 = simd_mat4_mul<V>;
+	r_table.mat4_inverse_f64 = simd_mat4_inverse<V>;
+	r_table.mat4_xform4_f64 = simd_mat4_xform4<V>;
+	r_table.mat4_xform3_f64 = simd_mat4_xform3<V>;
+}
+
+template <typename F32, typename F64>
+void simd_fill_table(godot::MathKernels::Table &r_table) {
+	r_table.sum_f32 = simd_sum<F32>;
+	r_table.min_f32 = simd_min<F32>;
+	r_table.max_f32 = simd_max<F32>;
+	r_table.dot_f32 = simd_dot<F32>;
+	r_table.scale_f32 = simd_scale<F32>;
+	r_table.add_f32 = simd_add<F32>;
+	r_table.axpy_f32 = simd_axpy<F32>;
+	r_table.clamp_f32 = simd_clamp<F32>;
+	r_table.lerp_f32 = simd_lerp<F32>;
+
+	r_table.sum_f64 = simd_sum<F64>;
+	r_table.min_f64 = simd_min<F64>;
+	r_table.max_f64 = simd_max<F64>;
+	r_table.dot_f64 = simd_dot<F64>;
+	r_table.scale_f64 = simd_scale<F64>;
+	r_table.add_f64 = simd_add<F64>;
+	r_table.axpy_f64 = simd_axpy<F64>;
+	r_table.clamp_f64 = simd_clamp<F64>;
+	r_table.lerp_f64 = simd_lerp<F64>;
+
+	r_table.srgb_to_linear_rgba = simd_rgba_transform<F32, simd_srgb_to_linear<F32>>;
+	r_table.linear_to_srgb_rgba = simd_rgba_transform<F32, simd_linear_to_srgb<F32>>;
+	r_table.premultiply_alpha_rgba = simd_rgba_transform<F32, simd_premultiply_alpha<F32>>;
+}
+
+} // namespace
@@ -34,16 +34,28 @@
 
 namespace godot {
 
-void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
-#ifdef DEBUG_ENABLED
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+#define ACCOUNTING_HEADER_SIZE MemoryAccounting::HEADER_SIZE
+#else
+#define ACCOUNTING_HEADER_SIZE 0
+#endif
+
+void *Memory::alloc_static(size_t p_bytes, bool p_pad_align, uint32_t p_tag) {
+#if defined(DEBUG_ENABLED) && !defined(GODOT_MEMORY_ACCOUNTING_ENABLED)
 	bool prepad = false; // Alredy pre paded in the engine.
 #else
+	// The accounting header takes the place of the engine's padding, so the
+	// element count of memnew_arr() needs our own.
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = internal::gdextension_interface_mem_alloc(p_bytes + (prepad ? PAD_ALIGN : 0));
+	void *mem = internal::gdextension_interface_mem_alloc(p_bytes + (prepad ? PAD_ALIGN : 0) + ACCOUNTING_HEADER_SIZE);
 	ERR_FAIL_NULL_V(mem, nullptr);
 
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+	mem = MemoryAccounting::track_alloc(mem, p_bytes, p_tag);
+#endif
+
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
 		return s8 + PAD_ALIGN;
@@ -52,9 +64,9 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	}
 }
 
-void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
+void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align, uint32_t p_tag) {
 	if (p_memory == nullptr) {
-		return alloc_static(p_bytes, p_pad_align);
+		return alloc_static(p_bytes, p_pad_align, p_tag);
 	} else if (p_bytes == 0) {
 		free_static(p_memory, p_pad_align);
 		return nullptr;
@@ -62,7 +74,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && !defined(GODOT_MEMORY_ACCOUNTING_ENABLED)
 	bool prepad = false; // Alredy pre paded in the engine.
 #else
 	bool prepad = p_pad_align;
@@ -70,18 +82,32 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	if (prepad) {
 		mem -= PAD_ALIGN;
+	}
+
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+	size_t old_bytes;
+	uint32_t old_tag;
+	mem = (uint8_t *)MemoryAccounting::get_base(mem, old_bytes, old_tag);
+	mem = (uint8_t *)internal::gdextension_interface_mem_realloc(mem, p_bytes + (prepad ? PAD_ALIGN : 0) + ACCOUNTING_HEADER_SIZE);
+	ERR_FAIL_NULL_V(mem, nullptr);
+	MemoryAccounting::track_free(old_bytes, old_tag);
+	mem = (uint8_t *)MemoryAccounting::track_alloc(mem, p_bytes, p_tag != MemoryAccounting::TAG_UNTAGGED ? p_tag : old_tag);
+	return prepad ? mem + PAD_ALIGN : mem;
+#else
+	if (prepad) {
 		mem = (uint8_t *)internal::gdextension_interface_mem_realloc(mem, p_bytes + PAD_ALIGN);
 		ERR_FAIL_NULL_V(mem, nullptr);
 		return mem + PAD_ALIGN;
 	} else {
 		return (uint8_t *)internal::gdextension_interface_mem_realloc(mem, p_bytes);
 	}
+#endif
 }
 
 void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && !defined(GODOT_MEMORY_ACCOUNTING_ENABLED)
 	bool prepad = false; // Alredy pre paded in the engine.
 #else
 	bool prepad = p_pad_align;
@@ -90,9 +116,21 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	if (prepad) {
 		mem -= PAD_ALIGN;
 	}
+
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+	if (p_ptr) {
+		size_t bytes;
+		uint32_t tag;
+		mem = (uint8_t *)MemoryAccounting::get_base(mem, bytes, tag);
+		MemoryAccounting::track_free(bytes, tag);
+	}
+#endif
+
 	internal::gdextension_interface_mem_free(mem);
 }
 
+#undef ACCOUNTING_HEADER_SIZE
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -0,0 +1,360 @@
+/**************************************************************************/
+/*  memory_accounting.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/memory_accounting.hpp>
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+namespace godot {
+
+namespace {
+
+struct Header {
+	uint64_t bytes;
+	uint32_t tag;
+	uint32_t magic;
+};
+static_assert(sizeof(Header) == MemoryAccounting::HEADER_SIZE);
+
+constexpr uint32_t HEADER_MAGIC = 0x6d656d61;
+// How far the live size of a tag on one thread may drift before it's added to
+// the shared total, which the peak is computed from.
+constexpr int64_t LIVE_BYTES_BATCH = 64 * 1024;
+
+struct Counters {
+	uint64_t allocations = 0;
+	uint64_t frees = 0;
+	uint64_t allocated_bytes = 0;
+	uint64_t freed_bytes = 0;
+	int64_t pending_bytes = 0;
+	uint64_t size_histogram[MemoryAccounting::SIZE_BUCKETS] = {};
+};
+
+// Everything here is allocated with the global operator new, not through
+// Memory, which would account for it and recurse.
+struct ThreadCounters {
+	SpinLock lock;
+	std::vector<Counters> tags;
+};
+
+struct TagInfo {
+	std::string name;
+	std::atomic<int64_t> live_bytes = 0;
+	std::atomic<int64_t> peak_bytes = 0;
+};
+
+struct Registry {
+	SpinLock lock;
+	std::vector<TagInfo *> tags;
+	std::unordered_map<std::string, uint32_t> tags_by_name;
+	std::vector<ThreadCounters *> threads;
+};
+
+// Never destroyed: memory is still freed by the destructors of static
+// variables after this file's own would have run.
+Registry &get_registry() {
+	static Registry *registry = [] {
+		Registry *r = new Registry;
+		r->tags.push_back(new TagInfo{ "untagged" });
+		r->tags_by_name["untagged"] = MemoryAccounting::TAG_UNTAGGED;
+		return r;
+	}();
+	return *registry;
+}
+
+// Not freed when the thread exits, see MethodProfiler.
+thread_local ThreadCounters *thread_counters = nullptr;
+
+ThreadCounters *get_thread_counters() {
+	if (likely(thread_counters)) {
+		return thread_counters;
+	}
+	ThreadCounters *counters = new ThreadCounters;
+	Registry &registry = get_registry();
+	registry.lock.lock();
+	registry.threads.push_back(counters);
+	registry.lock.unlock();
+	thread_counters = counters;
+	return counters;
+}
+
+_FORCE_INLINE_ uint32_t get_size_bucket(uint64_t p_bytes) {
+	return std::min<uint32_t>(MemoryAccounting::SIZE_BUCKETS - 1, std::max(1, (int)std::bit_width(p_bytes)) - 1);
+}
+
+void flush_live_bytes(uint32_t p_tag, int64_t p_bytes) {
+	Registry &registry = get_registry();
+	registry.lock.lock();
+	TagInfo *info = registry.tags[p_tag];
+	registry.lock.unlock();
+
+	const int64_t live = info->live_bytes.fetch_add(p_bytes, std::memory_order_relaxed) + p_bytes;
+	int64_t peak = info->peak_bytes.load(std::memory_order_relaxed);
+	while (live > peak && !info->peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+	}
+}
+
+// Updates the counters of this thread. A negative `p_allocations` takes back
+// allocations, when they move to another tag.
+void count(uint32_t p_tag, uint64_t p_bytes, int64_t p_allocations, int64_t p_frees) {
+	ThreadCounters *thread = get_thread_counters();
+	int64_t flush = 0;
+
+	thread->lock.lock();
+	if (unlikely(p_tag >= thread->tags.size())) {
+		thread->tags.resize(p_tag + 1);
+	}
+	Counters &counters = thread->tags[p_tag];
+	counters.allocations += p_allocations;
+	counters.allocated_bytes += p_allocations * (int64_t)p_bytes;
+	counters.size_histogram[get_size_bucket(p_bytes)] += p_allocations;
+	counters.frees += p_frees;
+	counters.freed_bytes += p_frees * (int64_t)p_bytes;
+	counters.pending_bytes += (p_allocations - p_frees) * (int64_t)p_bytes;
+	if (counters.pending_bytes >= LIVE_BYTES_BATCH || counters.pending_bytes <= -LIVE_BYTES_BATCH) {
+		flush = counters.pending_bytes;
+		counters.pending_bytes = 0;
+	}
+	thread->lock.unlock();
+
+	if (flush != 0) {
+		flush_live_bytes(p_tag, flush);
+	}
+}
+
+std::string format_bytes(int64_t p_bytes) {
+	char buffer[32];
+	const uint64_t magnitude = p_bytes < 0 ? -(uint64_t)p_bytes : (uint64_t)p_bytes;
+	if (magnitude < 1024) {
+		snprintf(buffer, sizeof(buffer), "%" PRId64 " B", p_bytes);
+	} else if (magnitude < 1024 * 1024) {
+		snprintf(buffer, sizeof(buffer), "%.1f KiB", p_bytes / 1024.0);
+	} else {
+		snprintf(buffer, sizeof(buffer), "%.1f MiB", p_bytes / (1024.0 * 1024.0));
+	}
+	return buffer;
+}
+
+} // namespace
+
+void *MemoryAccounting::track_alloc(void *p_base, size_t p_bytes, uint32_t p_tag) {
+	Header *header = (Header *)p_base;
+	header->bytes = p_bytes;
+	header->tag = p_tag;
+	header->magic = HEADER_MAGIC;
+	count(p_tag, p_bytes, 1, 0);
+	return header + 1;
+}
+
+void *MemoryAccounting::get_base(void *p_memory, size_t &r_bytes, uint32_t &r_tag) {
+	Header *header = (Header *)p_memory - 1;
+	CRASH_COND_MSG(header->magic != HEADER_MAGIC, "Memory wasn't allocated by Memory::alloc_static() or was already freed.");
+	r_bytes = header->bytes;
+	r_tag = header->tag;
+	return header;
+}
+
+void MemoryAccounting::track_free(size_t p_bytes, uint32_t p_tag) {
+	count(p_tag, p_bytes, 0, 1);
+}
+
+void MemoryAccounting::retag(void *p_memory, uint32_t p_tag) {
+	Header *header = (Header *)p_memory - 1;
+	if (header->tag == p_tag) {
+		return;
+	}
+	count(header->tag, header->bytes, -1, 0);
+	count(p_tag, header->bytes, 1, 0);
+	header->tag = p_tag;
+}
+
+uint32_t MemoryAccounting::register_tag(const char *p_name) {
+	Registry &registry = get_registry();
+	registry.lock.lock();
+	auto it = registry.tags_by_name.find(p_name);
+	uint32_t tag;
+	if (it != registry.tags_by_name.end()) {
+		tag = it->second;
+	} else {
+		tag = (uint32_t)registry.tags.size();
+		registry.tags.push_back(new TagInfo{ p_name });
+		registry.tags_by_name[p_name] = tag;
+	}
+	registry.lock.unlock();
+	return tag;
+}
+
+uint32_t MemoryAccounting::register_type_tag(const char *p_signature) {
+	// GCC: "... get_tag() [with T = godot::Foo<int>; uint32_t = unsigned int]"
+	// Clang: "... get_tag() [T = godot::Foo<int>]"
+	// MSVC: "unsigned int __cdecl godot::MemoryAccounting::get_tag<class godot::Foo<int>>(void)"
+	std::string name = p_signature;
+	if (const char *begin = strstr(p_signature, "T = ")) {
+		begin += 4;
+		const char *end = begin;
+		int depth = 0;
+		for (; *end; end++) {
+			if (*end == '<' || *end == '(' || *end == '[') {
+				depth++;
+			} else if (*end == '>' || *end == ')' || *end == ']') {
+				if (depth == 0) {
+					break;
+				}
+				depth--;
+			} else if (*end == ';' && depth == 0) {
+				break;
+			}
+		}
+		name.assign(begin, end);
+	} else if (const char *begin = strstr(p_signature, "get_tag<")) {
+		begin += 8;
+		const char *end = strrchr(p_signature, '>');
+		name.assign(begin, end ? end : begin + strlen(begin));
+		for (const char *keyword : { "class ", "struct ", "enum " }) {
+			for (size_t pos = name.find(keyword); pos != std::string::npos; pos = name.find(keyword, pos)) {
+				name.erase(pos, strlen(keyword));
+			}
+		}
+	}
+	for (size_t pos = name.find("godot::"); pos != std::string::npos; pos = name.find("godot::", pos)) {
+		name.erase(pos, 7);
+	}
+	return register_tag(name.c_str());
+}
+
+MemoryAccounting::Snapshot MemoryAccounting::snapshot() {
+	Registry &registry = get_registry();
+	Snapshot snapshot;
+
+	registry.lock.lock();
+	snapshot.resize(registry.tags.size());
+	for (size_t i = 0; i < registry.tags.size(); i++) {
+		snapshot[i].name = registry.tags[i]->name;
+		snapshot[i].peak_bytes = registry.tags[i]->peak_bytes.load(std::memory_order_relaxed);
+	}
+	for (ThreadCounters *thread : registry.threads) {
+		thread->lock.lock();
+		const size_t count = std::min(thread->tags.size(), snapshot.size());
+		for (size_t i = 0; i < count; i++) {
+			const Counters &counters = thread->tags[i];
+			TagStats &stats = snapshot[i];
+			stats.allocations += counters.allocations;
+			stats.frees += counters.frees;
+			stats.allocated_bytes += counters.allocated_bytes;
+			stats.freed_bytes += counters.freed_bytes;
+			for (uint32_t j = 0; j < SIZE_BUCKETS; j++) {
+				stats.size_histogram[j] += counters.size_histogram[j];
+			}
+		}
+		thread->lock.unlock();
+	}
+	registry.lock.unlock();
+
+	for (TagStats &stats : snapshot) {
+		stats.live_bytes = (int64_t)(stats.allocated_bytes - stats.freed_bytes);
+		stats.peak_bytes = std::max(stats.peak_bytes, stats.live_bytes);
+	}
+	return snapshot;
+}
+
+MemoryAccounting::Snapshot MemoryAccounting::diff(const Snapshot &p_before, const Snapshot &p_after) {
+	Snapshot result = p_after;
+	const size_t count = std::min(p_before.size(), p_after.size());
+	for (size_t i = 0; i < count; i++) {
+		const TagStats &before = p_before[i];
+		TagStats &stats = result[i];
+		stats.allocations -= before.allocations;
+		stats.frees -= before.frees;
+		stats.allocated_bytes -= before.allocated_bytes;
+		stats.freed_bytes -= before.freed_bytes;
+		stats.live_bytes -= before.live_bytes;
+		for (uint32_t j = 0; j < SIZE_BUCKETS; j++) {
+			stats.size_histogram[j] -= before.size_histogram[j];
+		}
+	}
+	return result;
+}
+
+std::string MemoryAccounting::format(const Snapshot &p_snapshot) {
+	std::vector<const TagStats *> tags;
+	for (const TagStats &stats : p_snapshot) {
+		if (stats.allocations != 0 || stats.frees != 0 || stats.live_bytes != 0) {
+			tags.push_back(&stats);
+		}
+	}
+	std::sort(tags.begin(), tags.end(), [](const TagStats *p_a, const TagStats *p_b) {
+		return std::abs(p_a->live_bytes) > std::abs(p_b->live_bytes);
+	});
+
+	std::string result;
+	char line[160];
+	snprintf(line, sizeof(line), "%12s %10s %12s %10s %10s  %s\n", "live", "count", "peak", "allocs", "frees", "tag");
+	result += line;
+	for (const TagStats *stats : tags) {
+		snprintf(line, sizeof(line), "%12s %10" PRId64 " %12s %10" PRIu64 " %10" PRIu64 "  ", format_bytes(stats->live_bytes).c_str(), stats->get_live_allocations(), format_bytes(stats->peak_bytes).c_str(), stats->allocations, stats->frees);
+		result += line;
+		result += stats->name;
+		result += '\n';
+	}
+	return result;
+}
+
+void MemoryAccounting::print_leaks() {
+	Snapshot leaks = snapshot();
+	int64_t count = 0;
+	int64_t bytes = 0;
+	for (TagStats &stats : leaks) {
+		if (stats.get_live_allocations() > 0) {
+			count += stats.get_live_allocations();
+			bytes += stats.live_bytes;
+		} else {
+			stats = TagStats();
+		}
+	}
+	if (count == 0) {
+		return;
+	}
+
+	char summary[128];
+	snprintf(summary, sizeof(summary), "%" PRId64 " allocations (%s) are still alive after deinitialization:\n", count, format_bytes(bytes).c_str());
+	WARN_PRINT((summary + format(leaks)).c_str());
+}
+
+} // namespace godot
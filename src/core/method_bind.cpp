@@ -30,6 +30,8 @@
 
 #include <godot_cpp/core/method_bind.hpp>
 
+#include <godot_cpp/core/method_profiler.hpp>
+
 namespace godot {
 
 StringName MethodBind::get_name() const {
@@ -93,7 +95,13 @@ PropertyInfo MethodBind::get_argument_info(int p_argument) const {
 
 void MethodBind::bind_call(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstVariantPtr *p_args, GDExtensionInt p_argument_count, GDExtensionVariantPtr r_return, GDExtensionCallError *r_error) {
 	const MethodBind *bind = reinterpret_cast<const MethodBind *>(p_method_userdata);
+#ifdef GODOT_METHOD_PROFILER_ENABLED
+	const uint64_t begin = MethodProfiler::get_ticks_nsec();
+	Variant ret = bind->call(p_instance, p_args, p_argument_count, *r_error);
+	MethodProfiler::record(bind, false, MethodProfiler::get_ticks_nsec() - begin);
+#else
 	Variant ret = bind->call(p_instance, p_args, p_argument_count, *r_error);
+#endif
 	// This assumes the return value is an empty Variant, so it doesn't need to call the destructor first.
 	// Since only GDExtensionMethodBind calls this from the Godot side, it should always be the case.
 	internal::gdextension_interface_variant_new_copy(r_return, ret._native_ptr());
@@ -101,7 +109,13 @@ void MethodBind::bind_call(void *p_method_userdata, GDExtensionClassInstancePtr
 
 void MethodBind::bind_ptrcall(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_return) {
 	const MethodBind *bind = reinterpret_cast<const MethodBind *>(p_method_userdata);
+#ifdef GODOT_METHOD_PROFILER_ENABLED
+	const uint64_t begin = MethodProfiler::get_ticks_nsec();
+	bind->ptrcall(p_instance, p_args, r_return);
+	MethodProfiler::record(bind, true, MethodProfiler::get_ticks_nsec() - begin);
+#else
 	bind->ptrcall(p_instance, p_args, r_return);
+#endif
 }
 
 MethodBind::~MethodBind() {
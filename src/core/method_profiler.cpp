@@ -0,0 +1,243 @@
+/**************************************************************************/
+/*  method_profiler.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/core/method_profiler.hpp>
+
+#include <godot_cpp/core/method_bind.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+#include <godot_cpp/variant/string_builder.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+
+namespace godot {
+
+namespace {
+
+struct MethodName {
+	StringName class_name;
+	StringName method_name;
+};
+
+// Counters of one thread, indexed by MethodBind::profiler_index. The lock is
+// only ever contended by get_report() and reset().
+struct ThreadCounters {
+	SpinLock lock;
+	LocalVector<MethodProfiler::Counters> counters;
+};
+
+// Threads don't give their counters back when they exit: that would need a
+// thread_local with a destructor, which prevents the library from being
+// unloaded on hot reload. They stay here, still part of the reports, until clear().
+SpinLock registry_lock;
+std::vector<MethodName> methods;
+std::vector<ThreadCounters *> threads;
+
+// Bumped by clear(), so threads notice their counters are gone.
+std::atomic<uint32_t> generation = 1;
+thread_local ThreadCounters *thread_counters = nullptr;
+thread_local uint32_t thread_generation = 0;
+
+ThreadCounters *get_thread_counters() {
+	const uint32_t current = generation.load(std::memory_order_acquire);
+	if (likely(thread_generation == current)) {
+		return thread_counters;
+	}
+	ThreadCounters *counters = memnew(ThreadCounters);
+	registry_lock.lock();
+	threads.push_back(counters);
+	registry_lock.unlock();
+	thread_counters = counters;
+	thread_generation = current;
+	return counters;
+}
+
+} // namespace
+
+uint64_t MethodProfiler::Counters::get_percentile_nsec(double p_fraction) const {
+	const uint64_t calls = get_call_count();
+	if (calls == 0) {
+		return 0;
+	}
+	const uint64_t target = std::max<uint64_t>(1, (uint64_t)(p_fraction * (double)calls + 0.5));
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < HISTOGRAM_BUCKETS - 1; i++) {
+		seen += histogram[i];
+		if (seen >= target) {
+			return std::min<uint64_t>(max_nsec, (uint64_t(1) << (i + 1)) - 1);
+		}
+	}
+	return max_nsec;
+}
+
+void MethodProfiler::Counters::merge(const Counters &p_other) {
+	variant_calls += p_other.variant_calls;
+	ptrcalls += p_other.ptrcalls;
+	total_nsec += p_other.total_nsec;
+	max_nsec = std::max(max_nsec, p_other.max_nsec);
+	for (uint32_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		histogram[i] += p_other.histogram[i];
+	}
+}
+
+void MethodProfiler::register_method(const StringName &p_class_name, MethodBind *p_method) {
+	registry_lock.lock();
+	p_method->profiler_index = (uint32_t)methods.size();
+	methods.push_back({ p_class_name, p_method->get_name() });
+	registry_lock.unlock();
+}
+
+void MethodProfiler::record(const MethodBind *p_method, bool p_ptrcall, uint64_t p_nsec) {
+	const uint32_t index = p_method->profiler_index;
+	if (unlikely(index == UINT32_MAX)) {
+		return;
+	}
+	ThreadCounters *thread = get_thread_counters();
+
+	thread->lock.lock();
+	if (unlikely(index >= thread->counters.size())) {
+		thread->counters.resize(index + 1);
+	}
+	Counters &counters = thread->counters[index];
+	if (p_ptrcall) {
+		counters.ptrcalls++;
+	} else {
+		counters.variant_calls++;
+	}
+	counters.total_nsec += p_nsec;
+	counters.max_nsec = std::max(counters.max_nsec, p_nsec);
+	counters.histogram[std::min<uint32_t>(HISTOGRAM_BUCKETS - 1, std::max(1, (int)std::bit_width(p_nsec)) - 1)]++;
+	thread->lock.unlock();
+}
+
+uint64_t MethodProfiler::get_ticks_nsec() {
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::vector<MethodProfiler::Entry> MethodProfiler::get_report() {
+	std::vector<Counters> merged;
+
+	registry_lock.lock();
+	std::vector<MethodName> names = methods;
+	merged.resize(names.size());
+	for (ThreadCounters *thread : threads) {
+		thread->lock.lock();
+		const uint32_t count = std::min<uint32_t>(thread->counters.size(), (uint32_t)merged.size());
+		for (uint32_t i = 0; i < count; i++) {
+			merged[i].merge(thread->counters[i]);
+		}
+		thread->lock.unlock();
+	}
+	registry_lock.unlock();
+
+	std::vector<Entry> report;
+	for (size_t i = 0; i < merged.size(); i++) {
+		if (merged[i].get_call_count() > 0) {
+			report.push_back({ names[i].class_name, names[i].method_name, merged[i] });
+		}
+	}
+	std::sort(report.begin(), report.end(), [](const Entry &p_a, const Entry &p_b) {
+		return p_a.counters.total_nsec > p_b.counters.total_nsec;
+	});
+	return report;
+}
+
+String MethodProfiler::get_csv() {
+	StringBuilder sb;
+	sb.append("class,method,variant_calls,ptrcalls,total_nsec,mean_nsec,max_nsec,p50_nsec,p99_nsec\n");
+	for (const Entry &entry : get_report()) {
+		const Counters &c = entry.counters;
+		sb.append(String(entry.class_name)).append(U',').append(String(entry.method_name));
+		sb.append(U',').append_int((int64_t)c.variant_calls);
+		sb.append(U',').append_int((int64_t)c.ptrcalls);
+		sb.append(U',').append_int((int64_t)c.total_nsec);
+		sb.append(U',').append_int((int64_t)c.get_mean_nsec());
+		sb.append(U',').append_int((int64_t)c.max_nsec);
+		sb.append(U',').append_int((int64_t)c.get_percentile_nsec(0.5));
+		sb.append(U',').append_int((int64_t)c.get_percentile_nsec(0.99));
+		sb.append(U'\n');
+	}
+	return sb.as_string();
+}
+
+String MethodProfiler::get_json() {
+	StringBuilder sb;
+	sb.append("{\"histogram_buckets\":").append_int(HISTOGRAM_BUCKETS).append(",\"methods\":[");
+	bool first = true;
+	for (const Entry &entry : get_report()) {
+		const Counters &c = entry.counters;
+		sb.append(first ? "\n" : ",\n");
+		first = false;
+		sb.append("{\"class\":\"").append(String(entry.class_name));
+		sb.append("\",\"method\":\"").append(String(entry.method_name));
+		sb.append("\",\"variant_calls\":").append_int((int64_t)c.variant_calls);
+		sb.append(",\"ptrcalls\":").append_int((int64_t)c.ptrcalls);
+		sb.append(",\"total_nsec\":").append_int((int64_t)c.total_nsec);
+		sb.append(",\"max_nsec\":").append_int((int64_t)c.max_nsec);
+		sb.append(",\"histogram\":[");
+		for (uint32_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+			if (i > 0) {
+				sb.append(U',');
+			}
+			sb.append_int((int64_t)c.histogram[i]);
+		}
+		sb.append("]}");
+	}
+	sb.append("\n]}\n");
+	return sb.as_string();
+}
+
+void MethodProfiler::reset() {
+	registry_lock.lock();
+	for (ThreadCounters *thread : threads) {
+		thread->lock.lock();
+		for (Counters &counters : thread->counters) {
+			counters = Counters();
+		}
+		thread->lock.unlock();
+	}
+	registry_lock.unlock();
+}
+
+void MethodProfiler::clear() {
+	registry_lock.lock();
+	for (ThreadCounters *thread : threads) {
+		memdelete(thread);
+	}
+	threads.clear();
+	methods.clear();
+	generation.fetch_add(1, std::memory_order_release);
+	registry_lock.unlock();
+}
+
+} // namespace godot
@@ -31,10 +31,15 @@
 #include <godot_cpp/godot.hpp>
 
 #include <godot_cpp/classes/editor_plugin_registration.hpp>
+#include <godot_cpp/classes/gdextension_profiler.hpp>
 #include <godot_cpp/classes/wrapped.hpp>
+#include <godot_cpp/core/abi_tracer.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/cpu_features.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/core/method_profiler.hpp>
 #include <godot_cpp/core/version.hpp>
+#include <godot_cpp/templates/paged_allocator.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 #include <godot_cpp/core/error_macros.hpp>
@@ -208,7 +213,20 @@ GDExtensionBinding::InitDataList GDExtensionBinding::initdata;
 	if (!internal::gdextension_interface_##m_name) {                                    \
 		ERR_PRINT_EARLY("Unable to load GDExtension interface function " #m_name "()"); \
 		return false;                                                                   \
+	}                                                                                   \
+	TRACE_PROC_ADDRESS(m_name)
+
+#ifdef GODOT_ABI_TRACER_ENABLED
+#define TRACE_PROC_ADDRESS(m_name)                                                                                 \
+	{                                                                                                              \
+		struct Tag {                                                                                               \
+			static constexpr const char *get_name() { return #m_name; }                                            \
+		};                                                                                                         \
+		internal::gdextension_interface_##m_name = ABITracer::wrap<Tag>(internal::gdextension_interface_##m_name); \
 	}
+#else
+#define TRACE_PROC_ADDRESS(m_name)
+#endif
 
 // Partial definition of the legacy interface so we can detect it and show an error.
 typedef struct {
@@ -436,6 +454,8 @@ GDExtensionBool GDExtensionBinding::init(GDExtensionInterfaceGetProcAddress p_ge
 	r_initialization->userdata = p_init_data;
 	r_initialization->minimum_initialization_level = p_init_data->minimum_initialization_level;
 
+	CPUFeatures::initialize();
+
 	Variant::init_bindings();
 	godot::internal::register_engine_classes();
 
@@ -444,12 +464,19 @@ GDExtensionBool GDExtensionBinding::init(GDExtensionInterfaceGetProcAddress p_ge
 }
 
 #undef LOAD_PROC_ADDRESS
+#undef TRACE_PROC_ADDRESS
 #undef ERR_PRINT_EARLY
 
 void GDExtensionBinding::initialize_level(void *p_userdata, GDExtensionInitializationLevel p_level) {
 	ERR_FAIL_COND(static_cast<ModuleInitializationLevel>(p_level) >= MODULE_INITIALIZATION_LEVEL_MAX);
 	ClassDB::current_level = p_level;
 
+#ifdef GODOT_METHOD_PROFILER_ENABLED
+	if (p_level == GDEXTENSION_INITIALIZATION_SCENE && level_initialized[p_level] == 0) {
+		ClassDB::register_abstract_class<GDExtensionProfiler>();
+	}
+#endif
+
 	InitData *init_data = static_cast<InitData *>(p_userdata);
 	if (init_data && init_data->init_callback) {
 		init_data->init_callback(static_cast<ModuleInitializationLevel>(p_level));
@@ -475,6 +502,23 @@ void GDExtensionBinding::deinitialize_level(void *p_userdata, GDExtensionInitial
 		EditorPlugins::deinitialize(p_level);
 		ClassDB::deinitialize(p_level);
 	}
+
+	// Once the last level is deinitialized, the method binds are gone and the extension is done with the engine.
+	for (int i = 0; i < MODULE_INITIALIZATION_LEVEL_MAX; i++) {
+		if (level_initialized[i] > 0) {
+			return;
+		}
+	}
+	PagedNodeAllocatorPools::release();
+#ifdef GODOT_METHOD_PROFILER_ENABLED
+	MethodProfiler::clear();
+#endif
+#ifdef GODOT_ABI_TRACER_ENABLED
+	ABITracer::clear();
+#endif
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+	MemoryAccounting::print_leaks();
+#endif
 }
 
 void GDExtensionBinding::InitDataList::add(InitData *p_data) {
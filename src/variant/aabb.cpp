@@ -48,30 +48,7 @@ bool AABB::operator!=(const AABB &p_rval) const {
 }
 
 void AABB::merge_with(const AABB &p_aabb) {
-#ifdef MATH_CHECKS
-	if (unlikely(size.x < 0 || size.y < 0 || size.z < 0 || p_aabb.size.x < 0 || p_aabb.size.y < 0 || p_aabb.size.z < 0)) {
-		ERR_PRINT("AABB size is negative, this is not supported. Use AABB.abs() to get an AABB with a positive size.");
-	}
-#endif
-	Vector3 beg_1, beg_2;
-	Vector3 end_1, end_2;
-	Vector3 min, max;
-
-	beg_1 = position;
-	beg_2 = p_aabb.position;
-	end_1 = size + beg_1;
-	end_2 = p_aabb.size + beg_2;
-
-	min.x = (beg_1.x < beg_2.x) ? beg_1.x : beg_2.x;
-	min.y = (beg_1.y < beg_2.y) ? beg_1.y : beg_2.y;
-	min.z = (beg_1.z < beg_2.z) ? beg_1.z : beg_2.z;
-
-	max.x = (end_1.x > end_2.x) ? end_1.x : end_2.x;
-	max.y = (end_1.y > end_2.y) ? end_1.y : end_2.y;
-	max.z = (end_1.z > end_2.z) ? end_1.z : end_2.z;
-
-	position = min;
-	size = max - min;
+	SpatialMath::aabb_merge_with(*this, p_aabb);
 }
 
 bool AABB::is_equal_approx(const AABB &p_aabb) const {
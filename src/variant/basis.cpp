@@ -32,9 +32,6 @@
 #include <godot_cpp/variant/basis.hpp>
 #include <godot_cpp/variant/string.hpp>
 
-#define cofac(row1, col1, row2, col2) \
-	(rows[row1][col1] * rows[row2][col2] - rows[row1][col2] * rows[row2][col1])
-
 namespace godot {
 
 void Basis::from_z(const Vector3 &p_z) {
@@ -55,20 +52,7 @@ void Basis::from_z(const Vector3 &p_z) {
 }
 
 void Basis::invert() {
-	real_t co[3] = {
-		cofac(1, 1, 2, 2), cofac(1, 2, 2, 0), cofac(1, 0, 2, 1)
-	};
-	real_t det = rows[0][0] * co[0] +
-			rows[0][1] * co[1] +
-			rows[0][2] * co[2];
-#ifdef MATH_CHECKS
-	ERR_FAIL_COND(det == 0);
-#endif
-	real_t s = 1.0f / det;
-
-	set(co[0] * s, cofac(0, 2, 2, 1) * s, cofac(0, 1, 1, 2) * s,
-			co[1] * s, cofac(0, 0, 2, 2) * s, cofac(0, 2, 1, 0) * s,
-			co[2] * s, cofac(0, 1, 2, 0) * s, cofac(0, 0, 1, 1) * s);
+	SpatialMath::basis_invert(*this);
 }
 
 void Basis::orthonormalize() {
@@ -209,9 +193,7 @@ Basis Basis::inverse() const {
 }
 
 void Basis::transpose() {
-	SWAP(rows[0][1], rows[1][0]);
-	SWAP(rows[0][2], rows[2][0]);
-	SWAP(rows[1][2], rows[2][1]);
+	SpatialMath::basis_transpose(*this);
 }
 
 Basis Basis::transposed() const {
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*  cached_projection.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/variant/cached_projection.hpp>
+
+#include <godot_cpp/core/math_kernels.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+
+namespace godot {
+
+void CachedProjection::_update_planes() const {
+	projection.get_projection_planes(Transform3D(), planes);
+	cached |= CACHED_PLANES;
+}
+
+void CachedProjection::_update_endpoints() const {
+	const Plane *view_planes = get_view_planes();
+	const Projection::Planes intersections[8][3] = {
+		{ Projection::PLANE_FAR, Projection::PLANE_LEFT, Projection::PLANE_TOP },
+		{ Projection::PLANE_FAR, Projection::PLANE_LEFT, Projection::PLANE_BOTTOM },
+		{ Projection::PLANE_FAR, Projection::PLANE_RIGHT, Projection::PLANE_TOP },
+		{ Projection::PLANE_FAR, Projection::PLANE_RIGHT, Projection::PLANE_BOTTOM },
+		{ Projection::PLANE_NEAR, Projection::PLANE_LEFT, Projection::PLANE_TOP },
+		{ Projection::PLANE_NEAR, Projection::PLANE_LEFT, Projection::PLANE_BOTTOM },
+		{ Projection::PLANE_NEAR, Projection::PLANE_RIGHT, Projection::PLANE_TOP },
+		{ Projection::PLANE_NEAR, Projection::PLANE_RIGHT, Projection::PLANE_BOTTOM },
+	};
+
+	endpoints_valid = true;
+	for (int i = 0; i < 8; i++) {
+		const Plane &a = view_planes[intersections[i][0]];
+		if (!a.intersect_3(view_planes[intersections[i][1]], view_planes[intersections[i][2]], &endpoints[i])) {
+			endpoints_valid = false;
+			break;
+		}
+	}
+	cached |= CACHED_ENDPOINTS;
+}
+
+void CachedProjection::set_projection(const Projection &p_projection) {
+	projection = p_projection;
+	cached = 0;
+}
+
+Projection &CachedProjection::edit_projection() {
+	cached = 0;
+	return projection;
+}
+
+const Projection &CachedProjection::get_inverse() const {
+	if (!(cached & CACHED_INVERSE)) {
+		if (!MathKernels::mat4_inverse((real_t *)inverse.columns, (const real_t *)projection.columns)) {
+			inverse.set_identity();
+		}
+		cached |= CACHED_INVERSE;
+	}
+	return inverse;
+}
+
+const Plane *CachedProjection::get_view_planes() const {
+	if (!(cached & CACHED_PLANES)) {
+		_update_planes();
+	}
+	return planes;
+}
+
+void CachedProjection::get_projection_planes(const Transform3D &p_transform, Plane *r_planes) const {
+	const Plane *view_planes = get_view_planes();
+
+	Basis basis_inverse_transpose = p_transform.basis.inverse();
+	basis_inverse_transpose.transpose();
+	for (int i = 0; i < 6; i++) {
+		r_planes[i] = p_transform.xform_fast(view_planes[i], basis_inverse_transpose);
+	}
+}
+
+bool CachedProjection::get_endpoints(const Transform3D &p_transform, Vector3 *r_8points) const {
+	if (!(cached & CACHED_ENDPOINTS)) {
+		_update_endpoints();
+	}
+	ERR_FAIL_COND_V(!endpoints_valid, false);
+
+	for (int i = 0; i < 8; i++) {
+		r_8points[i] = p_transform.xform(endpoints[i]);
+	}
+	return true;
+}
+
+CachedProjection::CachedProjection(const Projection &p_projection) :
+		projection(p_projection) {
+}
+
+} // namespace godot
@@ -30,7 +30,9 @@
 
 #include <godot_cpp/variant/char_string.hpp>
 
+#include <godot_cpp/core/math_kernels.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
 #include <godot_cpp/variant/node_path.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/string_name.hpp>
@@ -38,40 +40,229 @@
 #include <godot_cpp/godot.hpp>
 
 #include <cmath>
+#include <cstring>
 #include <string>
+#include <type_traits>
 
 namespace godot {
 
-template <typename L, typename R>
-_FORCE_INLINE_ bool is_str_less(const L *l_ptr, const R *r_ptr) {
-	while (true) {
-		const char32_t l = *l_ptr;
-		const char32_t r = *r_ptr;
-
-		if (l == 0 && r == 0) {
-			return false;
-		} else if (l == 0) {
-			return true;
-		} else if (r == 0) {
-			return false;
-		} else if (l < r) {
-			return true;
-		} else if (l > r) {
-			return false;
+// Below this length, the loops are inlined rather than calling a kernel.
+static constexpr int64_t KERNEL_MIN_LENGTH = 16;
+
+// Empty CharStrings have no buffer, which memcmp() doesn't accept even for a
+// length of 0.
+template <class T>
+static _FORCE_INLINE_ bool _equal(const T *p_a, const T *p_b, int64_t p_count) {
+	return p_count == 0 || memcmp(p_a, p_b, p_count * sizeof(T)) == 0;
+}
+
+template <class T>
+static _FORCE_INLINE_ int64_t _mismatch(const T *p_a, const T *p_b, int64_t p_count) {
+	if (p_count >= KERNEL_MIN_LENGTH) {
+		return MathKernels::mismatch((const uint8_t *)p_a, (const uint8_t *)p_b, p_count * sizeof(T)) / (int64_t)sizeof(T);
+	}
+	for (int64_t i = 0; i < p_count; i++) {
+		if (p_a[i] != p_b[i]) {
+			return i;
 		}
+	}
+	return p_count;
+}
 
-		l_ptr++;
-		r_ptr++;
+template <class T>
+static _FORCE_INLINE_ int64_t _find_char(const T *p_src, int64_t p_count, T p_char) {
+	if constexpr (sizeof(T) == 1) {
+		// The C library already has a vectorized version.
+		const void *found = memchr(p_src, (uint8_t)p_char, p_count);
+		return found ? (const T *)found - p_src : -1;
+	} else {
+		if (p_count >= KERNEL_MIN_LENGTH) {
+			if constexpr (sizeof(T) == 2) {
+				return MathKernels::find((const uint16_t *)p_src, p_count, (uint16_t)p_char);
+			} else {
+				return MathKernels::find((const uint32_t *)p_src, p_count, (uint32_t)p_char);
+			}
+		}
+		for (int64_t i = 0; i < p_count; i++) {
+			if (p_src[i] == p_char) {
+				return i;
+			}
+		}
+		return -1;
 	}
 }
 
+template <class T>
+static _FORCE_INLINE_ T _to_upper_ascii(T p_char) {
+	return (p_char >= 'a' && p_char <= 'z') ? T(p_char - ('a' - 'A')) : p_char;
+}
+
+template <class T>
+static _FORCE_INLINE_ T _to_lower_ascii(T p_char) {
+	return (p_char >= 'A' && p_char <= 'Z') ? T(p_char + ('a' - 'A')) : p_char;
+}
+
+template <class T>
+static _FORCE_INLINE_ int _compare_chars(T p_a, T p_b) {
+	typedef std::make_unsigned_t<T> U;
+	return (U)p_a < (U)p_b ? -1 : 1;
+}
+
+template <class T>
+int CharStringT<T>::compare(Span<T> p_a, Span<T> p_b) {
+	const int64_t common = MIN(p_a.size(), p_b.size());
+	if constexpr (sizeof(T) == 1) {
+		// Compares unsigned bytes.
+		const int result = common ? memcmp(p_a.ptr(), p_b.ptr(), common) : 0;
+		if (result != 0) {
+			return result < 0 ? -1 : 1;
+		}
+	} else {
+		const int64_t index = _mismatch(p_a.ptr(), p_b.ptr(), common);
+		if (index < common) {
+			return _compare_chars(p_a.ptr()[index], p_b.ptr()[index]);
+		}
+	}
+	return p_a.size() < p_b.size() ? -1 : (p_a.size() > p_b.size() ? 1 : 0);
+}
+
+template <class T>
+int CharStringT<T>::nocasecmp(Span<T> p_a, Span<T> p_b) {
+	const T *a = p_a.ptr();
+	const T *b = p_b.ptr();
+	const int64_t common = MIN(p_a.size(), p_b.size());
+	int64_t i = 0;
+	while (i < common) {
+		// Skip the run that matches exactly, then look at the first difference.
+		i += _mismatch(a + i, b + i, common - i);
+		if (i == common) {
+			break;
+		}
+		const T l = _to_upper_ascii(a[i]);
+		const T r = _to_upper_ascii(b[i]);
+		if (l != r) {
+			return _compare_chars(l, r);
+		}
+		i++;
+	}
+	return p_a.size() < p_b.size() ? -1 : (p_a.size() > p_b.size() ? 1 : 0);
+}
+
+template <class T>
+int64_t CharStringT<T>::find(Span<T> p_src, Span<T> p_str, int64_t p_from) {
+	const int64_t len = p_src.size();
+	const int64_t str_len = p_str.size();
+	if (p_from < 0 || str_len == 0 || str_len > len - p_from) {
+		return -1;
+	}
+
+	const T *src = p_src.ptr();
+	const T *str = p_str.ptr();
+	const int64_t last = len - str_len;
+	int64_t i = p_from;
+	while (i <= last) {
+		// Jump to the next occurrence of the first character, then check the rest.
+		const int64_t found = _find_char(src + i, last - i + 1, str[0]);
+		if (found < 0) {
+			return -1;
+		}
+		i += found;
+		if (_equal(src + i + 1, str + 1, str_len - 1)) {
+			return i;
+		}
+		i++;
+	}
+	return -1;
+}
+
+template <class T>
+int64_t CharStringT<T>::find_char(Span<T> p_src, T p_char, int64_t p_from) {
+	if (p_from < 0 || p_from >= (int64_t)p_src.size()) {
+		return -1;
+	}
+	const int64_t found = _find_char(p_src.ptr() + p_from, p_src.size() - p_from, p_char);
+	return found < 0 ? -1 : p_from + found;
+}
+
+template <class T>
+bool CharStringT<T>::begins_with(Span<T> p_src, Span<T> p_str) {
+	return p_str.size() <= p_src.size() && _equal(p_src.ptr(), p_str.ptr(), p_str.size());
+}
+
+template <class T>
+bool CharStringT<T>::ends_with(Span<T> p_src, Span<T> p_str) {
+	return p_str.size() <= p_src.size() && _equal(p_src.ptr() + p_src.size() - p_str.size(), p_str.ptr(), p_str.size());
+}
+
 template <class T>
 bool CharStringT<T>::operator<(const CharStringT<T> &p_right) const {
-	if (length() == 0) {
-		return p_right.length() != 0;
+	return compare(span(), p_right.span()) < 0;
+}
+
+template <class T>
+bool CharStringT<T>::operator==(const CharStringT<T> &p_right) const {
+	return length() == p_right.length() && _equal(ptr(), p_right.ptr(), length());
+}
+
+template <class T>
+bool CharStringT<T>::operator==(const T *p_cstr) const {
+	const int64_t len = p_cstr ? std::char_traits<T>::length(p_cstr) : 0;
+	return length() == len && _equal(ptr(), p_cstr, len);
+}
+
+template <class T>
+int CharStringT<T>::find(const T *p_str, int p_from) const {
+	ERR_FAIL_NULL_V(p_str, -1);
+	return (int)find(span(), Span<T>(p_str, std::char_traits<T>::length(p_str)), p_from);
+}
+
+template <class T>
+bool CharStringT<T>::begins_with(const T *p_str) const {
+	ERR_FAIL_NULL_V(p_str, false);
+	return begins_with(span(), Span<T>(p_str, std::char_traits<T>::length(p_str)));
+}
+
+template <class T>
+bool CharStringT<T>::ends_with(const T *p_str) const {
+	ERR_FAIL_NULL_V(p_str, false);
+	return ends_with(span(), Span<T>(p_str, std::char_traits<T>::length(p_str)));
+}
+
+template <class T>
+CharStringT<T> CharStringT<T>::to_lower() const {
+	CharStringT<T> ret;
+	ret.resize(size());
+	if constexpr (sizeof(T) == 1) {
+		MathKernels::ascii_case((uint8_t *)ret.ptrw(), (const uint8_t *)ptr(), size(), false);
+	} else {
+		const T *src = ptr();
+		T *dst = ret.ptrw();
+		for (int i = 0; i < size(); i++) {
+			dst[i] = _to_lower_ascii(src[i]);
+		}
+	}
+	return ret;
+}
+
+template <class T>
+CharStringT<T> CharStringT<T>::to_upper() const {
+	CharStringT<T> ret;
+	ret.resize(size());
+	if constexpr (sizeof(T) == 1) {
+		MathKernels::ascii_case((uint8_t *)ret.ptrw(), (const uint8_t *)ptr(), size(), true);
+	} else {
+		const T *src = ptr();
+		T *dst = ret.ptrw();
+		for (int i = 0; i < size(); i++) {
+			dst[i] = _to_upper_ascii(src[i]);
+		}
 	}
+	return ret;
+}
 
-	return is_str_less(get_data(), p_right.get_data());
+template <class T>
+uint32_t CharStringT<T>::hash() const {
+	return hash64_to_32(hash64_buffer(ptr(), length() * sizeof(T)));
 }
 
 template <class T>
@@ -230,17 +421,71 @@ String rtoss(double p_val) {
 }
 
 CharString String::utf8() const {
-	int length = internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), nullptr, 0);
+	// Most strings fit in the stack buffer, which saves the call that only
+	// computes the length.
+	char buffer[256];
+	int length = internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), buffer, sizeof(buffer));
 	int size = length + 1;
 	CharString str;
 	str.resize(size);
-	internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), str.ptrw(), length);
+	if (length <= (int)sizeof(buffer)) {
+		memcpy(str.ptrw(), buffer, length);
+	} else {
+		internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), str.ptrw(), length);
+	}
 
 	str[length] = '\0';
 
 	return str;
 }
 
+void String::utf8_into(CharString &r_reuse) const {
+	// Write straight into the existing buffer. Growing the size within the
+	// capacity keeps what was written, so a large enough buffer takes a single
+	// call and no allocation.
+	char *buffer = r_reuse.ptrw();
+	int capacity = r_reuse.get_capacity();
+	int length;
+	if (capacity > 1) {
+		length = internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), buffer, capacity - 1);
+		if (length < capacity) {
+			r_reuse.resize(length + 1);
+			r_reuse.ptrw()[length] = '\0';
+			return;
+		}
+	} else {
+		length = internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), nullptr, 0);
+	}
+
+	r_reuse.resize(length + 1);
+	internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), r_reuse.ptrw(), length);
+	r_reuse.ptrw()[length] = '\0';
+}
+
+int String::to_utf8(char *r_buffer, int p_capacity) const {
+	ERR_FAIL_COND_V(p_capacity < 1, 0);
+
+	int length = internal::gdextension_interface_string_to_utf8_chars(_native_ptr(), r_buffer, p_capacity - 1);
+	int written = MIN(length, p_capacity - 1);
+	if (written < length) {
+		// Don't leave half a character at the end of a truncated string.
+		int start = written;
+		while (start > 0 && (r_buffer[start - 1] & 0xc0) == 0x80) {
+			start--;
+		}
+		if (start > 0) {
+			const uint8_t lead = r_buffer[start - 1];
+			const int sequence = lead >= 0xf0 ? 4 : (lead >= 0xe0 ? 3 : (lead >= 0xc0 ? 2 : 1));
+			if (start - 1 + sequence > written) {
+				written = start - 1;
+			}
+		}
+	}
+	r_buffer[written] = '\0';
+
+	return length;
+}
+
 CharString String::ascii() const {
 	int length = internal::gdextension_interface_string_to_latin1_chars(_native_ptr(), nullptr, 0);
 	int size = length + 1;
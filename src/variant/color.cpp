@@ -29,10 +29,14 @@
 /**************************************************************************/
 
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+#include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/color.hpp>
 #include <godot_cpp/variant/color_names.inc.hpp>
 #include <godot_cpp/variant/string.hpp>
 
+#include <cstring>
+
 namespace godot {
 
 uint32_t Color::to_argb32() const {
@@ -107,37 +111,23 @@ uint64_t Color::to_rgba64() const {
 	return c;
 }
 
-String _to_hex(float p_val) {
+static void _to_hex(float p_val, char *r_hex) {
+	static const char digits[] = "0123456789abcdef";
 	int v = Math::round(p_val * 255.0f);
 	v = CLAMP(v, 0, 255);
-	String ret;
-
-	for (int i = 0; i < 2; i++) {
-		char32_t c[2] = { 0, 0 };
-		int lv = v & 0xF;
-		if (lv < 10) {
-			c[0] = '0' + lv;
-		} else {
-			c[0] = 'a' + lv - 10;
-		}
-
-		v >>= 4;
-		String cs = (const char32_t *)c;
-		ret = cs + ret;
-	}
-
-	return ret;
+	r_hex[0] = digits[v >> 4];
+	r_hex[1] = digits[v & 0xF];
 }
 
 String Color::to_html(bool p_alpha) const {
-	String txt;
-	txt = txt + _to_hex(r);
-	txt = txt + _to_hex(g);
-	txt = txt + _to_hex(b);
+	char txt[9] = {};
+	_to_hex(r, txt + 0);
+	_to_hex(g, txt + 2);
+	_to_hex(b, txt + 4);
 	if (p_alpha) {
-		txt = txt + _to_hex(a);
+		_to_hex(a, txt + 6);
 	}
-	return txt;
+	return String(txt);
 }
 
 float Color::get_h() const {
@@ -282,21 +272,53 @@ Color Color::hex64(uint64_t p_hex) {
 	return Color(r, g, b, a);
 }
 
-static int _parse_col4(const String &p_str, int p_ofs) {
-	char character = p_str[p_ofs];
-
-	if (character >= '0' && character <= '9') {
-		return character - '0';
-	} else if (character >= 'a' && character <= 'f') {
-		return character + (10 - 'a');
-	} else if (character >= 'A' && character <= 'F') {
-		return character + (10 - 'A');
+template <typename C>
+static int _parse_col4(C p_char) {
+	if (p_char >= '0' && p_char <= '9') {
+		return p_char - '0';
+	} else if (p_char >= 'a' && p_char <= 'f') {
+		return p_char + (10 - 'a');
+	} else if (p_char >= 'A' && p_char <= 'F') {
+		return p_char + (10 - 'A');
 	}
 	return -1;
 }
 
-static int _parse_col8(const String &p_str, int p_ofs) {
-	return _parse_col4(p_str, p_ofs) * 16 + _parse_col4(p_str, p_ofs + 1);
+// Parses "RGB", "RGBA", "RRGGBB" or "RRGGBBAA", with an optional leading "#".
+// Works on the characters directly, so String only costs a single ptr() call.
+template <typename C>
+static bool _parse_html(const C *p_rgba, int64_t p_length, Color &r_color) {
+	if (p_length > 0 && p_rgba[0] == '#') {
+		p_rgba++;
+		p_length--;
+	}
+
+	// 3 and 4 digit codes use 1 hex digit per channel instead of 2.
+	// Other sizes aren't in the HTML/CSS spec but we could add them if desired.
+	if (!(p_length == 3 || p_length == 4 || p_length == 6 || p_length == 8)) {
+		return false;
+	}
+
+	int digits[8];
+	for (int64_t i = 0; i < p_length; i++) {
+		digits[i] = _parse_col4(p_rgba[i]);
+		if (digits[i] < 0) {
+			return false;
+		}
+	}
+
+	if (p_length < 5) {
+		r_color.r = digits[0] / 15.0f;
+		r_color.g = digits[1] / 15.0f;
+		r_color.b = digits[2] / 15.0f;
+		r_color.a = p_length == 4 ? digits[3] / 15.0f : 1.0f;
+	} else {
+		r_color.r = (digits[0] * 16 + digits[1]) / 255.0f;
+		r_color.g = (digits[2] * 16 + digits[3]) / 255.0f;
+		r_color.b = (digits[4] * 16 + digits[5]) / 255.0f;
+		r_color.a = p_length == 8 ? (digits[6] * 16 + digits[7]) / 255.0f : 1.0f;
+	}
+	return true;
 }
 
 Color Color::inverted() const {
@@ -306,79 +328,32 @@ Color Color::inverted() const {
 }
 
 Color Color::html(const String &p_rgba) {
-	String color = p_rgba;
-	if (color.length() == 0) {
+	const int64_t length = p_rgba.length();
+	if (length == 0) {
 		return Color();
 	}
-	if (color[0] == '#') {
-		color = color.substr(1);
-	}
 
-	// If enabled, use 1 hex digit per channel instead of 2.
-	// Other sizes aren't in the HTML/CSS spec but we could add them if desired.
-	bool is_shorthand = color.length() < 5;
-	bool alpha = false;
-
-	if (color.length() == 8) {
-		alpha = true;
-	} else if (color.length() == 6) {
-		alpha = false;
-	} else if (color.length() == 4) {
-		alpha = true;
-	} else if (color.length() == 3) {
-		alpha = false;
-	} else {
-		ERR_FAIL_V_MSG(Color(), "Invalid color code: " + p_rgba + ".");
-	}
-
-	float r, g, b, a = 1.0f;
-	if (is_shorthand) {
-		r = _parse_col4(color, 0) / 15.0f;
-		g = _parse_col4(color, 1) / 15.0f;
-		b = _parse_col4(color, 2) / 15.0f;
-		if (alpha) {
-			a = _parse_col4(color, 3) / 15.0f;
-		}
-	} else {
-		r = _parse_col8(color, 0) / 255.0f;
-		g = _parse_col8(color, 2) / 255.0f;
-		b = _parse_col8(color, 4) / 255.0f;
-		if (alpha) {
-			a = _parse_col8(color, 6) / 255.0f;
-		}
-	}
-	ERR_FAIL_COND_V_MSG(r < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-	ERR_FAIL_COND_V_MSG(g < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-	ERR_FAIL_COND_V_MSG(b < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-	ERR_FAIL_COND_V_MSG(a < 0.0f, Color(), "Invalid color code: " + p_rgba + ".");
-
-	return Color(r, g, b, a);
+	Color color;
+	ERR_FAIL_COND_V_MSG(!_parse_html(p_rgba.ptr(), length, color), Color(), "Invalid color code: " + p_rgba + ".");
+	return color;
 }
 
 bool Color::html_is_valid(const String &p_color) {
-	String color = p_color;
-
-	if (color.length() == 0) {
+	const int64_t length = p_color.length();
+	if (length == 0) {
 		return false;
 	}
-	if (color[0] == '#') {
-		color = color.substr(1);
-	}
 
-	// Check if the amount of hex digits is valid.
-	int len = color.length();
-	if (!(len == 3 || len == 4 || len == 6 || len == 8)) {
-		return false;
-	}
+	Color color;
+	return _parse_html(p_color.ptr(), length, color);
+}
 
-	// Check if each hex digit is valid.
-	for (int i = 0; i < len; i++) {
-		if (_parse_col4(color, i) == -1) {
-			return false;
-		}
-	}
+bool Color::parse_html(const char *p_rgba, int64_t p_length, Color &r_color) {
+	return _parse_html(p_rgba, p_length, r_color);
+}
 
-	return true;
+bool Color::parse_html(const CharString &p_rgba, Color &r_color) {
+	return _parse_html(p_rgba.get_data(), p_rgba.length(), r_color);
 }
 
 Color Color::named(const String &p_name) {
@@ -398,33 +373,130 @@ Color Color::named(const String &p_name, const Color &p_default) {
 	return named_colors[idx].color;
 }
 
-int Color::find_named_color(const String &p_name) {
-	String name = p_name;
-	// Normalize name
-	name = name.replace(" ", "");
-	name = name.replace("-", "");
-	name = name.replace("_", "");
-	name = name.replace("'", "");
-	name = name.replace(".", "");
-	name = name.to_upper();
-
-	int idx = 0;
-	while (named_colors[idx].name != nullptr) {
-		if (name == String(named_colors[idx].name).replace("_", "")) {
-			return idx;
+static constexpr int NAMED_COLOR_COUNT = sizeof(named_colors) / sizeof(NamedColor) - 1;
+static constexpr int NAMED_COLOR_MAX_LENGTH = 32;
+
+// Uppercase name without the separators that color names ignore, or -1 if it
+// can't be a color name.
+template <typename C>
+static int _normalize_color_name(const C *p_name, int64_t p_length, char *r_name) {
+	int length = 0;
+	for (int64_t i = 0; i < p_length; i++) {
+		C c = p_name[i];
+		if (c == ' ' || c == '-' || c == '_' || c == '\'' || c == '.') {
+			continue;
+		}
+		if (c >= 'a' && c <= 'z') {
+			c -= 'a' - 'A';
+		}
+		if ((uint32_t)c > 127 || length == NAMED_COLOR_MAX_LENGTH) {
+			return -1;
 		}
-		idx++;
+		r_name[length++] = (char)c;
 	}
+	return length;
+}
 
-	return -1;
+// Perfect hash of the normalized color names, built on first use with "hash and
+// displace": names are spread in buckets by a first hash, then each bucket gets
+// the first seed that sends all of its names to free slots.
+struct NamedColorHash {
+	static constexpr uint32_t BUCKETS = 64;
+	static constexpr uint32_t SLOTS = 256;
+
+	uint32_t seeds[BUCKETS] = {};
+	int16_t slots[SLOTS];
+	char names[NAMED_COLOR_COUNT][NAMED_COLOR_MAX_LENGTH];
+	int lengths[NAMED_COLOR_COUNT];
+
+	static uint32_t hash(const char *p_name, int p_length, uint32_t p_seed) {
+		return hash_murmur3_buffer(p_name, p_length, p_seed);
+	}
+
+	NamedColorHash() {
+		static_assert(NAMED_COLOR_COUNT < SLOTS, "Too many named colors for the hash table.");
+
+		int16_t buckets[BUCKETS][NAMED_COLOR_COUNT];
+		int bucket_sizes[BUCKETS] = {};
+		int max_bucket_size = 0;
+		for (int i = 0; i < NAMED_COLOR_COUNT; i++) {
+			lengths[i] = _normalize_color_name(named_colors[i].name, strlen(named_colors[i].name), names[i]);
+			const uint32_t bucket = hash(names[i], lengths[i], 0) % BUCKETS;
+			buckets[bucket][bucket_sizes[bucket]++] = i;
+			max_bucket_size = MAX(max_bucket_size, bucket_sizes[bucket]);
+		}
+
+		for (uint32_t i = 0; i < SLOTS; i++) {
+			slots[i] = -1;
+		}
+
+		// Place the largest buckets first, while most slots are free.
+		for (int size = max_bucket_size; size > 0; size--) {
+			for (uint32_t bucket = 0; bucket < BUCKETS; bucket++) {
+				if (bucket_sizes[bucket] != size) {
+					continue;
+				}
+				for (uint32_t seed = 1; seeds[bucket] == 0; seed++) {
+					uint32_t bucket_slots[NAMED_COLOR_COUNT];
+					bool fits = true;
+					for (int i = 0; i < size && fits; i++) {
+						const int idx = buckets[bucket][i];
+						bucket_slots[i] = hash(names[idx], lengths[idx], seed) % SLOTS;
+						fits = slots[bucket_slots[i]] == -1;
+						for (int j = 0; j < i && fits; j++) {
+							fits = bucket_slots[j] != bucket_slots[i];
+						}
+					}
+					if (fits) {
+						seeds[bucket] = seed;
+						for (int i = 0; i < size; i++) {
+							slots[bucket_slots[i]] = buckets[bucket][i];
+						}
+					}
+				}
+			}
+		}
+	}
+
+	int find(const char *p_name, int p_length) const {
+		const uint32_t seed = seeds[hash(p_name, p_length, 0) % BUCKETS];
+		if (seed == 0) {
+			return -1;
+		}
+		const int idx = slots[hash(p_name, p_length, seed) % SLOTS];
+		if (idx == -1 || lengths[idx] != p_length || memcmp(names[idx], p_name, p_length) != 0) {
+			return -1;
+		}
+		return idx;
+	}
+};
+
+template <typename C>
+static int _find_named_color(const C *p_name, int64_t p_length) {
+	static const NamedColorHash named_color_hash;
+
+	char name[NAMED_COLOR_MAX_LENGTH];
+	const int length = _normalize_color_name(p_name, p_length, name);
+	if (length == -1) {
+		return -1;
+	}
+	return named_color_hash.find(name, length);
 }
 
-int Color::get_named_color_count() {
-	int idx = 0;
-	while (named_colors[idx].name != nullptr) {
-		idx++;
+int Color::find_named_color(const String &p_name) {
+	const int64_t length = p_name.length();
+	if (length == 0) {
+		return -1;
 	}
-	return idx;
+	return _find_named_color(p_name.ptr(), length);
+}
+
+int Color::find_named_color(const char *p_name, int64_t p_length) {
+	return _find_named_color(p_name, p_length);
+}
+
+int Color::get_named_color_count() {
+	return NAMED_COLOR_COUNT;
 }
 
 String Color::get_named_color_name(int p_idx) {
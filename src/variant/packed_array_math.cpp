@@ -0,0 +1,310 @@
+/**************************************************************************/
+/*  packed_array_math.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/variant/packed_array_math.hpp>
+
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/math_kernels.hpp>
+
+namespace godot {
+
+static constexpr int64_t MAX_CHUNKS = 64;
+static constexpr int64_t MIN_CHUNK_ELEMENTS = PackedArrayMath::THREADED_MIN_ELEMENTS / 4;
+
+// Calls p_func(begin, end, chunk) over [0, p_count), split across WorkerThreadPool
+// tasks if requested and worth it. Returns the number of chunks.
+template <typename F>
+static int64_t _for_each_chunk(int64_t p_count, bool p_threaded, const F &p_func) {
+	if (!p_threaded || p_count < PackedArrayMath::THREADED_MIN_ELEMENTS) {
+		p_func(0, p_count, 0);
+		return 1;
+	}
+
+	struct Task {
+		const F *func;
+		int64_t count;
+		int64_t chunk_size;
+
+		static void run(void *p_userdata, uint32_t p_chunk) {
+			const Task *task = static_cast<const Task *>(p_userdata);
+			const int64_t begin = p_chunk * task->chunk_size;
+			(*task->func)(begin, MIN(begin + task->chunk_size, task->count), p_chunk);
+		}
+	};
+
+	int64_t chunks = MIN(MAX_CHUNKS, (p_count + MIN_CHUNK_ELEMENTS - 1) / MIN_CHUNK_ELEMENTS);
+	Task task = { &p_func, p_count, (p_count + chunks - 1) / chunks };
+	chunks = (p_count + task.chunk_size - 1) / task.chunk_size;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int64_t group = pool->add_native_group_task(&Task::run, &task, (int)chunks, -1, true);
+	pool->wait_for_group_task_completion(group);
+	return chunks;
+}
+
+// Resizes r_dst and returns its buffer, once the engine made it unique.
+template <typename A>
+static auto *_write_ptr(A &r_dst, int64_t p_size) {
+	r_dst.resize(p_size);
+	return p_size > 0 ? r_dst.ptrw() : nullptr;
+}
+
+template <typename T, typename A>
+static T _sum(const A &p_array, bool p_threaded) {
+	const int64_t size = p_array.size();
+	if (size == 0) {
+		return 0;
+	}
+	const T *src = p_array.ptr();
+	T partials[MAX_CHUNKS];
+	const int64_t chunks = _for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t p_chunk) {
+		partials[p_chunk] = MathKernels::sum(src + p_begin, p_end - p_begin);
+	});
+	return MathKernels::sum(partials, chunks);
+}
+
+template <typename T, typename A>
+static T _min(const A &p_array, bool p_threaded) {
+	const int64_t size = p_array.size();
+	ERR_FAIL_COND_V_MSG(size == 0, 0, "Can't get the minimum of an empty array.");
+	const T *src = p_array.ptr();
+	T partials[MAX_CHUNKS];
+	const int64_t chunks = _for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t p_chunk) {
+		partials[p_chunk] = MathKernels::min(src + p_begin, p_end - p_begin);
+	});
+	return MathKernels::min(partials, chunks);
+}
+
+template <typename T, typename A>
+static T _max(const A &p_array, bool p_threaded) {
+	const int64_t size = p_array.size();
+	ERR_FAIL_COND_V_MSG(size == 0, 0, "Can't get the maximum of an empty array.");
+	const T *src = p_array.ptr();
+	T partials[MAX_CHUNKS];
+	const int64_t chunks = _for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t p_chunk) {
+		partials[p_chunk] = MathKernels::max(src + p_begin, p_end - p_begin);
+	});
+	return MathKernels::max(partials, chunks);
+}
+
+template <typename T, typename A>
+static T _dot(const A &p_a, const A &p_b, bool p_threaded) {
+	const int64_t size = p_a.size();
+	ERR_FAIL_COND_V_MSG(p_b.size() != size, 0, "Arrays must have the same size.");
+	if (size == 0) {
+		return 0;
+	}
+	const T *a = p_a.ptr();
+	const T *b = p_b.ptr();
+	T partials[MAX_CHUNKS];
+	const int64_t chunks = _for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t p_chunk) {
+		partials[p_chunk] = MathKernels::dot(a + p_begin, b + p_begin, p_end - p_begin);
+	});
+	return MathKernels::sum(partials, chunks);
+}
+
+template <typename T, typename A>
+static void _scale(A &r_dst, const A &p_src, T p_scale, bool p_threaded) {
+	const int64_t size = p_src.size();
+	T *dst = _write_ptr(r_dst, size);
+	if (size == 0) {
+		return;
+	}
+	const T *src = p_src.ptr();
+	_for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t) {
+		MathKernels::scale(dst + p_begin, src + p_begin, p_scale, p_end - p_begin);
+	});
+}
+
+template <typename T, typename A>
+static void _add(A &r_dst, const A &p_a, const A &p_b, bool p_threaded) {
+	const int64_t size = p_a.size();
+	ERR_FAIL_COND_MSG(p_b.size() != size, "Arrays must have the same size.");
+	T *dst = _write_ptr(r_dst, size);
+	if (size == 0) {
+		return;
+	}
+	const T *a = p_a.ptr();
+	const T *b = p_b.ptr();
+	_for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t) {
+		MathKernels::add(dst + p_begin, a + p_begin, b + p_begin, p_end - p_begin);
+	});
+}
+
+template <typename T, typename A>
+static void _axpy(A &r_dst, T p_alpha, const A &p_x, const A &p_y, bool p_threaded) {
+	const int64_t size = p_x.size();
+	ERR_FAIL_COND_MSG(p_y.size() != size, "Arrays must have the same size.");
+	T *dst = _write_ptr(r_dst, size);
+	if (size == 0) {
+		return;
+	}
+	const T *x = p_x.ptr();
+	const T *y = p_y.ptr();
+	_for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t) {
+		MathKernels::axpy(dst + p_begin, p_alpha, x + p_begin, y + p_begin, p_end - p_begin);
+	});
+}
+
+template <typename T, typename A>
+static void _clamp(A &r_dst, const A &p_src, T p_min, T p_max, bool p_threaded) {
+	const int64_t size = p_src.size();
+	T *dst = _write_ptr(r_dst, size);
+	if (size == 0) {
+		return;
+	}
+	const T *src = p_src.ptr();
+	_for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t) {
+		MathKernels::clamp(dst + p_begin, src + p_begin, p_min, p_max, p_end - p_begin);
+	});
+}
+
+template <typename T, typename A>
+static void _lerp(A &r_dst, const A &p_from, const A &p_to, T p_weight, bool p_threaded) {
+	const int64_t size = p_from.size();
+	ERR_FAIL_COND_MSG(p_to.size() != size, "Arrays must have the same size.");
+	T *dst = _write_ptr(r_dst, size);
+	if (size == 0) {
+		return;
+	}
+	const T *from = p_from.ptr();
+	const T *to = p_to.ptr();
+	_for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t) {
+		MathKernels::lerp(dst + p_begin, from + p_begin, to + p_begin, p_weight, p_end - p_begin);
+	});
+}
+
+static void _color_transform(PackedColorArray &r_dst, const PackedColorArray &p_src, void (*p_kernel)(float *, const float *, int64_t), bool p_threaded) {
+	const int64_t size = p_src.size();
+	float *dst = (float *)_write_ptr(r_dst, size);
+	if (size == 0) {
+		return;
+	}
+	const float *src = (const float *)p_src.ptr();
+	_for_each_chunk(size, p_threaded, [&](int64_t p_begin, int64_t p_end, int64_t) {
+		p_kernel(dst + p_begin * 4, src + p_begin * 4, p_end - p_begin);
+	});
+}
+
+float PackedArrayMath::sum(const PackedFloat32Array &p_array, bool p_threaded) {
+	return _sum<float>(p_array, p_threaded);
+}
+
+double PackedArrayMath::sum(const PackedFloat64Array &p_array, bool p_threaded) {
+	return _sum<double>(p_array, p_threaded);
+}
+
+float PackedArrayMath::min(const PackedFloat32Array &p_array, bool p_threaded) {
+	return _min<float>(p_array, p_threaded);
+}
+
+double PackedArrayMath::min(const PackedFloat64Array &p_array, bool p_threaded) {
+	return _min<double>(p_array, p_threaded);
+}
+
+float PackedArrayMath::max(const PackedFloat32Array &p_array, bool p_threaded) {
+	return _max<float>(p_array, p_threaded);
+}
+
+double PackedArrayMath::max(const PackedFloat64Array &p_array, bool p_threaded) {
+	return _max<double>(p_array, p_threaded);
+}
+
+float PackedArrayMath::dot(const PackedFloat32Array &p_a, const PackedFloat32Array &p_b, bool p_threaded) {
+	return _dot<float>(p_a, p_b, p_threaded);
+}
+
+double PackedArrayMath::dot(const PackedFloat64Array &p_a, const PackedFloat64Array &p_b, bool p_threaded) {
+	return _dot<double>(p_a, p_b, p_threaded);
+}
+
+void PackedArrayMath::scale(PackedFloat32Array &r_dst, const PackedFloat32Array &p_src, float p_scale, bool p_threaded) {
+	_scale(r_dst, p_src, p_scale, p_threaded);
+}
+
+void PackedArrayMath::scale(PackedFloat64Array &r_dst, const PackedFloat64Array &p_src, double p_scale, bool p_threaded) {
+	_scale(r_dst, p_src, p_scale, p_threaded);
+}
+
+void PackedArrayMath::add(PackedFloat32Array &r_dst, const PackedFloat32Array &p_a, const PackedFloat32Array &p_b, bool p_threaded) {
+	_add<float>(r_dst, p_a, p_b, p_threaded);
+}
+
+void PackedArrayMath::add(PackedFloat64Array &r_dst, const PackedFloat64Array &p_a, const PackedFloat64Array &p_b, bool p_threaded) {
+	_add<double>(r_dst, p_a, p_b, p_threaded);
+}
+
+void PackedArrayMath::axpy(PackedFloat32Array &r_dst, float p_alpha, const PackedFloat32Array &p_x, const PackedFloat32Array &p_y, bool p_threaded) {
+	_axpy(r_dst, p_alpha, p_x, p_y, p_threaded);
+}
+
+void PackedArrayMath::axpy(PackedFloat64Array &r_dst, double p_alpha, const PackedFloat64Array &p_x, const PackedFloat64Array &p_y, bool p_threaded) {
+	_axpy(r_dst, p_alpha, p_x, p_y, p_threaded);
+}
+
+void PackedArrayMath::clamp(PackedFloat32Array &r_dst, const PackedFloat32Array &p_src, float p_min, float p_max, bool p_threaded) {
+	_clamp(r_dst, p_src, p_min, p_max, p_threaded);
+}
+
+void PackedArrayMath::clamp(PackedFloat64Array &r_dst, const PackedFloat64Array &p_src, double p_min, double p_max, bool p_threaded) {
+	_clamp(r_dst, p_src, p_min, p_max, p_threaded);
+}
+
+void PackedArrayMath::lerp(PackedFloat32Array &r_dst, const PackedFloat32Array &p_from, const PackedFloat32Array &p_to, float p_weight, bool p_threaded) {
+	_lerp(r_dst, p_from, p_to, p_weight, p_threaded);
+}
+
+void PackedArrayMath::lerp(PackedFloat64Array &r_dst, const PackedFloat64Array &p_from, const PackedFloat64Array &p_to, double p_weight, bool p_threaded) {
+	_lerp(r_dst, p_from, p_to, p_weight, p_threaded);
+}
+
+void PackedArrayMath::srgb_to_linear(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded) {
+	_color_transform(r_dst, p_src, MathKernels::table.srgb_to_linear_rgba, p_threaded);
+}
+
+void PackedArrayMath::linear_to_srgb(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded) {
+	_color_transform(r_dst, p_src, MathKernels::table.linear_to_srgb_rgba, p_threaded);
+}
+
+void PackedArrayMath::premultiply_alpha(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded) {
+	_color_transform(r_dst, p_src, MathKernels::table.premultiply_alpha_rgba, p_threaded);
+}
+
+void PackedArrayMath::rgb_to_hsv(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded) {
+	_color_transform(r_dst, p_src, MathKernels::table.rgb_to_hsv_rgba, p_threaded);
+}
+
+void PackedArrayMath::hsv_to_rgb(PackedColorArray &r_dst, const PackedColorArray &p_src, bool p_threaded) {
+	_color_transform(r_dst, p_src, MathKernels::table.hsv_to_rgb_rgba, p_threaded);
+}
+
+} // namespace godot
@@ -30,6 +30,7 @@
 
 #include <godot_cpp/variant/projection.hpp>
 
+#include <godot_cpp/core/math_kernels.hpp>
 #include <godot_cpp/variant/aabb.hpp>
 #include <godot_cpp/variant/plane.hpp>
 #include <godot_cpp/variant/rect2.hpp>
@@ -95,6 +96,14 @@ Vector4 Projection::xform_inv(const Vector4 &p_vec4) const {
 			columns[3][0] * p_vec4.x + columns[3][1] * p_vec4.y + columns[3][2] * p_vec4.z + columns[3][3] * p_vec4.w);
 }
 
+void Projection::xform(const Vector3 *p_src, Vector3 *r_dst, int64_t p_count) const {
+	MathKernels::mat4_xform3((real_t *)r_dst, (const real_t *)columns, (const real_t *)p_src, p_count);
+}
+
+void Projection::xform(const Vector4 *p_src, Vector4 *r_dst, int64_t p_count) const {
+	MathKernels::mat4_xform4((real_t *)r_dst, (const real_t *)columns, (const real_t *)p_src, p_count);
+}
+
 void Projection::adjust_perspective_znear(real_t p_new_znear) {
 	real_t zfar = get_z_far();
 	real_t znear = p_new_znear;
@@ -483,8 +492,12 @@ Vector2 Projection::get_far_plane_half_extents() const {
 	return Vector2(res.x, res.y);
 }
 
+static_assert(sizeof(Projection) == sizeof(real_t) * 16, "Projection must be laid out as a column-major 4x4 matrix.");
+static_assert(sizeof(Vector3) == sizeof(real_t) * 3 && sizeof(Vector4) == sizeof(real_t) * 4, "Vectors must be tightly packed for the batch kernels.");
+
 bool Projection::get_endpoints(const Transform3D &p_transform, Vector3 *p_8points) const {
-	Array planes = get_projection_planes(Transform3D());
+	Plane planes[6];
+	get_projection_planes(Transform3D(), planes);
 	const Planes intersections[8][3] = {
 		{ PLANE_FAR, PLANE_LEFT, PLANE_TOP },
 		{ PLANE_FAR, PLANE_LEFT, PLANE_BOTTOM },
@@ -498,9 +511,9 @@ bool Projection::get_endpoints(const Transform3D &p_transform, Vector3 *p_8point
 
 	for (int i = 0; i < 8; i++) {
 		Vector3 point;
-		Plane a = planes[intersections[i][0]];
-		Plane b = planes[intersections[i][1]];
-		Plane c = planes[intersections[i][2]];
+		const Plane &a = planes[intersections[i][0]];
+		const Plane &b = planes[intersections[i][1]];
+		const Plane &c = planes[intersections[i][2]];
 		bool res = a.intersect_3(b, c, &point);
 		ERR_FAIL_COND_V(!res, false);
 		p_8points[i] = p_transform.xform(point);
@@ -510,17 +523,30 @@ bool Projection::get_endpoints(const Transform3D &p_transform, Vector3 *p_8point
 }
 
 Array Projection::get_projection_planes(const Transform3D &p_transform) const {
+	Plane planes[6];
+	get_projection_planes(p_transform, planes);
+
+	Array array;
+	array.resize(6);
+	for (int i = 0; i < 6; i++) {
+		array[i] = planes[i];
+	}
+	return array;
+}
+
+void Projection::get_projection_planes(const Transform3D &p_transform, Plane *r_planes) const {
 	/** Fast Plane Extraction from combined modelview/projection matrices.
 	 * References:
 	 * https://web.archive.org/web/20011221205252/https://www.markmorley.com/opengl/frustumculling.html
 	 * https://web.archive.org/web/20061020020112/https://www2.ravensoft.com/users/ggribb/plane%20extraction.pdf
 	 */
 
-	Array planes;
-	planes.resize(6);
-
 	const real_t *matrix = (const real_t *)this->columns;
 
+	// Shared by the six planes, see Transform3D::xform(const Plane &).
+	Basis basis_inverse_transpose = p_transform.basis.inverse();
+	basis_inverse_transpose.transpose();
+
 	Plane new_plane;
 
 	///////--- Near Plane ---///////
@@ -532,7 +558,7 @@ Array Projection::get_projection_planes(const Transform3D &p_transform) const {
 	new_plane.normal = -new_plane.normal;
 	new_plane.normalize();
 
-	planes[0] = p_transform.xform(new_plane);
+	r_planes[0] = p_transform.xform_fast(new_plane, basis_inverse_transpose);
 
 	///////--- Far Plane ---///////
 	new_plane = Plane(matrix[3] - matrix[2],
@@ -543,7 +569,7 @@ Array Projection::get_projection_planes(const Transform3D &p_transform) const {
 	new_plane.normal = -new_plane.normal;
 	new_plane.normalize();
 
-	planes[1] = p_transform.xform(new_plane);
+	r_planes[1] = p_transform.xform_fast(new_plane, basis_inverse_transpose);
 
 	///////--- Left Plane ---///////
 	new_plane = Plane(matrix[3] + matrix[0],
@@ -554,7 +580,7 @@ Array Projection::get_projection_planes(const Transform3D &p_transform) const {
 	new_plane.normal = -new_plane.normal;
 	new_plane.normalize();
 
-	planes[2] = p_transform.xform(new_plane);
+	r_planes[2] = p_transform.xform_fast(new_plane, basis_inverse_transpose);
 
 	///////--- Top Plane ---///////
 	new_plane = Plane(matrix[3] - matrix[1],
@@ -565,7 +591,7 @@ Array Projection::get_projection_planes(const Transform3D &p_transform) const {
 	new_plane.normal = -new_plane.normal;
 	new_plane.normalize();
 
-	planes[3] = p_transform.xform(new_plane);
+	r_planes[3] = p_transform.xform_fast(new_plane, basis_inverse_transpose);
 
 	///////--- Right Plane ---///////
 	new_plane = Plane(matrix[3] - matrix[0],
@@ -576,7 +602,7 @@ Array Projection::get_projection_planes(const Transform3D &p_transform) const {
 	new_plane.normal = -new_plane.normal;
 	new_plane.normalize();
 
-	planes[4] = p_transform.xform(new_plane);
+	r_planes[4] = p_transform.xform_fast(new_plane, basis_inverse_transpose);
 
 	///////--- Bottom Plane ---///////
 	new_plane = Plane(matrix[3] + matrix[1],
@@ -587,9 +613,7 @@ Array Projection::get_projection_planes(const Transform3D &p_transform) const {
 	new_plane.normal = -new_plane.normal;
 	new_plane.normalize();
 
-	planes[5] = p_transform.xform(new_plane);
-
-	return planes;
+	r_planes[5] = p_transform.xform_fast(new_plane, basis_inverse_transpose);
 }
 
 Projection Projection::inverse() const {
@@ -599,101 +623,8 @@ Projection Projection::inverse() const {
 }
 
 void Projection::invert() {
-	int i, j, k;
-	int pvt_i[4], pvt_j[4]; /* Locations of pivot matrix */
-	real_t pvt_val; /* Value of current pivot element */
-	real_t hold; /* Temporary storage */
-	real_t determinant = 1.0f;
-	for (k = 0; k < 4; k++) {
-		/** Locate k'th pivot element **/
-		pvt_val = columns[k][k]; /** Initialize for search **/
-		pvt_i[k] = k;
-		pvt_j[k] = k;
-		for (i = k; i < 4; i++) {
-			for (j = k; j < 4; j++) {
-				if (Math::abs(columns[i][j]) > Math::abs(pvt_val)) {
-					pvt_i[k] = i;
-					pvt_j[k] = j;
-					pvt_val = columns[i][j];
-				}
-			}
-		}
-
-		/** Product of pivots, gives determinant when finished **/
-		determinant *= pvt_val;
-		if (Math::is_zero_approx(determinant)) {
-			return; /** Matrix is singular (zero determinant). **/
-		}
-
-		/** "Interchange" rows (with sign change stuff) **/
-		i = pvt_i[k];
-		if (i != k) { /** If rows are different **/
-			for (j = 0; j < 4; j++) {
-				hold = -columns[k][j];
-				columns[k][j] = columns[i][j];
-				columns[i][j] = hold;
-			}
-		}
-
-		/** "Interchange" columns **/
-		j = pvt_j[k];
-		if (j != k) { /** If columns are different **/
-			for (i = 0; i < 4; i++) {
-				hold = -columns[i][k];
-				columns[i][k] = columns[i][j];
-				columns[i][j] = hold;
-			}
-		}
-
-		/** Divide column by minus pivot value **/
-		for (i = 0; i < 4; i++) {
-			if (i != k) {
-				columns[i][k] /= (-pvt_val);
-			}
-		}
-
-		/** Reduce the matrix **/
-		for (i = 0; i < 4; i++) {
-			hold = columns[i][k];
-			for (j = 0; j < 4; j++) {
-				if (i != k && j != k) {
-					columns[i][j] += hold * columns[k][j];
-				}
-			}
-		}
-
-		/** Divide row by pivot **/
-		for (j = 0; j < 4; j++) {
-			if (j != k) {
-				columns[k][j] /= pvt_val;
-			}
-		}
-
-		/** Replace pivot by reciprocal (at last we can touch it). **/
-		columns[k][k] = 1.0 / pvt_val;
-	}
-
-	/* That was most of the work, one final pass of row/column interchange */
-	/* to finish */
-	for (k = 4 - 2; k >= 0; k--) { /* Don't need to work with 1 by 1 corner*/
-		i = pvt_j[k]; /* Rows to swap correspond to pivot COLUMN */
-		if (i != k) { /* If rows are different */
-			for (j = 0; j < 4; j++) {
-				hold = columns[k][j];
-				columns[k][j] = -columns[i][j];
-				columns[i][j] = hold;
-			}
-		}
-
-		j = pvt_i[k]; /* Columns to swap correspond to pivot ROW */
-		if (j != k) { /* If columns are different */
-			for (i = 0; i < 4; i++) {
-				hold = columns[i][k];
-				columns[i][k] = -columns[i][j];
-				columns[i][j] = hold;
-			}
-		}
-	}
+	// Left untouched if singular.
+	MathKernels::mat4_inverse((real_t *)columns, (const real_t *)columns);
 }
 
 void Projection::flip_y() {
@@ -708,17 +639,7 @@ Projection::Projection() {
 
 Projection Projection::operator*(const Projection &p_matrix) const {
 	Projection new_matrix;
-
-	for (int j = 0; j < 4; j++) {
-		for (int i = 0; i < 4; i++) {
-			real_t ab = 0;
-			for (int k = 0; k < 4; k++) {
-				ab += columns[k][i] * p_matrix.columns[j][k];
-			}
-			new_matrix.columns[j][i] = ab;
-		}
-	}
-
+	MathKernels::mat4_mul((real_t *)new_matrix.columns, (const real_t *)columns, (const real_t *)p_matrix.columns);
 	return new_matrix;
 }
 
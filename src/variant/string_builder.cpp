@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*  string_builder.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/variant/string_builder.hpp>
+
+#include <godot_cpp/godot.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace godot {
+
+static constexpr char32_t _replacement_char = 0xfffd;
+
+StringBuilder &StringBuilder::append(const String &p_string) {
+	// Null for empty strings.
+	const char32_t *src = p_string.ptr();
+	if (src) {
+		append(src);
+	}
+	return *this;
+}
+
+StringBuilder &StringBuilder::append(const char *p_cstring) {
+	ERR_FAIL_NULL_V(p_cstring, *this);
+
+	const uint32_t length = strlen(p_cstring);
+	const uint32_t from = buffer.size();
+	buffer.resize(from + length);
+	char32_t *dst = buffer.ptr() + from;
+	for (uint32_t i = 0; i < length; i++) {
+		dst[i] = (uint8_t)p_cstring[i];
+	}
+	return *this;
+}
+
+StringBuilder &StringBuilder::append(const char32_t *p_cstring) {
+	ERR_FAIL_NULL_V(p_cstring, *this);
+
+	const uint32_t length = std::char_traits<char32_t>::length(p_cstring);
+	const uint32_t from = buffer.size();
+	buffer.resize(from + length);
+	memcpy(buffer.ptr() + from, p_cstring, length * sizeof(char32_t));
+	return *this;
+}
+
+StringBuilder &StringBuilder::append(char32_t p_char) {
+	buffer.push_back(p_char);
+	return *this;
+}
+
+StringBuilder &StringBuilder::append_utf8(const char *p_utf8, int p_length) {
+	ERR_FAIL_NULL_V(p_utf8, *this);
+
+	const uint8_t *src = (const uint8_t *)p_utf8;
+	const int length = p_length < 0 ? (int)strlen(p_utf8) : p_length;
+
+	// Never more characters than bytes.
+	const uint32_t from = buffer.size();
+	buffer.resize(from + length);
+	char32_t *dst = buffer.ptr() + from;
+
+	int i = 0;
+	while (i < length) {
+		const uint8_t lead = src[i];
+		if (lead < 0x80) {
+			*dst++ = lead;
+			i++;
+			continue;
+		}
+
+		int extra;
+		char32_t c;
+		if ((lead & 0xe0) == 0xc0) {
+			extra = 1;
+			c = lead & 0x1f;
+		} else if ((lead & 0xf0) == 0xe0) {
+			extra = 2;
+			c = lead & 0x0f;
+		} else if ((lead & 0xf8) == 0xf0) {
+			extra = 3;
+			c = lead & 0x07;
+		} else {
+			*dst++ = _replacement_char;
+			i++;
+			continue;
+		}
+
+		bool valid = i + extra < length;
+		for (int j = 1; valid && j <= extra; j++) {
+			const uint8_t next = src[i + j];
+			valid = (next & 0xc0) == 0x80;
+			c = (c << 6) | (next & 0x3f);
+		}
+		// Overlong encodings, surrogates and values past the last code point.
+		static constexpr char32_t min_value[4] = { 0, 0x80, 0x800, 0x10000 };
+		if (!valid || c < min_value[extra] || (c >= 0xd800 && c <= 0xdfff) || c > 0x10ffff) {
+			// Resynchronize on the next byte.
+			*dst++ = _replacement_char;
+			i++;
+			continue;
+		}
+
+		*dst++ = c;
+		i += extra + 1;
+	}
+
+	buffer.resize(dst - buffer.ptr());
+	return *this;
+}
+
+StringBuilder &StringBuilder::append_int(int64_t p_value) {
+	char32_t digits[20];
+	int count = 0;
+	// Negate as unsigned, so INT64_MIN doesn't overflow.
+	uint64_t value = p_value < 0 ? 0 - (uint64_t)p_value : (uint64_t)p_value;
+	do {
+		digits[count++] = U'0' + value % 10;
+		value /= 10;
+	} while (value);
+
+	if (p_value < 0) {
+		buffer.push_back(U'-');
+	}
+	while (count) {
+		buffer.push_back(digits[--count]);
+	}
+	return *this;
+}
+
+String StringBuilder::as_string() const {
+	String string;
+	internal::gdextension_interface_string_new_with_utf32_chars_and_len(string._native_ptr(), buffer.ptr(), buffer.size());
+	return string;
+}
+
+void StringBuilder::utf8_into(CharString &r_reuse) const {
+	const char32_t *src = buffer.ptr();
+	const uint32_t count = buffer.size();
+
+	// Size first, so the buffer is resized once to the exact length.
+	int length = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const char32_t c = src[i];
+		if (c < 0x80) {
+			length += 1;
+		} else if (c < 0x800) {
+			length += 2;
+		} else if (c < 0x10000 || c > 0x10ffff) {
+			// Surrogates and invalid values are written as the replacement character.
+			length += 3;
+		} else {
+			length += 4;
+		}
+	}
+
+	r_reuse.resize(length + 1);
+	uint8_t *dst = (uint8_t *)r_reuse.ptrw();
+	for (uint32_t i = 0; i < count; i++) {
+		char32_t c = src[i];
+		if (c < 0x80) {
+			*dst++ = c;
+		} else if (c < 0x800) {
+			*dst++ = 0xc0 | (c >> 6);
+			*dst++ = 0x80 | (c & 0x3f);
+		} else if (c < 0x10000 || c > 0x10ffff) {
+			if ((c >= 0xd800 && c <= 0xdfff) || c > 0x10ffff) {
+				c = _replacement_char;
+			}
+			*dst++ = 0xe0 | (c >> 12);
+			*dst++ = 0x80 | ((c >> 6) & 0x3f);
+			*dst++ = 0x80 | (c & 0x3f);
+		} else {
+			*dst++ = 0xf0 | (c >> 18);
+			*dst++ = 0x80 | ((c >> 12) & 0x3f);
+			*dst++ = 0x80 | ((c >> 6) & 0x3f);
+			*dst++ = 0x80 | (c & 0x3f);
+		}
+	}
+	*dst = 0;
+}
+
+CharString StringBuilder::utf8() const {
+	CharString str;
+	utf8_into(str);
+	return str;
+}
+
+} // namespace godot
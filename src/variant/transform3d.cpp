@@ -35,8 +35,7 @@
 namespace godot {
 
 void Transform3D::affine_invert() {
-	basis.invert();
-	origin = basis.xform(-origin);
+	SpatialMath::transform_affine_invert(*this);
 }
 
 Transform3D Transform3D::affine_inverse() const {
@@ -184,8 +183,7 @@ bool Transform3D::operator!=(const Transform3D &p_transform) const {
 }
 
 void Transform3D::operator*=(const Transform3D &p_transform) {
-	origin = xform(p_transform.origin);
-	basis *= p_transform.basis;
+	SpatialMath::transform_mul(*this, p_transform);
 }
 
 Transform3D Transform3D::operator*(const Transform3D &p_transform) const {
@@ -98,6 +98,8 @@ func _ready():
 
 	# String::resize().
 	assert_equal(example.test_string_resize("What"), "What!?")
+	assert_equal(example.test_string_builder("Godot"), "Hello, Godot! -42 Ď")
+	assert_equal(example.test_char_string_ops(), true)
 
 	# mp_callable() with void method.
 	var mp_callable: Callable = example.test_callable_mp()
@@ -155,6 +157,47 @@ func _ready():
 	# PackedArray iterators
 	assert_equal(example.test_vector_ops(), 105)
 
+	# PackedArrayMath
+	assert_equal(example.test_packed_array_math(PackedFloat64Array([1, 2, 3, 4])), PackedFloat64Array([10, 2, 8, 60]))
+	assert_equal(example.test_cached_projection(Projection.create_perspective(70, 1.5, 0.05, 100)), true)
+
+	# Sorting backends
+	var unsorted := PackedInt64Array()
+	for i in 100000:
+		unsorted.push_back((i * 7919) % 100003 - 50000)
+	var sorted := unsorted.duplicate()
+	sorted.sort()
+	assert_equal(example.test_sort(unsorted, false), sorted)
+	assert_equal(example.test_sort(unsorted, true), sorted)
+
+	# Hashing
+	assert_equal(example.test_hash_quality(), true)
+
+	# Intrusive scheduling queues
+	assert_equal(example.test_scheduling_queues(), 132413)
+	assert_equal(example.test_slot_map(), 55 - 3 - 8 + 100 + 10)
+
+	# SmallVector and Span
+	assert_equal(example.test_small_vector(), true)
+
+	# Paged allocators
+	assert_equal(example.test_paged_allocator(), 4950 + 99 + 98)
+
+	# Arrays, with and without memory accounting
+	assert_equal(example.test_memnew_arr(), true)
+
+	# Property<> wrappers, from the opt-in headers
+	assert_equal(example.test_property_wrappers(), Vector2(31, 21))
+
+	# FrozenMap, FrozenSet and EytzingerArray
+	assert_equal(example.test_frozen_map(), true)
+
+	# Color names and HTML codes
+	assert_equal(example.test_color_parsing(), true)
+
+	# Rate limited errors, which don't evaluate their message when suppressed
+	assert_equal(example.test_error_rate_limit(), true)
+
 	# Properties.
 	assert_equal(example.group_subgroup_custom_position, Vector2(0, 0))
 	example.group_subgroup_custom_position = Vector2(50, 50)
@@ -11,6 +11,21 @@
 #include <godot_cpp/classes/label.hpp>
 #include <godot_cpp/classes/multiplayer_api.hpp>
 #include <godot_cpp/classes/multiplayer_peer.hpp>
+#include <godot_cpp/classes/properties/control.hpp>
+#include <godot_cpp/variant/cached_projection.hpp>
+#include <godot_cpp/variant/packed_array_math.hpp>
+#include <godot_cpp/variant/string_builder.hpp>
+#include <godot_cpp/templates/frozen_map.hpp>
+#include <godot_cpp/templates/frozen_set.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
+#include <godot_cpp/templates/paged_allocator.hpp>
+#include <godot_cpp/templates/parallel_sort.hpp>
+#include <godot_cpp/templates/rb_map.hpp>
+#include <godot_cpp/templates/self_list_queue.hpp>
+#include <godot_cpp/templates/slot_map.hpp>
+#include <godot_cpp/templates/small_vector.hpp>
+#include <godot_cpp/templates/timing_wheel.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace godot;
@@ -196,7 +211,22 @@ void Example::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("test_str_utility"), &Example::test_str_utility);
 	ClassDB::bind_method(D_METHOD("test_string_is_fourty_two"), &Example::test_string_is_fourty_two);
 	ClassDB::bind_method(D_METHOD("test_string_resize"), &Example::test_string_resize);
+	ClassDB::bind_method(D_METHOD("test_string_builder", "name"), &Example::test_string_builder);
+	ClassDB::bind_method(D_METHOD("test_char_string_ops"), &Example::test_char_string_ops);
 	ClassDB::bind_method(D_METHOD("test_vector_ops"), &Example::test_vector_ops);
+	ClassDB::bind_method(D_METHOD("test_packed_array_math", "array"), &Example::test_packed_array_math);
+	ClassDB::bind_method(D_METHOD("test_cached_projection", "projection"), &Example::test_cached_projection);
+	ClassDB::bind_method(D_METHOD("test_sort", "array", "parallel"), &Example::test_sort);
+	ClassDB::bind_method(D_METHOD("test_hash_quality"), &Example::test_hash_quality);
+	ClassDB::bind_method(D_METHOD("test_scheduling_queues"), &Example::test_scheduling_queues);
+	ClassDB::bind_method(D_METHOD("test_slot_map"), &Example::test_slot_map);
+	ClassDB::bind_method(D_METHOD("test_small_vector"), &Example::test_small_vector);
+	ClassDB::bind_method(D_METHOD("test_paged_allocator"), &Example::test_paged_allocator);
+	ClassDB::bind_method(D_METHOD("test_memnew_arr"), &Example::test_memnew_arr);
+	ClassDB::bind_method(D_METHOD("test_property_wrappers"), &Example::test_property_wrappers);
+	ClassDB::bind_method(D_METHOD("test_frozen_map"), &Example::test_frozen_map);
+	ClassDB::bind_method(D_METHOD("test_color_parsing"), &Example::test_color_parsing);
+	ClassDB::bind_method(D_METHOD("test_error_rate_limit"), &Example::test_error_rate_limit);
 
 	ClassDB::bind_method(D_METHOD("test_object_cast_to_node", "object"), &Example::test_object_cast_to_node);
 	ClassDB::bind_method(D_METHOD("test_object_cast_to_control", "object"), &Example::test_object_cast_to_control);
@@ -395,6 +425,40 @@ String Example::test_string_resize(String p_string) const {
 	return p_string;
 }
 
+String Example::test_string_builder(const String &p_name) const {
+	StringBuilder builder;
+	builder.append("Hello, ").append(p_name).append(U'!');
+	builder.append(" ").append_int(-42).append_utf8(" \xc4\x8e");
+
+	// The UTF-8 from the builder and from the String must match.
+	CharString from_builder = builder.utf8();
+	CharString from_string;
+	builder.as_string().utf8_into(from_string);
+	char buffer[8];
+	const int length = builder.as_string().to_utf8(buffer, sizeof(buffer));
+	if (strcmp(from_builder.ptr(), from_string.ptr()) != 0 || length != from_string.length() || strncmp(buffer, "Hello, ", 7) != 0) {
+		return String();
+	}
+	return builder.as_string();
+}
+
+bool Example::test_char_string_ops() const {
+	// Long enough to go through the vector kernels.
+	CharString line = "SET position_of_the_player_character = 42 # Comment";
+	if (!line.begins_with("SET ") || !line.ends_with("Comment") || line.find("= ") != 37 || line.find_char('#') != 42) {
+		return false;
+	}
+	if (line.to_upper() == line || line.to_upper().nocasecmp_to(line) != 0 || line.compare(CharString("SET z")) >= 0) {
+		return false;
+	}
+	if (line != CharString(line.ptr()) || line.hash() != CharString(line.ptr()).hash()) {
+		return false;
+	}
+
+	Char32String wide = String(line.ptr()).utf32();
+	return wide.find(U"= ") == 37 && wide.find_char(U'#') == 42 && wide.to_lower().begins_with(U"set ");
+}
+
 int Example::test_vector_ops() const {
 	PackedInt32Array arr;
 	arr.push_back(10);
@@ -408,6 +472,500 @@ int Example::test_vector_ops() const {
 	return ret;
 }
 
+PackedFloat64Array Example::test_packed_array_math(const PackedFloat64Array &p_array) const {
+	// Scaling the copy in place must leave p_array untouched.
+	PackedFloat64Array scaled = p_array;
+	PackedArrayMath::scale(scaled, scaled, 2.0);
+	PackedFloat64Array ret;
+	ret.push_back(PackedArrayMath::sum(p_array));
+	ret.push_back(PackedArrayMath::min(scaled));
+	ret.push_back(PackedArrayMath::max(scaled));
+	ret.push_back(PackedArrayMath::dot(p_array, scaled));
+	return ret;
+}
+
+bool Example::test_cached_projection(const Projection &p_projection) const {
+	CachedProjection cached(p_projection);
+	Projection identity = p_projection * cached.get_inverse();
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			if (!Math::is_equal_approx(identity[i][j], i == j ? (real_t)1.0 : (real_t)0.0)) {
+				return false;
+			}
+		}
+	}
+
+	Transform3D transform(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3));
+	Vector3 points[8];
+	Vector3 cached_points[8];
+	if (!p_projection.get_endpoints(transform, points) || !cached.get_endpoints(transform, cached_points)) {
+		return false;
+	}
+	for (int i = 0; i < 8; i++) {
+		if (!points[i].is_equal_approx(cached_points[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+PackedInt64Array Example::test_sort(const PackedInt64Array &p_array, bool p_parallel) const {
+	Vector<int64_t> values;
+	values.resize(p_array.size());
+	for (int i = 0; i < values.size(); i++) {
+		values.write[i] = p_array[i];
+	}
+
+	if (p_parallel) {
+		ParallelSortArray<int64_t> sorter;
+		sorter.sort(values.ptrw(), values.size());
+	} else {
+		// Descending by key, to go through the key projection.
+		values.sort_custom([](int64_t p_value) { return -p_value; });
+		values.reverse();
+	}
+
+	PackedInt64Array ret;
+	ret.resize(values.size());
+	for (int i = 0; i < values.size(); i++) {
+		ret[i] = values[i];
+	}
+	return ret;
+}
+
+bool Example::test_hash_quality() const {
+	// Avalanche: flipping any input bit flips each output bit about half the time.
+	const int samples = 4000;
+	Vector<int> flips;
+	flips.resize(64 * 64);
+	flips.fill(0);
+	uint64_t state = 1;
+	for (int i = 0; i < samples; i++) {
+		state = hash64_one_64(state);
+		const uint64_t hash = hash64_one_64(state);
+		for (int bit = 0; bit < 64; bit++) {
+			const uint64_t diff = hash ^ hash64_one_64(state ^ (uint64_t(1) << bit));
+			for (int out = 0; out < 64; out++) {
+				flips.write[bit * 64 + out] += (diff >> out) & 1;
+			}
+		}
+	}
+	for (int i = 0; i < flips.size(); i++) {
+		if (flips[i] < samples * 0.45 || flips[i] > samples * 0.55) {
+			return false;
+		}
+	}
+
+	// A dense grid of small coordinates, the usual worst case for weak hashes.
+	HashSet<uint32_t> hashes;
+	Vector<int> buckets;
+	buckets.resize(4096);
+	buckets.fill(0);
+	for (int x = 0; x < 64; x++) {
+		for (int y = 0; y < 64; y++) {
+			for (int z = 0; z < 64; z++) {
+				const uint32_t hash = HashMapHasherFast::hash(Vector3i(x, y, z));
+				hashes.insert(hash);
+				buckets.write[hash & 4095]++;
+			}
+		}
+	}
+	if (hashes.size() < 64 * 64 * 64 - 64) {
+		return false;
+	}
+	for (int i = 0; i < buckets.size(); i++) {
+		if (buckets[i] >= 128) {
+			return false;
+		}
+	}
+
+	// Buffers of every length, and every single bit flip, including the
+	// striped path used for long buffers.
+	Vector<uint8_t> data;
+	data.resize(3000);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = uint8_t(hash64_one_64(i));
+	}
+	HashSet<uint64_t> buffer_hashes;
+	for (int length = 0; length <= data.size(); length++) {
+		buffer_hashes.insert(hash64_buffer(data.ptr(), length));
+	}
+	for (int bit = 0; bit < data.size() * 8; bit += 7) {
+		data.write[bit / 8] ^= 1 << (bit % 8);
+		buffer_hashes.insert(hash64_buffer(data.ptr(), data.size()));
+		data.write[bit / 8] ^= 1 << (bit % 8);
+	}
+	return buffer_hashes.size() == data.size() + 1 + (data.size() * 8 + 6) / 7;
+}
+
+namespace {
+
+struct ScheduledItem {
+	SelfList<ScheduledItem> dirty_link;
+	TimingWheel<ScheduledItem, 16>::Timer timer;
+	int value = 0;
+
+	ScheduledItem() :
+			dirty_link(this), timer(this) {}
+};
+
+} // namespace
+
+int Example::test_scheduling_queues() const {
+	ScheduledItem items[4];
+	for (int i = 0; i < 4; i++) {
+		items[i].value = i + 1;
+	}
+
+	// Marking twice only queues once, removed items are skipped.
+	SelfListQueue<ScheduledItem> dirty;
+	dirty.push(&items[0].dirty_link);
+	dirty.push(&items[1].dirty_link);
+	dirty.push(&items[0].dirty_link);
+	dirty.push(&items[2].dirty_link);
+	dirty.remove(&items[1].dirty_link);
+	int ret = 0;
+	dirty.flush([&](ScheduledItem *p_item) { ret = ret * 10 + p_item->value; });
+
+	// Fires in deadline order, including past a full turn of the wheel.
+	TimingWheel<ScheduledItem, 16> wheel;
+	wheel.schedule(&items[0].timer, 20);
+	wheel.schedule(&items[1].timer, 3);
+	wheel.schedule(&items[2].timer, 5);
+	wheel.schedule(&items[3].timer, 4);
+	wheel.cancel(&items[2].timer);
+	for (int i = 0; i < 30; i++) {
+		wheel.advance(1, [&](ScheduledItem *p_item) { ret = ret * 10 + p_item->value; });
+	}
+
+	// Clearing from a callback cancels the timers that expired with it.
+	wheel.schedule(&items[2].timer, 1);
+	wheel.schedule(&items[3].timer, 1);
+	wheel.advance(1, [&](ScheduledItem *p_item) {
+		ret = ret * 10 + p_item->value;
+		wheel.clear();
+	});
+	if (wheel.size() != 0 || wheel.is_scheduled(&items[3].timer)) {
+		return -1;
+	}
+	return ret;
+}
+
+int Example::test_slot_map() const {
+	SlotMap<int, 4> map;
+	SlotHandle handles[10];
+	for (int i = 0; i < 10; i++) {
+		handles[i] = map.insert(i + 1);
+	}
+
+	// Erased handles stop resolving, even once their slot is reused.
+	map.erase(handles[2]);
+	map.erase(handles[7]);
+	SlotHandle reused = map.insert(100);
+	if (map.owns(handles[2]) || map.owns(handles[7]) || reused.index != handles[7].index) {
+		return -1;
+	}
+
+	// Handles survive a trip through the engine.
+	if (SlotHandle::from_rid(handles[5].to_rid()) != handles[5] || SlotHandle().to_rid() != RID()) {
+		return -1;
+	}
+
+	int sum = 0;
+	for (int value : map) {
+		sum += value;
+	}
+	return sum + *map.get_or_null(handles[9]);
+}
+
+bool Example::test_small_vector() const {
+	// Grows from the inline storage to the heap, keeping the elements.
+	SmallVector<String, 4> names;
+	for (int i = 0; i < 6; i++) {
+		names.push_back(String::num_int64(i));
+		if (names.is_inline() != (i < 4)) {
+			return false;
+		}
+	}
+	names.insert(0, "first");
+	names.insert(3, "middle");
+	names.remove_at(1);
+	names.erase("5");
+	names.remove_at_unordered(0);
+	// 4, 1, middle, 2, 3
+	if (names.size() != 5 || names[0] != "4" || names[2] != "middle" || names[4] != "3") {
+		return false;
+	}
+
+	// Appending itself, from the inline storage and from the heap.
+	SmallVector<String, 4> small = { "a", "b", "c" };
+	small.append_array(small.span());
+	if (small.is_inline() || small.size() != 6 || small[3] != "a" || small[5] != "c") {
+		return false;
+	}
+	names.append_array(names);
+	if (names.size() != 10 || names[5] != "4" || names[9] != "3") {
+		return false;
+	}
+
+	// Copies are independent, moves leave the source empty.
+	SmallVector<String, 4> copy = names;
+	copy[0] = "copy";
+	SmallVector<String, 4> moved = std::move(copy);
+	SmallVector<String, 4> pair = { "x", "y" };
+	SmallVector<String, 4> moved_inline = std::move(pair);
+	if (names[0] != "4" || moved[0] != "copy" || !copy.is_empty() || !pair.is_empty()) {
+		return false;
+	}
+	if (!moved_inline.is_inline() || moved_inline[1] != "y") {
+		return false;
+	}
+
+	// Spans see the elements in place, whatever holds them.
+	const int raw[] = { 3, 1, 2 };
+	Span<int> span = raw;
+	SmallVector<int, 2> numbers(span);
+	numbers.sort();
+	Span<int> sorted = numbers;
+	return sorted.size() == 3 && sorted.ptr() == numbers.ptr() && sorted[0] == 1 && sorted.find(3) == 2 && span.find(4) == -1;
+}
+
+Vector2 Example::test_property_wrappers() const {
+	Control *control = memnew(Control);
+	control->custom_minimum_size() = Vector2(10, 20);
+	control->custom_minimum_size().x() = 30;
+	control->custom_minimum_size() += Vector2(1, 1);
+	const Vector2 ret = control->custom_minimum_size();
+	memdelete(control);
+	return ret;
+}
+
+int Example::test_paged_allocator() const {
+	// Freed slots are reused before a new page is allocated.
+	PagedAllocator<Vector3> allocator(4);
+	Vector3 *vectors[6];
+	for (int i = 0; i < 6; i++) {
+		vectors[i] = allocator.alloc(i, 0, 0);
+	}
+	allocator.free(vectors[1]);
+	Vector3 *reused = allocator.alloc(10, 0, 0);
+	if (reused != vectors[1] || allocator.get_page_count() != 2 || allocator.get_allocation_count() != 6) {
+		return -1;
+	}
+	for (int i = 0; i < 6; i++) {
+		allocator.free(vectors[i]);
+	}
+
+	// Containers share the pool of their node size, and give their nodes back to it.
+	auto &map_pool = PagedNodeAllocator<sizeof(RBMap<int, int>::Element)>::get_pool();
+	const uint64_t map_nodes = map_pool.get_allocation_count();
+	int sum = 0;
+	{
+		PagedList<int> list;
+		PagedRBMap<int, int> map;
+		for (int i = 0; i < 100; i++) {
+			list.push_back(i);
+			map[i] = i * 2;
+		}
+		map.erase(50);
+		for (int value : list) {
+			sum += value;
+		}
+		sum += map.size() + map[49];
+	}
+	if (map_pool.get_allocation_count() != map_nodes) {
+		return -1;
+	}
+	return sum;
+}
+
+namespace {
+
+struct ArrayElement {
+	String name;
+};
+
+} // namespace
+
+bool Example::test_memnew_arr() const {
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+	const uint32_t tag = GODOT_MEMORY_TAG(ArrayElement[]);
+	const MemoryAccounting::Snapshot before = MemoryAccounting::snapshot();
+#endif
+
+	// The element count is stored in front of the array, next to the
+	// accounting header when there is one.
+	ArrayElement *elements = memnew_arr(ArrayElement, 5);
+	for (int i = 0; i < 5; i++) {
+		elements[i].name = String::num_int64(i);
+	}
+	if (elements[4].name != "4") {
+		return false;
+	}
+	memdelete_arr(elements);
+
+#ifdef GODOT_MEMORY_ACCOUNTING_ENABLED
+	const MemoryAccounting::Snapshot changes = MemoryAccounting::diff(before, MemoryAccounting::snapshot());
+	return tag < changes.size() && changes[tag].allocations == 1 && changes[tag].frees == 1;
+#else
+	return true;
+#endif
+}
+
+bool Example::test_frozen_map() const {
+	// lower_bound() against a linear search, at every size up to a few levels.
+	EytzingerArray<int> search;
+	int sorted[20];
+	int layout[21];
+	for (int len = 0; len <= 20; len++) {
+		for (int i = 0; i < len; i++) {
+			sorted[i] = i * 2 + 1;
+		}
+		EytzingerArray<int>::build(sorted, layout, len);
+		for (int value = 0; value <= len * 2 + 1; value++) {
+			const int k = search.lower_bound(layout, len, value);
+			const int expected = value <= len * 2 - 1 ? sorted[value / 2] : -1;
+			if ((k == 0 ? -1 : layout[k]) != expected || (search.find(layout, len, value) != 0) != (value % 2 == 1 && expected != -1)) {
+				return false;
+			}
+		}
+	}
+
+	FrozenMap<int, String> empty;
+	if (!empty.is_empty() || empty.has(0) || empty.getptr(0) != nullptr) {
+		return false;
+	}
+
+	const int keys[5] = { 10, 20, 30, 40, 50 };
+	const String values[5] = { "a", "b", "c", "d", "e" };
+	FrozenMap<int, String> map;
+	map.build(keys, values, 5);
+	if (map.size() != 5 || map[10] != "a" || map[50] != "e" || map.has(5) || map.has(25) || map.has(55)) {
+		return false;
+	}
+
+	// Changes are seen before and after freeze(), and copies keep the old data.
+	FrozenMap<int, String> copy = map;
+	map.insert(25, "x");
+	map.insert(10, "y");
+	map.erase(50);
+	map.erase(60);
+	for (int i = 0; i < 2; i++) {
+		if (map.size() != 5 || map[25] != "x" || map[10] != "y" || map.has(50) || map.is_frozen() != (i == 1)) {
+			return false;
+		}
+		map.freeze();
+	}
+	if (copy.size() != 5 || copy[10] != "a" || !copy.has(50) || copy.has(25)) {
+		return false;
+	}
+
+	FrozenSet<int> set;
+	set.build(keys, 5);
+	set.erase(10);
+	set.insert(5);
+	set.freeze();
+	if (set.size() != 5 || set.has(10) || !set.has(5) || !set.has(50) || set.has(45)) {
+		return false;
+	}
+	set.clear();
+	return set.is_empty() && !set.has(5);
+}
+
+bool Example::test_color_parsing() const {
+	// Every name in the list is found, with or without its separators.
+	for (int i = 0; i < Color::get_named_color_count(); i++) {
+		const String name = Color::get_named_color_name(i);
+		if (Color::find_named_color(name) != i || Color::find_named_color(name.replace("_", "").to_lower()) != i) {
+			return false;
+		}
+	}
+
+	// Case and separators are ignored, unknown names aren't found.
+	const int sea_green = Color::find_named_color("DARK_SEA_GREEN");
+	const char *variants[] = { "dark sea green", "Dark-Sea-Green", "darkseagreen", "DaRk.SeA_gReEn", "dark'sea green" };
+	for (const char *variant : variants) {
+		const CharString utf8 = String(variant).utf8();
+		if (Color::find_named_color(variant) != sea_green || Color::find_named_color(utf8.get_data(), utf8.length()) != sea_green) {
+			return false;
+		}
+	}
+	const char *unknown[] = { "", "dark sea", "dark sea greenish", "not a color", "dark sea grün", "#ff0000" };
+	for (const char *name : unknown) {
+		if (Color::find_named_color(String::utf8(name)) != -1 || Color::named(String::utf8(name), Color(1, 2, 3)) != Color(1, 2, 3)) {
+			return false;
+		}
+	}
+	if (sea_green == -1 || Color::named("dark sea green") != Color::hex(0x8FBC8FFF) || Color::from_string("Alice Blue", Color()) != Color::hex(0xF0F8FFFF)) {
+		return false;
+	}
+
+	// One hex digit per channel for #rgb and #rgba, two for #rrggbb and #rrggbbaa.
+	if (Color::html("#f80") != Color(1, 8 / 15.0f, 0) || Color::html("F80C") != Color(1, 8 / 15.0f, 0, 12 / 15.0f)) {
+		return false;
+	}
+	if (Color::html("#ff8000") != Color(1, 128 / 255.0f, 0) || Color::html("ff800040") != Color(1, 128 / 255.0f, 0, 64 / 255.0f)) {
+		return false;
+	}
+	const char *invalid[] = { "", "#", "#ff", "#ff800", "#ff8000400", "#gg8000", "ff 800", "##f80" };
+	for (const char *code : invalid) {
+		Color color;
+		if (Color::html_is_valid(code) || Color::parse_html(String(code).utf8(), color) || Color::from_string(code, Color(1, 2, 3)) != Color(1, 2, 3)) {
+			return false;
+		}
+	}
+
+	Color color;
+	const Color expected = Color::hex(0x12AB34CD);
+	return Color::parse_html("#12ab34cd", 9, color) && color == expected && Color::html(expected.to_html()) == expected && expected.to_html(false) == "12ab34";
+}
+
+namespace {
+
+String counted_error_message(int &r_evaluated) {
+	r_evaluated++;
+	return "Expected error " + String::num_int64(r_evaluated) + ".";
+}
+
+int fail_with_counted_message(int &r_evaluated) {
+	ERR_FAIL_COND_V_MSG(true, -1, counted_error_message(r_evaluated));
+	return 0;
+}
+
+} // namespace
+
+bool Example::test_error_rate_limit() const {
+	// The first errors of a call site are printed, then one in GODOT_ERROR_RATE_LIMIT_EVERY
+	// with the count of those suppressed since the last one.
+	uint64_t suppressed = 1;
+	for (uint64_t count = 1; count <= GODOT_ERROR_RATE_LIMIT_FIRST; count++) {
+		if (!_err_rate_limit(count, suppressed) || suppressed != 0) {
+			return false;
+		}
+	}
+	for (uint64_t i = 1; i <= 2 * GODOT_ERROR_RATE_LIMIT_EVERY; i++) {
+		const bool printed = _err_rate_limit(GODOT_ERROR_RATE_LIMIT_FIRST + i, suppressed);
+		if (printed != (i % GODOT_ERROR_RATE_LIMIT_EVERY == 0) || suppressed != uint64_t(printed ? GODOT_ERROR_RATE_LIMIT_EVERY - 1 : 0)) {
+			return false;
+		}
+	}
+
+	// Suppressed errors still return, but don't evaluate their message.
+	const int failures = 2000;
+	int evaluated = 0;
+	for (int i = 0; i < failures; i++) {
+		if (fail_with_counted_message(evaluated) != -1) {
+			return false;
+		}
+	}
+#ifdef GODOT_STRIP_ERROR_MESSAGES
+	const int expected = 0;
+#else
+	const int expected = failures > GODOT_ERROR_RATE_LIMIT_FIRST ? GODOT_ERROR_RATE_LIMIT_FIRST + (failures - GODOT_ERROR_RATE_LIMIT_FIRST) / GODOT_ERROR_RATE_LIMIT_EVERY : failures;
+#endif
+	return evaluated == expected;
+}
+
 Callable Example::test_callable_mp() {
 	return callable_mp(this, &Example::unbound_method1);
 }
@@ -128,7 +128,22 @@ public:
 	String test_str_utility() const;
 	bool test_string_is_fourty_two(const String &p_str) const;
 	String test_string_resize(String p_original) const;
+	String test_string_builder(const String &p_name) const;
+	bool test_char_string_ops() const;
 	int test_vector_ops() const;
+	PackedFloat64Array test_packed_array_math(const PackedFloat64Array &p_array) const;
+	bool test_cached_projection(const Projection &p_projection) const;
+	PackedInt64Array test_sort(const PackedInt64Array &p_array, bool p_parallel) const;
+	bool test_hash_quality() const;
+	int test_scheduling_queues() const;
+	int test_slot_map() const;
+	bool test_small_vector() const;
+	int test_paged_allocator() const;
+	bool test_memnew_arr() const;
+	Vector2 test_property_wrappers() const;
+	bool test_frozen_map() const;
+	bool test_color_parsing() const;
+	bool test_error_rate_limit() const;
 
 	bool test_object_cast_to_node(Object *p_object) const;
 	bool test_object_cast_to_control(Object *p_object) const;
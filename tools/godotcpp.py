@@ -1,6 +1,7 @@
 import os, sys, platform
 
 from SCons.Variables import EnumVariable, PathVariable, BoolVariable
+from SCons.Script import Copy
 from SCons.Tool import Tool
 from SCons.Builder import Builder
 from SCons.Errors import UserError
@@ -119,6 +120,14 @@ def options(opts, env):
             validator=validate_file,
         )
     )
+    opts.Add(
+        PathVariable(
+            key="build_profile",
+            help="Path to a JSON file listing the engine classes to generate bindings for (`enabled_classes`) or to skip (`disabled_classes`)",
+            default=env.get("build_profile", None),
+            validator=validate_file,
+        )
+    )
     opts.Add(
         BoolVariable(
             key="generate_bindings",
@@ -198,6 +207,55 @@ def options(opts, env):
         )
     )
 
+    opts.Add(
+        BoolVariable(
+            key="unity_build",
+            help="Compile the generated sources in batches of `unity_build_batch_size` files",
+            default=env.get("unity_build", False),
+        )
+    )
+    opts.Add(
+        key="unity_build_batch_size",
+        help="Number of generated sources per batch in unity builds",
+        default=env.get("unity_build_batch_size", 32),
+    )
+    opts.Add(
+        BoolVariable(
+            key="precompiled_headers",
+            help="Precompile the headers shared by all sources, listed in `src/precompiled.hpp`",
+            default=env.get("precompiled_headers", False),
+        )
+    )
+
+    opts.Add(
+        BoolVariable(
+            key="method_profiler",
+            help="Count and time every call to a bound method, see `GDExtensionProfiler`",
+            default=env.get("method_profiler", False),
+        )
+    )
+    opts.Add(
+        BoolVariable(
+            key="abi_tracer",
+            help="Record the calls into the engine for export as a Chrome trace, see `ABITracer`",
+            default=env.get("abi_tracer", False),
+        )
+    )
+    opts.Add(
+        BoolVariable(
+            key="memory_accounting",
+            help="Count the memory allocated by each type and container, see `MemoryAccounting`",
+            default=env.get("memory_accounting", False),
+        )
+    )
+    opts.Add(
+        BoolVariable(
+            key="strip_error_messages",
+            help="Leave the conditions and messages out of errors, keeping only where they happened",
+            default=env.get("strip_error_messages", False),
+        )
+    )
+
     # Add platform options
     for pl in platforms:
         tool = Tool(pl, toolpath=["tools"])
@@ -295,6 +353,15 @@ def generate(env):
     if env["precision"] == "double":
         env.Append(CPPDEFINES=["REAL_T_IS_DOUBLE"])
 
+    if env["method_profiler"]:
+        env.Append(CPPDEFINES=["GODOT_METHOD_PROFILER_ENABLED"])
+    if env["abi_tracer"]:
+        env.Append(CPPDEFINES=["GODOT_ABI_TRACER_ENABLED"])
+    if env["memory_accounting"]:
+        env.Append(CPPDEFINES=["GODOT_MEMORY_ACCOUNTING_ENABLED"])
+    if env["strip_error_messages"]:
+        env.Append(CPPDEFINES=["GODOT_STRIP_ERROR_MESSAGES"])
+
     # Allow detecting when building as a GDExtension.
     env.Append(CPPDEFINES=["GDEXTENSION"])
 
@@ -323,29 +390,51 @@ def generate(env):
 def _godot_cpp(env):
     extension_dir = normalize_path(env.get("gdextension_dir", env.Dir("gdextension").abspath), env)
     api_file = normalize_path(env.get("custom_api_file", env.File(extension_dir + "/extension_api.json").abspath), env)
-    bindings = env.GodotCPPBindings(
-        env.Dir("."),
-        [
-            api_file,
-            os.path.join(extension_dir, "gdextension_interface.h"),
-            "binding_generator.py",
-        ],
-    )
+    bindings_sources = [
+        api_file,
+        os.path.join(extension_dir, "gdextension_interface.h"),
+        "binding_generator.py",
+    ]
+    if env.get("build_profile"):
+        env["build_profile"] = normalize_path(env["build_profile"], env)
+        bindings_sources.append(env["build_profile"])
+    bindings = env.GodotCPPBindings(env.Dir("."), bindings_sources)
     # Forces bindings regeneration.
     if env["generate_bindings"]:
         env.AlwaysBuild(bindings)
         env.NoCache(bindings)
 
+    # Includes
+    env.AppendUnique(CPPPATH=[env.Dir(d) for d in [extension_dir, "include", "gen/include"]])
+
     # Sources to compile
     sources = []
     add_sources(sources, "src", "cpp")
     add_sources(sources, "src/classes", "cpp")
     add_sources(sources, "src/core", "cpp")
     add_sources(sources, "src/variant", "cpp")
-    sources.extend([f for f in bindings if str(f).endswith(".cpp")])
-
-    # Includes
-    env.AppendUnique(CPPPATH=[env.Dir(d) for d in [extension_dir, "include", "gen/include"]])
+    generated_sources = [f for f in bindings if str(f).endswith(".cpp")]
+    if env["unity_build"]:
+        generated_sources = _unity_sources(env, generated_sources)
+    sources.extend(generated_sources)
+
+    # Per-ISA kernels get their own environment with the matching instruction set enabled.
+    # Without `simd_dispatch`, they're built like any other source and compile to nothing.
+    isa_objects = []
+    for isa, isa_flags in env["SIMD_ISA_CCFLAGS"].items():
+        isa_sources = [f for f in sources if isinstance(f, str) and f.endswith("_" + isa + ".cpp")]
+        if not isa_sources:
+            continue
+        env_isa = env.Clone()
+        env_isa.Append(CCFLAGS=isa_flags)
+        env_isa.Append(CPPDEFINES=["GODOT_SIMD_BUILD_" + isa.upper()])
+        sources = [f for f in sources if f not in isa_sources]
+        isa_objects.extend(env_isa.Object(isa_sources))
+
+    # Set up after the per-ISA environments, the precompiled header targets the baseline instruction set.
+    if env["precompiled_headers"]:
+        sources = _precompiled_header(env, sources)
+    sources.extend(isa_objects)
 
     library = None
     library_name = "libgodot-cpp" + env["suffix"] + env["LIBSUFFIX"]
@@ -362,3 +451,48 @@ def _godot_cpp(env):
 
     env.AppendUnique(LIBS=[env.File("bin/%s" % library_name)])
     return library
+
+
+# Generated sources make up most of the build and don't depend on each other, so they're
+# compiled in batches. Hand-written sources may have file-local helpers with the same names.
+def _unity_sources(env, sources):
+    unity_dir = os.path.join(env["godot_cpp_gen_dir"], "gen", "unity")
+    batch_size = max(1, int(env["unity_build_batch_size"]))
+    unity_sources = []
+    for i in range(0, len(sources), batch_size):
+        lines = ["/* THIS FILE IS GENERATED. EDITS WILL BE LOST. */", ""]
+        for f in sources[i : i + batch_size]:
+            lines.append('#include "%s"' % os.path.relpath(f.abspath, unity_dir).replace("\\", "/"))
+        unity_file = os.path.join(unity_dir, "unity_%d.cpp" % (i // batch_size))
+        unity_sources.extend(env.Textfile(unity_file, lines))
+    return unity_sources
+
+
+# Returns the library objects, built with the precompiled header. It only applies to godot-cpp,
+# the environment is cloned so extensions using `env` aren't affected.
+def _precompiled_header(env, sources):
+    pch_dir = os.path.join(env["godot_cpp_gen_dir"], "gen", "pch")
+    header = env.Command(os.path.join(pch_dir, "precompiled.hpp"), "src/precompiled.hpp", Copy("$TARGET", "$SOURCE"))
+    env_pch = env.Clone()
+
+    if env.get("is_msvc", False):
+        source = env_pch.Textfile(os.path.join(pch_dir, "precompiled.cpp"), ['#include "precompiled.hpp"'])
+        env_pch.Depends(source, header)
+        pch, pch_object = env_pch.PCH(source)
+        env_pch["PCH"] = pch
+        env_pch["PCHSTOP"] = "precompiled.hpp"
+        env_pch.Append(CPPPATH=[env_pch.Dir(pch_dir)])
+        env_pch.Append(CCFLAGS=["/FIprecompiled.hpp"])
+        return env_pch.Object(sources) + [pch_object]
+
+    # GCC picks `precompiled.hpp.gch` and Clang `precompiled.hpp.pch` up when including `precompiled.hpp`.
+    pch_suffix = ".pch" if "clang" in os.path.basename(env["CXX"]) else ".gch"
+    pch = env.Command(
+        header[0].abspath + pch_suffix,
+        header,
+        "$CXX -x c++-header -o $TARGET -c $CXXFLAGS $CCFLAGS $_CCCOMCOM $SOURCE",
+    )
+    env_pch.Append(CXXFLAGS=["-include", header[0].abspath])
+    objects = env_pch.Object(sources)
+    env_pch.Depends(objects, pch)
+    return objects
@@ -49,6 +49,30 @@ def options(opts):
     )
     opts.Add(BoolVariable("debug_symbols", "Build with debugging symbols", True))
     opts.Add(BoolVariable("dev_build", "Developer build with dev-only debugging code (DEV_ENABLED)", False))
+    opts.Add(
+        EnumVariable(
+            "lto",
+            "Link-time optimization, also applied when linking the extension",
+            "none",
+            ("none", "thin", "full"),
+        )
+    )
+    opts.Add(
+        EnumVariable(
+            "pgo",
+            "Profile-guided optimization: instrument the build to collect a profile, or optimize with it",
+            "none",
+            ("none", "generate", "use"),
+        )
+    )
+    opts.Add("pgo_dir", "Directory where profiles are written and read by `pgo`", "pgo")
+    opts.Add(
+        BoolVariable(
+            "simd_dispatch",
+            "Build SSE4.1/AVX2/AVX-512 variants of SIMD kernels, selected at runtime (x86 only)",
+            True,
+        )
+    )
 
 
 def exists(env):
@@ -97,6 +121,27 @@ def generate(env):
         # Disable assert() for production targets (only used in thirdparty code).
         env.Append(CPPDEFINES=["NDEBUG"])
 
+    # Kernels in `*_sse4_1.cpp`, `*_avx2.cpp` and `*_avx512.cpp` files are compiled with the
+    # flags below and picked at runtime by CPUFeatures, so the rest of the library (and the
+    # extension) keeps targeting the baseline ISA.
+    env["SIMD_ISA_CCFLAGS"] = {}
+    if env["simd_dispatch"] and env["arch"] in ["x86_32", "x86_64"]:
+        env.Append(CPPDEFINES=["GODOT_SIMD_DISPATCH_ENABLED"])
+        if env.get("is_msvc", False):
+            env["SIMD_ISA_CCFLAGS"] = {
+                "sse4_1": [],  # SSE intrinsics don't need any flag with MSVC.
+                "avx2": ["/arch:AVX2"],
+                "avx512": ["/arch:AVX512"],
+            }
+        else:
+            env["SIMD_ISA_CCFLAGS"] = {
+                "sse4_1": ["-msse4.1"],
+                "avx2": ["-mavx2", "-mfma"],
+                "avx512": ["-mavx512f", "-mavx512dq", "-mavx512bw", "-mavx512vl", "-mavx2", "-mfma"],
+            }
+    else:
+        env["simd_dispatch"] = False
+
     # Set optimize and debug_symbols flags.
     # "custom" means do nothing and let users set their own optimization flags.
     if env.get("is_msvc", False):
@@ -142,3 +187,59 @@ def generate(env):
             env.Append(CCFLAGS=["-Og"])
         elif env["optimize"] == "none":
             env.Append(CCFLAGS=["-O0"])
+
+        # Lets GCC inline and clone exported functions in shared libraries, Clang already does.
+        if env["optimize"] in ["speed", "speed_trace", "size"] and not using_clang(env):
+            env.Append(CCFLAGS=["-fno-semantic-interposition"])
+
+    # Link-time and profile-guided optimization. Flags are added to LINKFLAGS too, so they
+    # apply when the extension links godot-cpp, which is where cross-TU inlining happens.
+    if env["pgo"] != "none" and env.get("is_msvc", False) and env["lto"] == "none":
+        print("MSVC requires link-time code generation for profile-guided optimization, enabling `lto=full`.")
+        env["lto"] = "full"
+
+    if env["lto"] != "none":
+        if env.get("is_msvc", False):
+            # MSVC has a single LTCG mode, incremental linking is the closest to ThinLTO.
+            env.Append(CCFLAGS=["/GL"])
+            env.Append(ARFLAGS=["/LTCG"])
+            env.Append(LINKFLAGS=["/LTCG:INCREMENTAL" if env["lto"] == "thin" else "/LTCG"])
+        elif using_clang(env) or env["platform"] == "web":
+            lto_flag = "-flto=thin" if env["lto"] == "thin" else "-flto"
+            env.Append(CCFLAGS=[lto_flag])
+            env.Append(LINKFLAGS=[lto_flag])
+            if env["platform"] == "linux" and env["AR"] == "ar":
+                env["AR"] = "llvm-ar"
+                env["RANLIB"] = "llvm-ranlib"
+        else:
+            # GCC has no ThinLTO, its default partitioned mode is the closest.
+            if env["lto"] == "thin":
+                print("GCC doesn't support ThinLTO, using `lto=full`.")
+            env.Append(CCFLAGS=["-flto=auto"])
+            env.Append(LINKFLAGS=["-flto=auto"])
+            # The wrappers load the LTO plugin, so archives get an index of the bitcode symbols.
+            if not env["AR"].endswith("gcc-ar"):
+                env["AR"] = env["AR"][: -len("ar")] + "gcc-ar"
+                env["RANLIB"] = env["RANLIB"][: -len("ranlib")] + "gcc-ranlib"
+
+    if env["pgo"] != "none":
+        pgo_dir = env["pgo_dir"]
+        if not os.path.isabs(pgo_dir):
+            pgo_dir = os.path.join(env.Dir("#").abspath, pgo_dir)
+        if env["pgo"] == "use" and not os.path.isdir(pgo_dir):
+            print("No profile found in '%s', build with `pgo=generate` and run the project first." % pgo_dir)
+
+        if env.get("is_msvc", False):
+            # Profiles (.pgd/.pgc) are written next to the linked binary.
+            env.Append(LINKFLAGS=["/GENPROFILE" if env["pgo"] == "generate" else "/USEPROFILE"])
+        elif env["pgo"] == "generate":
+            # GCC writes `.gcda` files, Clang `.profraw` files to merge into `default.profdata` with llvm-profdata.
+            pgo_flags = ["-fprofile-generate=" + pgo_dir, "-fprofile-update=atomic"]
+            env.Append(CCFLAGS=pgo_flags)
+            env.Append(LINKFLAGS=pgo_flags)
+        else:
+            pgo_flags = ["-fprofile-use=" + pgo_dir]
+            if not using_clang(env):
+                pgo_flags += ["-fprofile-correction", "-Wno-missing-profile"]
+            env.Append(CCFLAGS=pgo_flags)
+            env.Append(LINKFLAGS=pgo_flags)